@@ -0,0 +1,70 @@
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2025, Elite Robots.
+"""
+Measure the import time of elite_cs_sdk with lazy submodules and with every binding registered at import
+(ELITE_CS_SDK_EAGER=1), and the cost of the first access to each submodule.
+
+Each measurement runs in a fresh interpreter, as a short-lived tool or a worker process would.
+
+    python benchmark_import_time.py --runs 20
+"""
+import argparse
+import os
+import statistics
+import subprocess
+import sys
+
+IMPORT_SNIPPET = """
+import time
+t0 = time.perf_counter()
+import elite_cs_sdk
+t1 = time.perf_counter()
+{access}
+t2 = time.perf_counter()
+print(t1 - t0, t2 - t1)
+"""
+
+
+def measure(runs, eager, access=""):
+    env = dict(os.environ)
+    env.pop("ELITE_CS_SDK_EAGER", None)
+    if eager:
+        env["ELITE_CS_SDK_EAGER"] = "1"
+    code = IMPORT_SNIPPET.format(access=access)
+    imports, accesses = [], []
+    for _ in range(runs):
+        out = subprocess.run([sys.executable, "-c", code], env=env, check=True, capture_output=True, text=True)
+        t_import, t_access = (float(v) for v in out.stdout.split())
+        imports.append(t_import * 1000.0)
+        accesses.append(t_access * 1000.0)
+    return imports, accesses
+
+
+def summary(values):
+    return "median {:7.2f} ms  min {:7.2f} ms  max {:7.2f} ms".format(
+        statistics.median(values), min(values), max(values)
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--runs", type=int, default=10, help="Interpreters started per measurement")
+    args = parser.parse_args()
+
+    from elite_cs_sdk.elite_cs_sdk_python import submoduleNames
+
+    eager, _ = measure(args.runs, eager=True)
+    lazy, _ = measure(args.runs, eager=False)
+    print("import elite_cs_sdk")
+    print("  eager (ELITE_CS_SDK_EAGER=1)  " + summary(eager))
+    print("  lazy                          " + summary(lazy))
+    print("  gain                          {:7.2f} ms".format(statistics.median(eager) - statistics.median(lazy)))
+
+    print("first access to a submodule (lazy)")
+    for name in submoduleNames():
+        _, access = measure(args.runs, eager=False, access="elite_cs_sdk.{}".format(name))
+        print("  {:<28}  {}".format(name, summary(access)))
+
+
+if __name__ == "__main__":
+    main()
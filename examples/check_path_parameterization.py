@@ -0,0 +1,76 @@
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2025, Elite Robots.
+"""
+Check that PathParameterization keeps the joint limits on dense, noisy, random and sparse paths, resampled at the
+servo period.
+
+Waypoint noise makes the curvature of the spline change sharply between two grid points, where the limits used to be
+exceeded by up to a factor of 2. The limits hold along the whole motion, so the default tolerance only absorbs
+rounding. This script is a regression check: it exits with status 1 if a velocity or an acceleration exceeds its
+limit by more than the tolerance, on the default grid or on a coarse one. No robot is needed.
+
+    python check_path_parameterization.py --tolerance 0.001
+"""
+import argparse
+import sys
+import time
+
+import numpy as np
+
+from elite_cs_sdk import PathParameterization
+
+MAX_VELOCITY = np.array([2.0, 2.0, 2.0, 3.0, 3.0, 3.0])
+MAX_ACCELERATION = np.array([4.0, 4.0, 4.0, 6.0, 6.0, 6.0])
+
+
+def make_paths(seed):
+    rng = np.random.default_rng(seed)
+    harmonics = 0.3 * np.arange(1, 7)
+    dense = np.arange(3000)[:, None] * 0.02
+    sparse = np.arange(40)[:, None] * 1.2
+    paths = {"dense": 0.8 * np.sin(dense * harmonics)}
+    for noise in (5e-4, 2e-3, 5e-3):
+        paths[f"dense, noise {noise:g}"] = 0.8 * np.sin(dense * harmonics) + rng.uniform(-noise, noise, (3000, 6))
+    paths["random walk"] = np.cumsum(rng.normal(0.0, 0.01, (10000, 6)), axis=0)
+    paths["sparse"] = 0.8 * np.sin(sparse * harmonics)
+    return paths
+
+
+def worst_ratios(timed, dt):
+    velocity = np.max(np.abs(timed.velocities) / MAX_VELOCITY)
+    acceleration = np.max(np.abs(timed.accelerations) / MAX_ACCELERATION)
+    # Second difference of the positions: what a servo loop actually commands
+    positions = timed.positions[:-1]
+    fd = (positions[2:] - 2.0 * positions[1:-1] + positions[:-2]) / (dt * dt)
+    acceleration = max(acceleration, np.max(np.abs(fd) / MAX_ACCELERATION))
+    return velocity, acceleration
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--dt", type=float, default=0.002, help="resampling period [s]")
+    parser.add_argument("--tolerance", type=float, default=0.001, help="allowed relative excess over a limit")
+    parser.add_argument("--coarse-grid", type=int, default=200, help="grid points of the coarse run")
+    parser.add_argument("--seed", type=int, default=0)
+    args = parser.parse_args()
+
+    solver = PathParameterization(MAX_VELOCITY, MAX_ACCELERATION)
+    failed = False
+    for name, path in make_paths(args.seed).items():
+        for grid_points in (0, args.coarse_grid):
+            start = time.perf_counter()
+            timed = solver.compute(path, dt=args.dt, grid_points=grid_points)
+            elapsed = time.perf_counter() - start
+            velocity, acceleration = worst_ratios(timed, args.dt)
+            ok = velocity <= 1.0 + args.tolerance and acceleration <= 1.0 + args.tolerance
+            failed = failed or not ok
+            grid = "default" if grid_points == 0 else str(grid_points)
+            print(
+                f"{name:20s} grid {grid:>7s}  duration {timed.duration:8.3f} s  solved in {elapsed * 1e3:6.1f} ms"
+                f"  velocity {velocity:5.3f}  acceleration {acceleration:5.3f}  {'ok' if ok else 'FAILED'}"
+            )
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
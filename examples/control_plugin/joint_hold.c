@@ -0,0 +1,56 @@
+/* SPDX-License-Identifier: MIT */
+/* Copyright (c) 2025, Elite Robots. */
+/*
+ * Control plugin example: hold the joint positions of the first sample with a proportional speedj law.
+ *
+ * Parameters: [0] gain [1/s], [1] speed limit [rad/s]
+ * Telemetry:  [0..5] position error [rad]
+ *
+ * Build (EliteControlPlugin.h is installed next to the elite_cs_sdk package):
+ *     cc -shared -fPIC -O2 -I $(python -c "import elite_cs_sdk, os; print(os.path.dirname(elite_cs_sdk.__file__))") \
+ *         joint_hold.c -o libjoint_hold.so
+ */
+#include "EliteControlPlugin.h"
+
+#include <stdlib.h>
+
+typedef struct {
+    int initialized;
+    double hold[6];
+} JointHold;
+
+uint32_t elite_control_abi_version(void) { return ELITE_CONTROL_ABI_VERSION; }
+
+const char* elite_control_name(void) { return "joint_hold"; }
+
+void* elite_control_create(uint32_t param_count) {
+    (void)param_count;
+    return calloc(1, sizeof(JointHold));
+}
+
+void elite_control_destroy(void* context) { free(context); }
+
+int elite_control_step(void* context, const EliteControlState* state, const double* params, uint32_t param_count,
+                       EliteControlOutput* out) {
+    JointHold* self = (JointHold*)context;
+    if (self == NULL || param_count < 2) {
+        return -1;
+    }
+    if (!self->initialized) {
+        for (int i = 0; i < 6; ++i) {
+            self->hold[i] = state->actual_joint_positions[i];
+        }
+        self->initialized = 1;
+    }
+    const double gain = params[0];
+    const double limit = params[1];
+    out->command = ELITE_CONTROL_SPEEDJ;
+    for (int i = 0; i < 6; ++i) {
+        const double error = self->hold[i] - state->actual_joint_positions[i];
+        double speed = gain * error;
+        speed = speed > limit ? limit : (speed < -limit ? -limit : speed);
+        out->values[i] = speed;
+        out->telemetry[i] = error;
+    }
+    return 0;
+}
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""
+Run a native control law (examples/control_plugin/joint_hold.c) on every RTSI sample.
+
+Python only loads the plugin, updates its parameters and reads its telemetry; the loop runs on a real-time C++
+thread that never takes the GIL.
+
+Usage:
+    python example_control_plugin.py --ip 192.168.0.58 --plugin ./libjoint_hold.so
+"""
+import argparse
+import os
+import sys
+import time
+
+import elite_cs_sdk as cs
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run a native control plugin.")
+    parser.add_argument("--ip", required=True, help="IP address of the robot")
+    parser.add_argument("--local_ip", default="", help="Local IP address")
+    parser.add_argument("--plugin", required=True, help="Shared library of the plugin")
+    parser.add_argument("--cpu", type=int, default=-1, help="Core of the real-time thread")
+    parser.add_argument("--duration", type=float, default=10.0, help="Run time [s]")
+    args = parser.parse_args()
+
+    config = cs.EliteDriverConfig()
+    config.robot_ip = args.ip
+    config.local_ip = args.local_ip
+    config.headless_mode = True
+    config.script_file_path = os.path.join(os.path.dirname(cs.__file__), "external_control.script")
+    driver = cs.EliteDriver(config)
+    if not driver.isRobotConnected() and not driver.sendExternalControlScript():
+        print("Fail to send external control script", file=sys.stderr)
+        sys.exit(1)
+    while not driver.isRobotConnected():
+        time.sleep(0.01)
+
+    # Every field of EliteControlState
+    recipe = [
+        "timestamp",
+        "actual_joint_positions",
+        "actual_joint_speeds",
+        "actual_joint_torques",
+        "actual_TCP_pose",
+        "actual_TCP_speed",
+        "actual_TCP_force",
+        "target_joint_positions",
+        "target_joint_speeds",
+    ]
+    rtsi = cs.RtsiIOInterface(recipe, ["speed_slider_mask"], 250)
+    if not rtsi.connect(args.ip):
+        print("Fail to connect to RTSI", file=sys.stderr)
+        sys.exit(1)
+
+    plugin = cs.ControlPlugin(args.plugin, param_count=2)
+    plugin.setParameters([2.0, 0.2])
+    plugin.start(rtsi, driver, cpu=args.cpu)
+    print("Running", plugin.name())
+
+    end = time.monotonic() + args.duration
+    while time.monotonic() < end and plugin.isRunning():
+        time.sleep(0.5)
+        print(plugin.getStats(), "error", plugin.getTelemetry()[:6])
+        # Soften the law halfway: the next step sees the new gain
+        if time.monotonic() > end - args.duration / 2:
+            plugin.setParameter(0, 1.0)
+
+    plugin.stop()
+    driver.stopControl()
+    rtsi.disconnect()
+
+
+if __name__ == "__main__":
+    main()
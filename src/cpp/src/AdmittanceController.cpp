@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "AdmittanceController.hpp"
+#include "RotationUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+// Longest step integrated at once: a gap in the samples must not turn into a velocity jump
+constexpr double MAX_ADMITTANCE_DT = 0.1;
+
+}  // namespace
+
+AdmittanceController::AdmittanceController()
+    : runner_("admittance", &AdmittanceController::step, &state_, PARAM_COUNT) {
+    const double inf = std::numeric_limits<double>::infinity();
+    setMass({10.0, 10.0, 10.0, 1.0, 1.0, 1.0});
+    setDamping({100.0, 100.0, 100.0, 5.0, 5.0, 5.0});
+    setStiffness({0.0, 0.0, 0.0, 0.0, 0.0, 0.0});
+    setSelection({true, true, true, true, true, true});
+    setVelocityLimits({0.1, 0.1, 0.1, 0.5, 0.5, 0.5});
+    setDeadband({2.0, 2.0, 2.0, 0.2, 0.2, 0.2});
+    setWorkspace({-inf, -inf, -inf}, {inf, inf, inf});
+}
+
+void AdmittanceController::writeAxes(Param offset, const Axes& values) {
+    runner_.setParameters(values.data(), offset, values.size());
+}
+
+void AdmittanceController::setMass(const Axes& mass) {
+    for (double m : mass) {
+        if (!(m > 0.0)) {
+            throw std::invalid_argument("Virtual mass must be positive");
+        }
+    }
+    writeAxes(MASS, mass);
+}
+
+void AdmittanceController::setDamping(const Axes& damping) {
+    for (double d : damping) {
+        if (!(d >= 0.0)) {
+            throw std::invalid_argument("Damping must not be negative");
+        }
+    }
+    writeAxes(DAMPING, damping);
+}
+
+void AdmittanceController::setStiffness(const Axes& stiffness) { writeAxes(STIFFNESS, stiffness); }
+
+void AdmittanceController::setSelection(const std::array<bool, 6>& selection) {
+    Axes values;
+    for (size_t i = 0; i < 6; ++i) {
+        values[i] = selection[i] ? 1.0 : 0.0;
+    }
+    writeAxes(SELECTION, values);
+}
+
+void AdmittanceController::setVelocityLimits(const Axes& max_velocity) { writeAxes(MAX_VELOCITY, max_velocity); }
+
+void AdmittanceController::setDeadband(const Axes& deadband) { writeAxes(DEADBAND, deadband); }
+
+void AdmittanceController::setWorkspace(const Vector3& min, const Vector3& max) {
+    for (size_t i = 0; i < 3; ++i) {
+        if (min[i] > max[i]) {
+            throw std::invalid_argument("Workspace minimum is above its maximum");
+        }
+    }
+    double values[6] = {min[0], min[1], min[2], max[0], max[1], max[2]};
+    runner_.setParameters(values, WORKSPACE_MIN, 6);
+}
+
+void AdmittanceController::resetAnchor() {
+    const double request = static_cast<double>(++anchor_requests_);
+    runner_.setParameters(&request, ANCHOR_REQUEST, 1);
+}
+
+int AdmittanceController::step(void* context, const EliteControlState* state, const double* params,
+                               uint32_t param_count, EliteControlOutput* out) {
+    if (param_count < PARAM_COUNT) {
+        return -1;
+    }
+    State& s = *static_cast<State*>(context);
+    const double* pose = state->actual_tcp_pose;
+    double rotation[9];
+    rotvecToMatrix(pose + 3, rotation);
+
+    // A new run starts at rest, anchored where the robot is
+    if (state->cycle == 0 || params[ANCHOR_REQUEST] != s.anchor_request) {
+        if (state->cycle == 0) {
+            std::fill(s.velocity, s.velocity + 6, 0.0);
+        }
+        std::copy(pose, pose + 3, s.anchor_position);
+        std::copy(rotation, rotation + 9, s.anchor_rotation);
+        s.anchor_request = params[ANCHOR_REQUEST];
+    }
+
+    // Offset from the anchor: translation, then rotvec(R * R_anchor^T) in the base frame
+    double error[6];
+    for (int i = 0; i < 3; ++i) {
+        error[i] = pose[i] - s.anchor_position[i];
+    }
+    const double* A = s.anchor_rotation;
+    const double anchor_transposed[9] = {A[0], A[3], A[6], A[1], A[4], A[7], A[2], A[5], A[8]};
+    double relative[9];
+    matMul3(rotation, anchor_transposed, relative);
+    matrixToRotvec(relative, error + 3);
+
+    const double dt = std::min(std::max(state->dt, 0.0), MAX_ADMITTANCE_DT);
+    int limited = 0;
+    for (int i = 0; i < 6; ++i) {
+        const double measured = state->actual_tcp_force[i];
+        const double deadband = std::max(params[DEADBAND + i], 0.0);
+        const double force = std::copysign(std::max(std::fabs(measured) - deadband, 0.0), measured);
+        out->telemetry[TELEMETRY_FORCE + i] = force;
+
+        double& v = s.velocity[i];
+        const double mass = params[MASS + i];
+        if (params[SELECTION + i] == 0.0 || !(mass > 0.0)) {
+            v = 0.0;
+            continue;
+        }
+        // Damping is integrated implicitly, so a stiff damper (D * dt / M > 2) cannot make the velocity diverge. The
+        // new velocity drives the next position.
+        const double h = dt / mass;
+        v = (v + (force - params[STIFFNESS + i] * error[i]) * h) / (1.0 + std::max(params[DAMPING + i], 0.0) * h);
+
+        if (i < 3 && dt > 0.0) {
+            const double next = pose[i] + v * dt;
+            const double low = params[WORKSPACE_MIN + i];
+            const double high = params[WORKSPACE_MAX + i];
+            if (next > high && v > 0.0) {
+                v = std::max((high - pose[i]) / dt, 0.0);
+                limited |= 1 << i;
+            } else if (next < low && v < 0.0) {
+                v = std::min((low - pose[i]) / dt, 0.0);
+                limited |= 1 << i;
+            }
+        }
+        const double max_velocity = std::max(params[MAX_VELOCITY + i], 0.0);
+        if (std::fabs(v) > max_velocity) {
+            // The clamped velocity is kept as the model state, so the model does not wind up against the limit
+            v = std::copysign(max_velocity, v);
+            limited |= 1 << i;
+        }
+    }
+
+    out->command = ELITE_CONTROL_SPEEDL;
+    std::copy(s.velocity, s.velocity + 6, out->values);
+    std::copy(s.velocity, s.velocity + 6, out->telemetry + TELEMETRY_VELOCITY);
+    out->telemetry[TELEMETRY_POSITION_ERROR] =
+        std::sqrt(error[0] * error[0] + error[1] * error[1] + error[2] * error[2]);
+    out->telemetry[TELEMETRY_ROTATION_ERROR] =
+        std::sqrt(error[3] * error[3] + error[4] * error[4] + error[5] * error[5]);
+    out->telemetry[TELEMETRY_LIMITED] = static_cast<double>(limited);
+    return 0;
+}
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include "ControlPluginRunner.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @brief Admittance (stiffness 0) or impedance controller run by a ControlPluginRunner.
+ *
+ * Every axis of the TCP follows the virtual model M * a + D * v + K * e = F, where F is the measured wrench minus a
+ * deadband and e the offset from an anchor pose. The resulting velocity is sent with writeSpeedl. Parameters go
+ * through the parameter block of the runner, so they are changed while the loop runs.
+ */
+class AdmittanceController {
+   public:
+    using Axes = std::array<double, 6>;
+    using Vector3 = std::array<double, 3>;
+
+    // Layout of the parameter block
+    enum Param : size_t {
+        MASS = 0,
+        DAMPING = 6,
+        STIFFNESS = 12,
+        SELECTION = 18,
+        MAX_VELOCITY = 24,
+        DEADBAND = 30,
+        WORKSPACE_MIN = 36,
+        WORKSPACE_MAX = 39,
+        ANCHOR_REQUEST = 42,
+        PARAM_COUNT = 43
+    };
+
+    // Layout of the telemetry
+    enum Telemetry : size_t {
+        TELEMETRY_VELOCITY = 0,       // Commanded TCP velocity
+        TELEMETRY_FORCE = 6,          // Wrench after the deadband
+        TELEMETRY_POSITION_ERROR = 12,  // Distance to the anchor [m]
+        TELEMETRY_ROTATION_ERROR = 13,  // Angle to the anchor [rad]
+        TELEMETRY_LIMITED = 14          // Bit i set when axis i was clamped by a limit
+    };
+
+    AdmittanceController();
+
+    /**
+     * @throws std::invalid_argument if a mass is not positive
+     */
+    void setMass(const Axes& mass);
+
+    /**
+     * @throws std::invalid_argument if a damping is negative
+     */
+    void setDamping(const Axes& damping);
+    void setStiffness(const Axes& stiffness);
+
+    /**
+     * @brief Axes driven by the model. Unselected axes are commanded a zero velocity.
+     */
+    void setSelection(const std::array<bool, 6>& selection);
+    void setVelocityLimits(const Axes& max_velocity);
+    void setDeadband(const Axes& deadband);
+
+    /**
+     * @brief Box of the TCP position in the base frame. The velocity toward a face is reduced so the TCP stops on it.
+     */
+    void setWorkspace(const Vector3& min, const Vector3& max);
+
+    /**
+     * @brief Take the current TCP pose as the rest pose of the springs, on the next cycle.
+     */
+    void resetAnchor();
+
+    ControlPluginRunner& runner() { return runner_; }
+    const ControlPluginRunner& runner() const { return runner_; }
+
+   private:
+    // Touched by the real-time thread only
+    struct State {
+        double velocity[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+        double anchor_position[3] = {0.0, 0.0, 0.0};
+        double anchor_rotation[9] = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+        double anchor_request = 0.0;
+    };
+
+    static int step(void* context, const EliteControlState* state, const double* params, uint32_t param_count,
+                    EliteControlOutput* out);
+
+    void writeAxes(Param offset, const Axes& values);
+
+    State state_;
+    std::atomic<uint64_t> anchor_requests_{0};
+    ControlPluginRunner runner_;
+};
@@ -0,0 +1,292 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "AsyncLogSink.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+using namespace ELITE;
+
+namespace {
+
+// Largest number of records handed to the consumer at once.
+constexpr size_t MAX_BATCH = 256;
+
+// Size of the text buffer used when writing to a file descriptor.
+constexpr size_t WRITE_BUFFER_SIZE = 16384;
+
+const char* levelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::ELI_DEBUG:
+            return "DEBUG";
+        case LogLevel::ELI_INFO:
+            return "INFO";
+        case LogLevel::ELI_WARN:
+            return "WARN";
+        case LogLevel::ELI_ERROR:
+            return "ERROR";
+        case LogLevel::ELI_FATAL:
+            return "FATAL";
+        default:
+            return "NONE";
+    }
+}
+
+size_t roundUpPowerOfTwo(size_t v) {
+    size_t p = 2;
+    while (p < v) {
+        p <<= 1;
+    }
+    return p;
+}
+
+// Copy at most `size - 1` characters, keeping the tail of `src` when it is too long.
+void copyTail(char* dst, size_t size, const char* src) {
+    if (src == nullptr) {
+        dst[0] = '\0';
+        return;
+    }
+    size_t len = std::strlen(src);
+    if (len >= size) {
+        src += len - (size - 1);
+        len = size - 1;
+    }
+    std::memcpy(dst, src, len);
+    dst[len] = '\0';
+}
+
+bool writeAll(int fd, const char* data, size_t size) {
+    while (size > 0) {
+#ifdef _WIN32
+        int n = _write(fd, data, static_cast<unsigned int>(size));
+#else
+        ssize_t n = ::write(fd, data, size);
+#endif
+        if (n <= 0) {
+            return false;
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+}  // namespace
+
+AsyncLogSink::AsyncLogSink(size_t capacity, int flush_interval_ms)
+    : mask_(roundUpPowerOfTwo(capacity) - 1),
+      batch_capacity_(std::min(MAX_BATCH, mask_ + 1)),
+      flush_interval_ms_(flush_interval_ms > 0 ? flush_interval_ms : 1),
+      fd_(2) {
+    cells_.reset(new Cell[mask_ + 1]);
+    for (size_t i = 0; i <= mask_; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    // One extra slot for the dropped messages report
+    batch_.reset(new LogRecord[batch_capacity_ + 1]);
+}
+
+AsyncLogSink::~AsyncLogSink() { stop(); }
+
+void AsyncLogSink::setBatchCallback(BatchCallback cb) {
+    std::shared_ptr<const BatchCallback> next;
+    if (cb) {
+        next = std::make_shared<const BatchCallback>(std::move(cb));
+    }
+    std::lock_guard<std::mutex> lock(config_mutex_);
+    callback_.swap(next);
+}
+
+void AsyncLogSink::setFileDescriptor(int fd) { fd_ = fd; }
+
+void AsyncLogSink::start() {
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    thread_ = std::thread(&AsyncLogSink::drainLoop, this);
+}
+
+void AsyncLogSink::stop() {
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        running_ = false;
+    }
+    wake_cv_.notify_all();
+    if (thread_.joinable()) {
+        // Called from the batch callback: the thread ends after the current batch
+        if (isDrainThread()) {
+            thread_.detach();
+        } else {
+            thread_.join();
+        }
+    }
+}
+
+bool AsyncLogSink::push(const char* file, int line, LogLevel level, const char* message) {
+    size_t pos = tail_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        const size_t seq = cell->sequence.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            pos = tail_.load(std::memory_order_relaxed);
+        }
+    }
+
+    LogRecord& r = cell->record;
+    r.timestamp = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+    r.line = line;
+    r.level = level;
+    copyTail(r.file, LogRecord::FILE_SIZE, file);
+    const size_t len = message ? std::min(std::strlen(message), LogRecord::MESSAGE_SIZE - 1) : 0;
+    std::memcpy(r.message, message ? message : "", len);
+    r.message[len] = '\0';
+    r.message_len = static_cast<uint32_t>(len);
+
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    accepted_.fetch_add(1, std::memory_order_relaxed);
+
+    // Wake the drain thread early when half of the ring has been written since the last wake-up
+    if (((pos + 1) & (mask_ >> 1)) == 0) {
+        wake_cv_.notify_one();
+    }
+    return true;
+}
+
+bool AsyncLogSink::flush(int timeout_ms) {
+    const uint64_t target = accepted_.load();
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    if (!running_) {
+        return delivered_ >= target;
+    }
+    wake_cv_.notify_one();
+    return delivered_cv_.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                                  [&] { return delivered_ >= target || !running_; }) &&
+           delivered_ >= target;
+}
+
+void AsyncLogSink::install() { registerLogHandler(std::make_unique<AsyncLogHandler>(shared_from_this())); }
+
+size_t AsyncLogSink::drainBatch() {
+    size_t count = 0;
+    while (count < batch_capacity_) {
+        Cell& cell = cells_[head_ & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != head_ + 1) {
+            break;
+        }
+        const LogRecord& src = cell.record;
+        LogRecord& dst = batch_[count++];
+        std::memcpy(&dst, &src, offsetof(LogRecord, message) + src.message_len + 1);
+        cell.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+        ++head_;
+    }
+    const size_t records = count;
+
+    const uint64_t drops = dropped_.load(std::memory_order_relaxed);
+    if (drops != reported_drops_) {
+        LogRecord& r = batch_[count++];
+        r.timestamp = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+        r.line = __LINE__;
+        r.level = LogLevel::ELI_WARN;
+        copyTail(r.file, LogRecord::FILE_SIZE, __FILE__);
+        const int n = std::snprintf(r.message, LogRecord::MESSAGE_SIZE, "Log ring buffer full, %llu messages dropped",
+                                    static_cast<unsigned long long>(drops - reported_drops_));
+        r.message_len = static_cast<uint32_t>(std::max(n, 0));
+        reported_drops_ = drops;
+    }
+
+    if (count > 0) {
+        deliver(batch_.get(), count);
+    }
+    if (records > 0) {
+        delivered_.fetch_add(records);
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        delivered_cv_.notify_all();
+    }
+    return records;
+}
+
+void AsyncLogSink::deliver(const LogRecord* records, size_t count) {
+    std::shared_ptr<const BatchCallback> cb;
+    {
+        std::lock_guard<std::mutex> lock(config_mutex_);
+        cb = callback_;
+    }
+    if (cb) {
+        (*cb)(records, count);
+        return;
+    }
+    const int fd = fd_;
+    if (fd >= 0) {
+        writeRecords(fd, records, count);
+    }
+}
+
+void AsyncLogSink::writeRecords(int fd, const LogRecord* records, size_t count) {
+    char buffer[WRITE_BUFFER_SIZE];
+    size_t used = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (WRITE_BUFFER_SIZE - used < LogRecord::FILE_SIZE + LogRecord::MESSAGE_SIZE + 64) {
+            writeAll(fd, buffer, used);
+            used = 0;
+        }
+        used += format(records[i], buffer + used, WRITE_BUFFER_SIZE - used - 1);
+        buffer[used++] = '\n';
+    }
+    writeAll(fd, buffer, used);
+}
+
+size_t AsyncLogSink::format(const LogRecord& record, char* out, size_t size) {
+    const auto seconds = static_cast<std::time_t>(record.timestamp);
+    const int millis = static_cast<int>((record.timestamp - static_cast<double>(seconds)) * 1000.0);
+    std::tm tm{};
+#ifdef _WIN32
+    localtime_s(&tm, &seconds);
+#else
+    localtime_r(&seconds, &tm);
+#endif
+    char time_text[32];
+    std::strftime(time_text, sizeof(time_text), "%Y-%m-%d %H:%M:%S", &tm);
+    const int n = std::snprintf(out, size, "[%s.%03d] [%s] %s:%d: %s", time_text, millis, levelName(record.level),
+                                record.file, record.line, record.message);
+    if (n < 0) {
+        return 0;
+    }
+    return std::min(static_cast<size_t>(n), size - 1);
+}
+
+void AsyncLogSink::drainLoop() {
+    while (running_) {
+        if (drainBatch() > 0) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        if (!running_) {
+            break;
+        }
+        wake_cv_.wait_for(lock, std::chrono::milliseconds(flush_interval_ms_));
+    }
+    while (drainBatch() > 0) {
+    }
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    delivered_cv_.notify_all();
+}
@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <Elite/Log.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief One preallocated log message in the ring buffer. File names and messages longer than the fixed buffers are
+ * truncated (the file name keeps its tail).
+ */
+struct LogRecord {
+    static constexpr size_t FILE_SIZE = 96;
+    static constexpr size_t MESSAGE_SIZE = 400;
+
+    double timestamp;  // System clock, seconds since the epoch (same clock as Python time.time())
+    int line;
+    ELITE::LogLevel level;
+    uint32_t message_len;
+    char file[FILE_SIZE];
+    char message[MESSAGE_SIZE];
+};
+
+/**
+ * @brief Asynchronous log sink: producers copy messages into a lock-free MPSC ring of preallocated records, a drain
+ * thread delivers them in batches.
+ *
+ * `push()` never blocks and never allocates, so SDK threads (RTSI receive, driver loops) are not slowed down by a
+ * slow consumer. When the ring is full the message is dropped and counted; the drain thread reports the number of
+ * dropped messages with a warning record.
+ */
+class AsyncLogSink : public std::enable_shared_from_this<AsyncLogSink> {
+   public:
+    // Receives a batch of records on the drain thread. The records are only valid during the call.
+    using BatchCallback = std::function<void(const LogRecord* records, size_t count)>;
+
+    /**
+     * @param capacity Number of records in the ring, rounded up to a power of two
+     * @param flush_interval_ms Maximum time a record waits in the ring before it is delivered
+     */
+    explicit AsyncLogSink(size_t capacity = 4096, int flush_interval_ms = 10);
+
+    /**
+     * @brief Stop the drain thread. Must not run on the drain thread (e.g. when the batch callback drops the last
+     * reference): the owner hands the destruction to another thread, see isDrainThread().
+     */
+    ~AsyncLogSink();
+
+    AsyncLogSink(const AsyncLogSink&) = delete;
+    AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+
+    /**
+     * @brief Set the batch consumer. When set, records are no longer written to the file descriptor.
+     */
+    void setBatchCallback(BatchCallback cb);
+
+    /**
+     * @brief Write formatted records to a file descriptor, used when no batch callback is set. Default is standard
+     * error, -1 discards the records.
+     */
+    void setFileDescriptor(int fd);
+
+    void start();
+
+    /**
+     * @brief Deliver the remaining records and stop the drain thread.
+     */
+    void stop();
+
+    bool isRunning() const { return running_; }
+
+    /**
+     * @brief Check whether the caller is the drain thread, where stop() cannot wait for the thread to end.
+     */
+    bool isDrainThread() const { return thread_.get_id() == std::this_thread::get_id(); }
+
+    /**
+     * @brief Copy a message into the ring. Lock-free, callable from any thread.
+     *
+     * @return false if the ring is full and the message was dropped
+     */
+    bool push(const char* file, int line, ELITE::LogLevel level, const char* message);
+
+    /**
+     * @brief Wait until every record pushed before the call is delivered.
+     *
+     * @return false on timeout, or if the drain thread is not running
+     */
+    bool flush(int timeout_ms);
+
+    /**
+     * @brief Install the sink as the SDK log handler. Messages from every SDK thread go through the ring.
+     */
+    void install();
+
+    size_t capacity() const { return mask_ + 1; }
+    uint64_t accepted() const { return accepted_; }
+    uint64_t delivered() const { return delivered_; }
+    uint64_t dropped() const { return dropped_; }
+
+    /**
+     * @brief Format a record as one text line, without the trailing newline.
+     *
+     * @return Number of characters written to `out`
+     */
+    static size_t format(const LogRecord& record, char* out, size_t size);
+
+   private:
+    struct alignas(64) Cell {
+        std::atomic<size_t> sequence;
+        LogRecord record;
+    };
+
+    void drainLoop();
+    size_t drainBatch();
+    void deliver(const LogRecord* records, size_t count);
+    void writeRecords(int fd, const LogRecord* records, size_t count);
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_;
+    alignas(64) std::atomic<size_t> tail_{0};
+    alignas(64) size_t head_ = 0;
+
+    std::atomic<uint64_t> accepted_{0};
+    std::atomic<uint64_t> delivered_{0};
+    std::atomic<uint64_t> dropped_{0};
+    uint64_t reported_drops_ = 0;
+
+    std::unique_ptr<LogRecord[]> batch_;
+    size_t batch_capacity_;
+    int flush_interval_ms_;
+
+    std::mutex config_mutex_;
+    std::shared_ptr<const BatchCallback> callback_;
+    std::atomic<int> fd_;
+
+    std::mutex wait_mutex_;
+    std::condition_variable wake_cv_;
+    std::condition_variable delivered_cv_;
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+};
+
+/**
+ * @brief SDK log handler that forwards every message to an AsyncLogSink.
+ */
+class AsyncLogHandler : public ELITE::LogHandler {
+   public:
+    explicit AsyncLogHandler(std::shared_ptr<AsyncLogSink> sink) : sink_(std::move(sink)) {}
+
+    void log(const char* file, int line, ELITE::LogLevel loglevel, const char* log) override {
+        sink_->push(file, line, loglevel, log);
+    }
+
+   private:
+    std::shared_ptr<AsyncLogSink> sink_;
+};
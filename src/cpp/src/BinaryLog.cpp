@@ -0,0 +1,571 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "BinaryLog.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace ELITE;
+
+namespace {
+
+// File layout: header, then records of [type u8][payload size u32][payload]
+constexpr char FILE_MAGIC[4] = {'E', 'L', 'O', 'G'};
+constexpr uint32_t FILE_VERSION = 1;
+
+// FORMAT: id u32, level u8, line i32, file (u16 length + bytes), format (u16 length + bytes)
+constexpr uint8_t RECORD_FORMAT = 1;
+// EVENT: id u32, timestamp_ns i64, encoded arguments
+constexpr uint8_t RECORD_EVENT = 2;
+// DROPPED: count u64, timestamp_ns i64
+constexpr uint8_t RECORD_DROPPED = 3;
+
+constexpr size_t RECORD_HEADER_SIZE = 5;
+
+// Size of the write buffer, it is written to the file when it is full or when the ring is empty
+constexpr size_t WRITE_BUFFER_SIZE = 64 * 1024;
+
+// Format of the records stored with logText()
+constexpr char TEXT_FORMAT[] = "%s:%d: %s";
+
+int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+size_t roundUpPowerOfTwo(size_t v) {
+    size_t p = 2;
+    while (p < v) {
+        p <<= 1;
+    }
+    return p;
+}
+
+template <typename T>
+void putValue(std::vector<uint8_t>& out, T v) {
+    const auto* p = reinterpret_cast<const uint8_t*>(&v);
+    out.insert(out.end(), p, p + sizeof(T));
+}
+
+void putString(std::vector<uint8_t>& out, const std::string& s) {
+    const size_t len = std::min<size_t>(s.size(), UINT16_MAX);
+    putValue<uint16_t>(out, static_cast<uint16_t>(len));
+    out.insert(out.end(), s.begin(), s.begin() + len);
+}
+
+// Bounds-checked reader over a record payload.
+class Reader {
+   public:
+    Reader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+    template <typename T>
+    T value() {
+        T v;
+        need(sizeof(T));
+        std::memcpy(&v, data_ + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return v;
+    }
+
+    std::string string() {
+        const uint16_t len = value<uint16_t>();
+        need(len);
+        std::string s(reinterpret_cast<const char*>(data_ + pos_), len);
+        pos_ += len;
+        return s;
+    }
+
+    const uint8_t* rest() const { return data_ + pos_; }
+    size_t remaining() const { return size_ - pos_; }
+
+   private:
+    void need(size_t n) const {
+        if (size_ - pos_ < n) {
+            throw std::runtime_error("Truncated binary log record");
+        }
+    }
+
+    const uint8_t* data_;
+    size_t size_;
+    size_t pos_ = 0;
+};
+
+// One decoded argument.
+struct Arg {
+    uint8_t tag = 0;
+    int64_t i = 0;
+    double d = 0;
+    std::string s;
+};
+
+std::vector<Arg> readArgs(const uint8_t* data, size_t size) {
+    std::vector<Arg> args;
+    Reader r(data, size);
+    while (r.remaining() > 0) {
+        Arg a;
+        a.tag = r.value<uint8_t>();
+        if (a.tag == BinaryLogArgs::INT) {
+            a.i = r.value<int64_t>();
+        } else if (a.tag == BinaryLogArgs::DOUBLE) {
+            a.d = r.value<double>();
+        } else if (a.tag == BinaryLogArgs::STRING) {
+            a.s = r.string();
+        } else {
+            break;
+        }
+        args.push_back(std::move(a));
+    }
+    return args;
+}
+
+// Format one printf conversion, `spec` is the conversion without length modifier, e.g. "%-8.3" for "%-8.3lf"
+void formatArg(std::string& out, std::string spec, char conversion, const Arg* arg) {
+    if (arg == nullptr) {
+        out += "<missing>";
+        return;
+    }
+    char buf[512];
+    int n = 0;
+    switch (conversion) {
+        case 'd':
+        case 'i':
+            spec += "lld";
+            n = std::snprintf(buf, sizeof(buf), spec.c_str(),
+                              static_cast<long long>(arg->tag == BinaryLogArgs::DOUBLE ? arg->d : arg->i));
+            break;
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+            spec += "ll";
+            spec += conversion;
+            n = std::snprintf(buf, sizeof(buf), spec.c_str(),
+                              static_cast<unsigned long long>(arg->tag == BinaryLogArgs::DOUBLE ? arg->d : arg->i));
+            break;
+        case 'p':
+            n = std::snprintf(buf, sizeof(buf), "0x%llx", static_cast<unsigned long long>(arg->i));
+            break;
+        case 'c':
+            spec += 'c';
+            n = std::snprintf(buf, sizeof(buf), spec.c_str(), static_cast<int>(arg->i));
+            break;
+        case 's':
+            if (arg->tag != BinaryLogArgs::STRING) {
+                spec += arg->tag == BinaryLogArgs::DOUBLE ? "g" : "lld";
+                n = arg->tag == BinaryLogArgs::DOUBLE ? std::snprintf(buf, sizeof(buf), spec.c_str(), arg->d)
+                                                      : std::snprintf(buf, sizeof(buf), spec.c_str(),
+                                                                      static_cast<long long>(arg->i));
+                break;
+            }
+            spec += 's';
+            n = std::snprintf(buf, sizeof(buf), spec.c_str(), arg->s.c_str());
+            break;
+        default:  // f F e E g G a A
+            spec += conversion;
+            n = std::snprintf(buf, sizeof(buf), spec.c_str(),
+                              arg->tag == BinaryLogArgs::INT ? static_cast<double>(arg->i) : arg->d);
+            break;
+    }
+    if (n > 0) {
+        out.append(buf, std::min<size_t>(static_cast<size_t>(n), sizeof(buf) - 1));
+    }
+}
+
+}  // namespace
+
+BinaryLogWriter::BinaryLogWriter(const std::string& path, size_t max_file_bytes, int max_files, size_t capacity,
+                                 int flush_interval_ms)
+    : path_(path),
+      max_file_bytes_(max_file_bytes),
+      max_files_(std::max(max_files, 1)),
+      flush_interval_ms_(flush_interval_ms > 0 ? flush_interval_ms : 1),
+      mask_(roundUpPowerOfTwo(capacity) - 1) {
+    slots_.reset(new Slot[mask_ + 1]);
+    for (size_t i = 0; i <= mask_; ++i) {
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    const LogLevel levels[] = {LogLevel::ELI_DEBUG, LogLevel::ELI_INFO,  LogLevel::ELI_WARN,
+                               LogLevel::ELI_ERROR, LogLevel::ELI_FATAL, LogLevel::ELI_NONE};
+    for (int i = 0; i < 6; ++i) {
+        text_formats_[i] = registerFormat(levels[i], "", 0, TEXT_FORMAT);
+    }
+    buffer_.reserve(WRITE_BUFFER_SIZE);
+}
+
+BinaryLogWriter::~BinaryLogWriter() { stop(); }
+
+uint32_t BinaryLogWriter::registerFormat(LogLevel level, const char* file, int line, const char* format) {
+    std::lock_guard<std::mutex> lock(format_mutex_);
+    const uint32_t id = format_count_.load(std::memory_order_relaxed);
+    if (id >= MAX_FORMATS) {
+        throw std::runtime_error("Too many binary log formats");
+    }
+    formats_.push_back(Format{level, file ? file : "", line, format ? format : ""});
+    format_levels_[id] = static_cast<int>(level);
+    format_count_.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+bool BinaryLogWriter::logText(const char* file, int line, LogLevel level, const char* message) {
+    const int index = static_cast<int>(level);
+    if (index < 0 || index >= 6) {
+        return false;
+    }
+    return log(text_formats_[index], file ? file : "", line, message ? message : "");
+}
+
+bool BinaryLogWriter::push(uint32_t id, const BinaryLogArgs& args) {
+    size_t pos = tail_.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;) {
+        slot = &slots_[pos & mask_];
+        const size_t seq = slot->sequence.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            pos = tail_.load(std::memory_order_relaxed);
+        }
+    }
+    slot->id = id;
+    slot->timestamp_ns = nowNs();
+    slot->size = static_cast<uint32_t>(args.size());
+    std::memcpy(slot->args, args.data(), args.size());
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    accepted_.fetch_add(1, std::memory_order_relaxed);
+
+    // Wake the writer thread early when half of the ring has been written since the last wake-up
+    if (((pos + 1) & (mask_ >> 1)) == 0) {
+        wake_cv_.notify_one();
+    }
+    return true;
+}
+
+void BinaryLogWriter::start() {
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    if (running_) {
+        return;
+    }
+    // A file left by an earlier run or an earlier start() is kept as the first rotated file
+    if (std::FILE* previous = std::fopen(path_.c_str(), "rb")) {
+        const bool empty = std::fgetc(previous) == EOF;
+        std::fclose(previous);
+        if (!empty) {
+            shiftFiles();
+        }
+    }
+    if (!openFile()) {
+        throw std::runtime_error("Cannot open binary log file " + path_);
+    }
+    running_ = true;
+    thread_ = std::thread(&BinaryLogWriter::writerLoop, this);
+}
+
+void BinaryLogWriter::stop() {
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        running_ = false;
+    }
+    wake_cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    if (file_) {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+bool BinaryLogWriter::flush(int timeout_ms) {
+    const uint64_t target = accepted_.load();
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    if (!running_) {
+        return written_ >= target;
+    }
+    wake_cv_.notify_one();
+    return written_cv_.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                                [&] { return written_ >= target || !running_; }) &&
+           written_ >= target;
+}
+
+void BinaryLogWriter::install() { registerLogHandler(std::make_unique<BinaryLogHandler>(shared_from_this())); }
+
+bool BinaryLogWriter::openFile() {
+    if (file_) {
+        std::fclose(file_);
+    }
+    file_ = std::fopen(path_.c_str(), "wb");
+    if (file_ == nullptr) {
+        return false;
+    }
+    std::fwrite(FILE_MAGIC, 1, sizeof(FILE_MAGIC), file_);
+    std::fwrite(&FILE_VERSION, 1, sizeof(FILE_VERSION), file_);
+    file_bytes_ = sizeof(FILE_MAGIC) + sizeof(FILE_VERSION);
+    format_written_.assign(MAX_FORMATS, false);
+    return true;
+}
+
+void BinaryLogWriter::shiftFiles() {
+    for (int i = max_files_ - 1; i > 0; --i) {
+        const std::string from = i == 1 ? path_ : path_ + "." + std::to_string(i - 1);
+        const std::string to = path_ + "." + std::to_string(i);
+        std::remove(to.c_str());
+        std::rename(from.c_str(), to.c_str());
+    }
+}
+
+void BinaryLogWriter::rotate() {
+    writeBuffer();
+    std::fclose(file_);
+    file_ = nullptr;
+    shiftFiles();
+    // Runs on the writer thread: on failure the records are lost until the writer loop opens the file again
+    openFile();
+}
+
+void BinaryLogWriter::writeBuffer() {
+    if (!buffer_.empty() && file_) {
+        std::fwrite(buffer_.data(), 1, buffer_.size(), file_);
+        file_bytes_ += buffer_.size();
+    }
+    buffer_.clear();
+}
+
+void BinaryLogWriter::appendRecord(uint8_t type, const std::vector<uint8_t>& payload) {
+    const uint32_t size = static_cast<uint32_t>(payload.size());
+    if (buffer_.size() + RECORD_HEADER_SIZE + size > WRITE_BUFFER_SIZE) {
+        writeBuffer();
+    }
+    buffer_.push_back(type);
+    putValue(buffer_, size);
+    buffer_.insert(buffer_.end(), payload.begin(), payload.end());
+}
+
+void BinaryLogWriter::buildFormatPayload(uint32_t id) {
+    Format format;
+    {
+        std::lock_guard<std::mutex> lock(format_mutex_);
+        format = formats_[id];
+    }
+    payload_.clear();
+    putValue<uint32_t>(payload_, id);
+    putValue<uint8_t>(payload_, static_cast<uint8_t>(format.level));
+    putValue<int32_t>(payload_, format.line);
+    putString(payload_, format.file);
+    putString(payload_, format.format);
+}
+
+void BinaryLogWriter::appendEvent(const Slot& slot) {
+    if (file_ == nullptr) {
+        lost_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    // Every file carries the definitions of the formats it uses, written before their first event
+    bool need_format = !format_written_[slot.id];
+    if (need_format) {
+        buildFormatPayload(slot.id);
+    }
+    const size_t event_bytes = RECORD_HEADER_SIZE + sizeof(uint32_t) + sizeof(int64_t) + slot.size;
+    const size_t bytes = event_bytes + (need_format ? RECORD_HEADER_SIZE + payload_.size() : 0);
+    const size_t used = file_bytes_ + buffer_.size();
+    if (used + bytes > max_file_bytes_ && used > sizeof(FILE_MAGIC) + sizeof(FILE_VERSION)) {
+        rotate();
+        if (file_ == nullptr) {
+            lost_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        if (!need_format) {
+            buildFormatPayload(slot.id);
+            need_format = true;
+        }
+    }
+    if (need_format) {
+        appendRecord(RECORD_FORMAT, payload_);
+        format_written_[slot.id] = true;
+    }
+
+    payload_.clear();
+    putValue<uint32_t>(payload_, slot.id);
+    putValue<int64_t>(payload_, slot.timestamp_ns);
+    payload_.insert(payload_.end(), slot.args, slot.args + slot.size);
+    appendRecord(RECORD_EVENT, payload_);
+}
+
+size_t BinaryLogWriter::drain() {
+    size_t count = 0;
+    for (;;) {
+        Slot& slot = slots_[head_ & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != head_ + 1) {
+            break;
+        }
+        appendEvent(slot);
+        slot.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+        ++head_;
+        ++count;
+    }
+
+    const uint64_t drops = dropped_.load(std::memory_order_relaxed);
+    if (drops != reported_drops_) {
+        payload_.clear();
+        putValue<uint64_t>(payload_, drops - reported_drops_);
+        putValue<int64_t>(payload_, nowNs());
+        appendRecord(RECORD_DROPPED, payload_);
+        reported_drops_ = drops;
+    }
+    return count;
+}
+
+void BinaryLogWriter::writerLoop() {
+    for (;;) {
+        // Read the flag before draining so that the records pushed before stop() are written
+        const bool running = running_;
+        if (file_ == nullptr) {
+            openFile();
+        }
+        const size_t count = drain();
+        writeBuffer();
+        if (file_) {
+            std::fflush(file_);
+        }
+
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        written_ += count;
+        written_cv_.notify_all();
+        if (!running) {
+            break;
+        }
+        if (count == 0 && running_) {
+            wake_cv_.wait_for(lock, std::chrono::milliseconds(flush_interval_ms_));
+        }
+    }
+}
+
+std::string BinaryLogWriter::render(const std::string& format, const uint8_t* args, size_t size) {
+    const std::vector<Arg> values = readArgs(args, size);
+    const size_t n = format.size();
+    std::string out;
+    size_t next = 0;
+    for (size_t i = 0; i < n; ++i) {
+        if (format[i] != '%') {
+            out += format[i];
+            continue;
+        }
+        if (i + 1 < n && format[i + 1] == '%') {
+            out += '%';
+            ++i;
+            continue;
+        }
+        // %[flags][width][.precision][length]conversion, the length modifier is replaced by the stored type
+        std::string spec = "%";
+        size_t j = i + 1;
+        while (j < n && std::strchr("-+ #0", format[j]) != nullptr) {
+            spec += format[j++];
+        }
+        while (j < n && std::isdigit(static_cast<unsigned char>(format[j]))) {
+            spec += format[j++];
+        }
+        if (j < n && format[j] == '.') {
+            spec += format[j++];
+            while (j < n && std::isdigit(static_cast<unsigned char>(format[j]))) {
+                spec += format[j++];
+            }
+        }
+        while (j < n && std::strchr("hlLqjzt", format[j]) != nullptr) {
+            ++j;
+        }
+        if (j >= n || std::strchr("diuxXocspfFeEgGaA", format[j]) == nullptr) {
+            // Unsupported conversion, copied verbatim
+            const size_t end = std::min(j + 1, n);
+            out.append(format, i, end - i);
+            i = end - 1;
+            continue;
+        }
+        formatArg(out, spec, format[j], next < values.size() ? &values[next] : nullptr);
+        ++next;
+        i = j;
+    }
+    return out;
+}
+
+std::vector<DecodedLogRecord> BinaryLogWriter::decode(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Cannot open binary log file " + path);
+    }
+    const std::vector<uint8_t> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    const size_t header = sizeof(FILE_MAGIC) + sizeof(FILE_VERSION);
+    uint32_t version = 0;
+    if (data.size() >= header) {
+        std::memcpy(&version, data.data() + sizeof(FILE_MAGIC), sizeof(version));
+    }
+    if (data.size() < header || std::memcmp(data.data(), FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 ||
+        version != FILE_VERSION) {
+        throw std::runtime_error("Not a binary log file: " + path);
+    }
+
+    std::unordered_map<uint32_t, Format> formats;
+    std::vector<DecodedLogRecord> records;
+    size_t pos = header;
+    // A truncated last record (writer killed while writing) is ignored
+    while (pos + RECORD_HEADER_SIZE <= data.size()) {
+        const uint8_t type = data[pos];
+        uint32_t size;
+        std::memcpy(&size, data.data() + pos + 1, sizeof(size));
+        if (pos + RECORD_HEADER_SIZE + size > data.size()) {
+            break;
+        }
+        Reader r(data.data() + pos + RECORD_HEADER_SIZE, size);
+        pos += RECORD_HEADER_SIZE + size;
+
+        if (type == RECORD_FORMAT) {
+            const uint32_t id = r.value<uint32_t>();
+            Format f;
+            f.level = static_cast<LogLevel>(r.value<uint8_t>());
+            f.line = r.value<int32_t>();
+            f.file = r.string();
+            f.format = r.string();
+            formats[id] = std::move(f);
+        } else if (type == RECORD_EVENT) {
+            const uint32_t id = r.value<uint32_t>();
+            DecodedLogRecord record;
+            record.timestamp = static_cast<double>(r.value<int64_t>()) * 1e-9;
+            auto it = formats.find(id);
+            if (it == formats.end()) {
+                record.level = LogLevel::ELI_WARN;
+                record.line = 0;
+                record.text = "<unknown format " + std::to_string(id) + ">";
+            } else if (it->second.file.empty() && it->second.format == TEXT_FORMAT) {
+                const std::vector<Arg> args = readArgs(r.rest(), r.remaining());
+                record.level = it->second.level;
+                record.file = args.size() > 0 ? args[0].s : "";
+                record.line = args.size() > 1 ? static_cast<int>(args[1].i) : 0;
+                record.text = args.size() > 2 ? args[2].s : "";
+            } else {
+                record.level = it->second.level;
+                record.file = it->second.file;
+                record.line = it->second.line;
+                record.text = render(it->second.format, r.rest(), r.remaining());
+            }
+            records.push_back(std::move(record));
+        } else if (type == RECORD_DROPPED) {
+            const uint64_t count = r.value<uint64_t>();
+            DecodedLogRecord record;
+            record.timestamp = static_cast<double>(r.value<int64_t>()) * 1e-9;
+            record.level = LogLevel::ELI_WARN;
+            record.line = 0;
+            record.text = "Log ring buffer full, " + std::to_string(count) + " records dropped";
+            records.push_back(std::move(record));
+        }
+    }
+    return records;
+}
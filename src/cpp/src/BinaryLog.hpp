@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <Elite/Log.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Raw arguments of one binary log record. Arguments are tagged so that the decoder does not depend on the
+ * format string: integers and pointers are stored as int64, floating point values as double, strings inline.
+ */
+class BinaryLogArgs {
+   public:
+    static constexpr size_t CAPACITY = 224;
+
+    enum Tag : uint8_t { INT = 1, DOUBLE = 2, STRING = 3 };
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type add(T v) {
+        addInt(static_cast<int64_t>(v));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type add(T v) {
+        addDouble(static_cast<double>(v));
+    }
+
+    void add(const char* s) { addString(s, s ? std::strlen(s) : 0); }
+    void add(const std::string& s) { addString(s.data(), s.size()); }
+
+    void addInt(int64_t v) { addScalar(INT, &v); }
+    void addDouble(double v) { addScalar(DOUBLE, &v); }
+
+    // Strings that do not fit are truncated, arguments that do not fit at all are dropped
+    void addString(const char* s, size_t len) {
+        if (size_ + 3 > CAPACITY) {
+            return;
+        }
+        len = len < CAPACITY - size_ - 3 ? len : CAPACITY - size_ - 3;
+        const uint16_t len16 = static_cast<uint16_t>(len);
+        data_[size_] = STRING;
+        std::memcpy(data_ + size_ + 1, &len16, 2);
+        std::memcpy(data_ + size_ + 3, s, len);
+        size_ += 3 + len;
+    }
+
+    const uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+
+   private:
+    void addScalar(Tag tag, const void* v) {
+        if (size_ + 9 > CAPACITY) {
+            return;
+        }
+        data_[size_] = tag;
+        std::memcpy(data_ + size_ + 1, v, 8);
+        size_ += 9;
+    }
+
+    uint8_t data_[CAPACITY];
+    size_t size_ = 0;
+};
+
+/**
+ * @brief One record read back from a binary log file.
+ */
+struct DecodedLogRecord {
+    double timestamp;  // System clock, seconds since the epoch
+    ELITE::LogLevel level;
+    std::string file;
+    int line;
+    std::string text;
+};
+
+/**
+ * @brief Structured binary logger with deferred formatting.
+ *
+ * Call sites register a printf-style format once and log only its ID and raw arguments. Logging is a level check,
+ * a copy of the arguments into a lock-free ring of fixed-size slots and a clock read; no string is formatted on the
+ * calling thread. A writer thread appends the records to a binary file in batches and rotates it by size
+ * (`path`, `path.1`, ... `path.<max_files - 1>`, oldest last); start() rotates a file left at `path` instead of
+ * truncating it. Each file repeats the definitions of the formats it uses, so it can be decoded on its own with
+ * decode(). Values are stored in host byte order.
+ */
+class BinaryLogWriter : public std::enable_shared_from_this<BinaryLogWriter> {
+   public:
+    static constexpr uint32_t MAX_FORMATS = 4096;
+
+    /**
+     * @param path Path of the current log file
+     * @param max_file_bytes File size that triggers a rotation
+     * @param max_files Number of files kept, including the current one
+     * @param capacity Number of records in the ring, rounded up to a power of two
+     * @param flush_interval_ms Maximum time between two writes to the file
+     */
+    BinaryLogWriter(const std::string& path, size_t max_file_bytes = 16 << 20, int max_files = 4,
+                    size_t capacity = 8192, int flush_interval_ms = 100);
+    ~BinaryLogWriter();
+
+    BinaryLogWriter(const BinaryLogWriter&) = delete;
+    BinaryLogWriter& operator=(const BinaryLogWriter&) = delete;
+
+    /**
+     * @brief Register a format. Thread safe, call it once per call site and keep the ID.
+     *
+     * @return Format ID
+     * @throws std::runtime_error if MAX_FORMATS formats are already registered
+     */
+    uint32_t registerFormat(ELITE::LogLevel level, const char* file, int line, const char* format);
+
+    /**
+     * @brief Records of formats below this level are discarded before any argument is copied. Default ELI_INFO.
+     */
+    void setLevel(ELITE::LogLevel level) { min_level_ = static_cast<int>(level); }
+    ELITE::LogLevel getLevel() const { return static_cast<ELITE::LogLevel>(min_level_.load()); }
+
+    bool isEnabled(uint32_t id) const {
+        return id < format_count_.load(std::memory_order_acquire) &&
+               format_levels_[id] >= min_level_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Log a record of a registered format. Lock-free, callable from any thread.
+     *
+     * @return false if the record was filtered out or dropped because the ring is full
+     */
+    template <typename... Args>
+    bool log(uint32_t id, const Args&... args) {
+        if (!isEnabled(id)) {
+            return false;
+        }
+        BinaryLogArgs encoded;
+        int expand[] = {0, (encoded.add(args), 0)...};
+        (void)expand;
+        return push(id, encoded);
+    }
+
+    /**
+     * @brief Log already encoded arguments. Same as log().
+     */
+    bool logArgs(uint32_t id, const BinaryLogArgs& args) { return isEnabled(id) && push(id, args); }
+
+    /**
+     * @brief Log a formatted message, as received from the SDK log handler. Stored as a "%s:%d: %s" record.
+     */
+    bool logText(const char* file, int line, ELITE::LogLevel level, const char* message);
+
+    /**
+     * @throws std::runtime_error if the log file cannot be opened
+     */
+    void start();
+
+    /**
+     * @brief Write the remaining records, close the file and stop the writer thread.
+     */
+    void stop();
+
+    bool isRunning() const { return running_; }
+
+    /**
+     * @brief Wait until every record logged before the call is written to the file.
+     *
+     * @return false on timeout, or if the writer thread is not running
+     */
+    bool flush(int timeout_ms);
+
+    /**
+     * @brief Install the writer as the SDK log handler. SDK messages are stored with logText().
+     */
+    void install();
+
+    uint64_t accepted() const { return accepted_; }
+    uint64_t written() const { return written_; }
+    uint64_t dropped() const { return dropped_; }
+    // Records discarded because a rotation could not open a new file
+    uint64_t lost() const { return lost_; }
+
+    /**
+     * @brief Read a binary log file back and format its records.
+     *
+     * @throws std::runtime_error if the file cannot be opened or is not a binary log
+     */
+    static std::vector<DecodedLogRecord> decode(const std::string& path);
+
+    /**
+     * @brief Format printf-style, taking the arguments from an encoded argument buffer.
+     */
+    static std::string render(const std::string& format, const uint8_t* args, size_t size);
+
+   private:
+    struct Format {
+        ELITE::LogLevel level;
+        std::string file;
+        int line;
+        std::string format;
+    };
+
+    struct alignas(64) Slot {
+        std::atomic<size_t> sequence;
+        uint32_t id;
+        uint32_t size;
+        int64_t timestamp_ns;
+        uint8_t args[BinaryLogArgs::CAPACITY];
+    };
+
+    bool push(uint32_t id, const BinaryLogArgs& args);
+    void writerLoop();
+    size_t drain();
+    void appendEvent(const Slot& slot);
+    void buildFormatPayload(uint32_t id);
+    void appendRecord(uint8_t type, const std::vector<uint8_t>& payload);
+    void writeBuffer();
+    bool openFile();
+    void shiftFiles();
+    void rotate();
+
+    std::string path_;
+    size_t max_file_bytes_;
+    int max_files_;
+    int flush_interval_ms_;
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_;
+    alignas(64) std::atomic<size_t> tail_{0};
+    alignas(64) size_t head_ = 0;
+
+    std::atomic<int> min_level_{static_cast<int>(ELITE::LogLevel::ELI_INFO)};
+    std::atomic<uint32_t> format_count_{0};
+    int format_levels_[MAX_FORMATS];
+    std::mutex format_mutex_;
+    std::vector<Format> formats_;
+    uint32_t text_formats_[6];
+
+    // Writer thread state
+    std::FILE* file_ = nullptr;
+    size_t file_bytes_ = 0;
+    std::vector<bool> format_written_;
+    std::vector<uint8_t> buffer_;
+    std::vector<uint8_t> payload_;
+
+    std::atomic<uint64_t> accepted_{0};
+    std::atomic<uint64_t> written_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> lost_{0};
+    uint64_t reported_drops_ = 0;
+
+    std::mutex wait_mutex_;
+    std::condition_variable wake_cv_;
+    std::condition_variable written_cv_;
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+};
+
+/**
+ * @brief SDK log handler that stores every message in a BinaryLogWriter.
+ */
+class BinaryLogHandler : public ELITE::LogHandler {
+   public:
+    explicit BinaryLogHandler(std::shared_ptr<BinaryLogWriter> writer) : writer_(std::move(writer)) {}
+
+    void log(const char* file, int line, ELITE::LogLevel loglevel, const char* log) override {
+        writer_->logText(file, line, loglevel, log);
+    }
+
+   private:
+    std::shared_ptr<BinaryLogWriter> writer_;
+};
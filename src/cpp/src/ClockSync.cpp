@@ -0,0 +1,244 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "ClockSync.hpp"
+#include "RtToolkit.hpp"
+#include "SamplingUtils.hpp"
+#include "SdkThreads.hpp"
+
+#include <Elite/RtsiIOInterface.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Delays above the fit kept for the jitter estimate
+constexpr size_t JITTER_SAMPLES = 512;
+
+double median(std::vector<double>& values) {
+    auto mid = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+    std::nth_element(values.begin(), mid, values.end());
+    return *mid;
+}
+
+}  // namespace
+
+ClockSync::ClockSync(const Options& options) : options_(options) {
+    if (options.scale <= 0 || options.bucket_s <= 0 || options.window_s <= options.bucket_s ||
+        options.min_points < 2 || options.max_jump_s <= 0) {
+        throw std::invalid_argument(
+            "scale, bucket_s and max_jump_s must be positive, window_s above bucket_s and min_points at least 2");
+    }
+}
+
+void ClockSync::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const uint64_t resets = state_.resets;
+    state_ = ClockSyncState();
+    state_.resets = resets;
+    started_ = false;
+}
+
+void ClockSync::restart(double controller_s, double host) {
+    controller_ref_ = controller_s;
+    host_ref_ = host;
+    intercept_ = 0.0;
+    slope_ = 1.0;
+    bucket_open_ = false;
+    points_.clear();
+    delays_.clear();
+    state_.valid = false;
+    state_.samples = 0;
+    state_.points = 0;
+    started_ = true;
+}
+
+void ClockSync::addSample(double controller_time, double host_time) {
+    const double controller_s = controller_time * options_.scale;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!started_) {
+        restart(controller_s, host_time);
+    } else {
+        // A rebooted or adjusted controller clock starts a new estimate
+        const double dc = controller_s - state_.last_controller * options_.scale;
+        const double dh = host_time - state_.last_host;
+        if (dc < 0 || std::abs(dc - dh) > options_.max_jump_s) {
+            state_.resets++;
+            restart(controller_s, host_time);
+        }
+    }
+    const Point p{controller_s - controller_ref_, host_time - host_ref_};
+    state_.samples++;
+    state_.last_controller = controller_time;
+    state_.last_host = host_time;
+
+    if (bucket_open_ && host_time - bucket_start_ >= options_.bucket_s) {
+        closeBucket();
+    }
+    if (!bucket_open_) {
+        bucket_open_ = true;
+        bucket_start_ = host_time;
+        bucket_min_ = p;
+    } else if (p.y - p.x < bucket_min_.y - bucket_min_.x) {
+        bucket_min_ = p;
+    }
+
+    if (state_.valid) {
+        delays_.push_back(p.y - (intercept_ + slope_ * p.x));
+        if (delays_.size() > JITTER_SAMPLES) {
+            delays_.pop_front();
+        }
+        state_.offset = host_ref_ + intercept_ + slope_ * p.x - controller_s;
+    }
+}
+
+void ClockSync::closeBucket() {
+    points_.push_back(bucket_min_);
+    bucket_open_ = false;
+    while (!points_.empty() && points_.back().y - points_.front().y > options_.window_s) {
+        points_.pop_front();
+    }
+    fit();
+}
+
+void ClockSync::fit() {
+    const size_t n = points_.size();
+    state_.points = static_cast<int>(n);
+    if (n < static_cast<size_t>(options_.min_points)) {
+        return;
+    }
+    std::vector<double> values;
+    values.reserve(n * (n - 1) / 2);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = i + 1; j < n; ++j) {
+            const double dx = points_[j].x - points_[i].x;
+            if (dx > 1e-9) {
+                values.push_back((points_[j].y - points_[i].y) / dx);
+            }
+        }
+    }
+    if (values.empty()) {
+        return;
+    }
+    const double slope = median(values);
+    values.clear();
+    for (const Point& p : points_) {
+        values.push_back(p.y - slope * p.x);
+    }
+    const double intercept = median(values);
+    for (double& value : values) {
+        value = std::abs(value - intercept);
+    }
+    slope_ = slope;
+    intercept_ = intercept;
+    state_.valid = true;
+    state_.drift_ppm = (slope - 1.0) * 1e6;
+    state_.residual_us = median(values) * 1e6;
+    if (!delays_.empty()) {
+        std::vector<double> delays(delays_.begin(), delays_.end());
+        state_.jitter_us = median(delays) * 1e6;
+    }
+    const double last_x = state_.last_controller * options_.scale - controller_ref_;
+    state_.offset = host_ref_ + intercept_ + slope_ * last_x - state_.last_controller * options_.scale;
+}
+
+ClockSyncState ClockSync::state() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return state_;
+}
+
+double ClockSync::toHost(double controller_time) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!state_.valid) {
+        throw std::runtime_error("Clock sync has not collected enough samples yet");
+    }
+    return host_ref_ + intercept_ + slope_ * (controller_time * options_.scale - controller_ref_);
+}
+
+double ClockSync::toController(double host_time) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!state_.valid) {
+        throw std::runtime_error("Clock sync has not collected enough samples yet");
+    }
+    return (controller_ref_ + (host_time - host_ref_ - intercept_) / slope_) / options_.scale;
+}
+
+RtsiClockSync::~RtsiClockSync() {
+    stop();
+    SdkThreadRegistry::instance().untrack(this);
+}
+
+bool RtsiClockSync::start(ELITE::RtsiIOInterface* rtsi, int poll_us, int cpu, int priority) {
+    if (running_) {
+        return false;
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    running_ = true;
+    thread_ = std::thread(&RtsiClockSync::loop, this, rtsi, std::max(poll_us, 1), cpu, priority);
+    return true;
+}
+
+void RtsiClockSync::stop() {
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        running_ = false;
+    }
+    wait_cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void RtsiClockSync::lastSample(double& controller_time, double& host_time) const {
+    std::lock_guard<std::mutex> lock(last_mutex_);
+    controller_time = last_controller_;
+    host_time = last_host_;
+}
+
+void RtsiClockSync::loop(ELITE::RtsiIOInterface* rtsi, int poll_us, int cpu, int priority) {
+    if (cpu >= 0) {
+        setThreadAffinity(0, {cpu});
+    }
+#if defined(__linux__)
+    if (priority > 0) {
+        setThreadScheduling(0, SCHED_FIFO, priority);
+    }
+    setThreadName(0, "elite_clksync");
+    SdkThreadRegistry::instance().track(this, "ClockSync", {static_cast<int>(::syscall(SYS_gettid))});
+#else
+    (void)priority;
+#endif
+    // The sample present at start arrived at an unknown time
+    double previous = rtsi->getTimestamp();
+    const auto period = std::chrono::microseconds(poll_us);
+    auto next = std::chrono::steady_clock::now();
+    while (running_) {
+        const double timestamp = rtsi->getTimestamp();
+        if (timestamp != previous) {
+            const double host = steadyNow();
+            previous = timestamp;
+            sync_.addSample(timestamp, host);
+            std::lock_guard<std::mutex> lock(last_mutex_);
+            last_controller_ = timestamp;
+            last_host_ = host;
+        }
+        next += period;
+        const auto now = std::chrono::steady_clock::now();
+        if (next < now) {
+            next = now;
+        }
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        wait_cv_.wait_until(lock, next, [this] { return !running_; });
+    }
+}
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace ELITE {
+class RtsiIOInterface;
+}
+
+/**
+ * @brief Current estimate of the relation between a controller clock and the host steady clock.
+ */
+struct ClockSyncState {
+    bool valid = false;         // Enough samples for the conversions
+    uint64_t samples = 0;       // Samples since the last reset
+    uint64_t resets = 0;        // Controller clock jumps that restarted the estimate
+    int points = 0;             // Lower-envelope points of the fit
+    double offset = 0.0;        // Host time minus controller time at the last sample [s]
+    double drift_ppm = 0.0;     // Rate of the host clock relative to the controller clock, minus 1, in ppm
+    double residual_us = 0.0;   // Median distance of the envelope points to the fit
+    double jitter_us = 0.0;     // Median delay of the samples above the envelope (arrival and polling jitter)
+    double last_controller = 0.0;
+    double last_host = 0.0;
+};
+
+/**
+ * @brief Estimate the offset and the drift between a controller clock and the host steady clock (CLOCK_MONOTONIC on
+ * Linux, the clock of Python time.monotonic()) from the host arrival times of controller-stamped messages.
+ *
+ * An arrival time is the send time plus a transport delay that is never negative but has a long tail. The samples are
+ * grouped in buckets of `bucket_s` and only the earliest arrival of each bucket is kept: these points follow the
+ * lower envelope of the delays. A Theil-Sen line (median of the pairwise slopes) through the points of the last
+ * `window_s` gives the drift and the offset, and ignores the buckets without a fast sample. The offset includes the
+ * smallest one-way delay, which cannot be told apart from the clock offset without a two-way exchange.
+ */
+class ClockSync {
+   public:
+    struct Options {
+        double scale = 1.0;       // Controller time unit in seconds, e.g. 0.001 for milliseconds
+        double bucket_s = 0.5;    // Length of a bucket of samples, in host time
+        double window_s = 60.0;   // Length of the fitted history, in host time
+        int min_points = 4;       // Buckets needed before the estimate is valid
+        double max_jump_s = 1.0;  // Disagreement of the two clocks that restarts the estimate
+    };
+
+    explicit ClockSync(const Options& options);
+    ClockSync() : ClockSync(Options()) {}
+
+    /**
+     * @param controller_time Timestamp of a message, in controller units
+     * @param host_time Host steady clock time of its arrival [s]
+     */
+    void addSample(double controller_time, double host_time);
+
+    void reset();
+
+    ClockSyncState state() const;
+
+    /**
+     * @brief Host steady clock time [s] of a controller timestamp.
+     *
+     * @throws std::runtime_error if the estimate is not valid yet
+     */
+    double toHost(double controller_time) const;
+
+    /**
+     * @brief Controller timestamp, in controller units, of a host steady clock time [s].
+     *
+     * @throws std::runtime_error if the estimate is not valid yet
+     */
+    double toController(double host_time) const;
+
+    const Options& options() const { return options_; }
+
+   private:
+    struct Point {
+        double x = 0.0;  // Controller time [s] from the reference
+        double y = 0.0;  // Host time [s] from the reference
+    };
+
+    void restart(double controller_s, double host);
+    void closeBucket();
+    void fit();
+
+    Options options_;
+    mutable std::mutex mutex_;
+    ClockSyncState state_;
+    bool started_ = false;
+    double controller_ref_ = 0.0;
+    double host_ref_ = 0.0;
+    double intercept_ = 0.0;
+    double slope_ = 1.0;
+    bool bucket_open_ = false;
+    double bucket_start_ = 0.0;
+    Point bucket_min_;
+    std::deque<Point> points_;
+    std::deque<double> delays_;  // Recent delays above the fit, for the jitter
+};
+
+/**
+ * @brief Feed a ClockSync with the RTSI samples: a background thread polls the RTSI timestamp and stamps every new
+ * sample with the host time at which it is first seen.
+ *
+ * The receive thread of the SDK gives no per-sample notification, so the arrival time includes up to `poll_us` of
+ * polling delay. The lower envelope keeps the samples seen right after their arrival.
+ */
+class RtsiClockSync {
+   public:
+    explicit RtsiClockSync(const ClockSync::Options& options = ClockSync::Options()) : sync_(options) {}
+    ~RtsiClockSync();
+
+    RtsiClockSync(const RtsiClockSync&) = delete;
+    RtsiClockSync& operator=(const RtsiClockSync&) = delete;
+
+    /**
+     * @brief Start polling. The interface must stay valid until stop().
+     *
+     * @param cpu Core of the thread, < 0 for no pinning
+     * @param priority SCHED_FIFO priority, <= 0 keeps the default policy
+     * @return false if already running
+     */
+    bool start(ELITE::RtsiIOInterface* rtsi, int poll_us, int cpu, int priority);
+
+    void stop();
+
+    bool isRunning() const { return running_; }
+
+    ClockSync& sync() { return sync_; }
+    const ClockSync& sync() const { return sync_; }
+
+    /**
+     * @brief Controller timestamp of the last sample and its host arrival time.
+     */
+    void lastSample(double& controller_time, double& host_time) const;
+
+   private:
+    void loop(ELITE::RtsiIOInterface* rtsi, int poll_us, int cpu, int priority);
+
+    ClockSync sync_;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+    mutable std::mutex last_mutex_;
+    double last_controller_ = 0.0;
+    double last_host_ = 0.0;
+};
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "ClockSyncWrapper.hpp"
+#include "ClockSync.hpp"
+#include "SamplingUtils.hpp"
+
+#include <Elite/RtsiIOInterface.hpp>
+
+#include <pybind11/stl.h>
+
+#include <utility>
+
+namespace py = pybind11;
+using namespace ELITE;
+
+static ClockSync::Options syncOptions(double scale, double bucket_s, double window_s, int min_points,
+                                      double max_jump_s) {
+    ClockSync::Options options;
+    options.scale = scale;
+    options.bucket_s = bucket_s;
+    options.window_s = window_s;
+    options.min_points = min_points;
+    options.max_jump_s = max_jump_s;
+    return options;
+}
+
+static const char* OPTIONS_DOC = R"doc(
+                Args:
+                    scale (float): Controller time unit in seconds, e.g. 0.001 for milliseconds
+                    bucket_s (float): Samples are grouped in buckets of this length; only the earliest arrival of a
+                        bucket is fitted
+                    window_s (float): Length of the fitted history
+                    min_points (int): Buckets needed before the conversions are available
+                    max_jump_s (float): Disagreement of the two clocks that restarts the estimate, e.g. after a
+                        controller reboot
+
+                Raises:
+                    ValueError: An option is out of range
+            )doc";
+
+void bindClockSync(py::module_& m) {
+    using State = ClockSyncState;
+    py::class_<State>(m, "ClockSyncState")
+        .def_readonly("valid", &State::valid, "Enough samples for the conversions.")
+        .def_readonly("samples", &State::samples, "Samples since the last reset.")
+        .def_readonly("resets", &State::resets, "Controller clock jumps that restarted the estimate.")
+        .def_readonly("points", &State::points, "Lower-envelope points of the fit.")
+        .def_readonly("offset", &State::offset, "Host time minus controller time at the last sample [s].")
+        .def_readonly("drift_ppm", &State::drift_ppm, "Rate of the host clock relative to the controller, minus 1.")
+        .def_readonly("residual_us", &State::residual_us, "Median distance of the envelope points to the fit.")
+        .def_readonly("jitter_us", &State::jitter_us, "Median delay of the samples above the envelope.")
+        .def_readonly("last_controller", &State::last_controller, "Controller timestamp of the last sample.")
+        .def_readonly("last_host", &State::last_host, "Host arrival time of the last sample [s].")
+        .def("__repr__", [](const State& s) {
+            return py::str("<ClockSyncState valid={} offset={:.6f}s drift={:.2f}ppm residual={:.1f}us "
+                           "jitter={:.1f}us>")
+                .format(s.valid, s.offset, s.drift_ppm, s.residual_us, s.jitter_us);
+        });
+
+    py::class_<ClockSync>(m, "ClockSync",
+                          "Offset and drift between a controller clock and the host steady clock (time.monotonic()), "
+                          "from the host arrival times of controller-stamped messages.")
+        .def(py::init([](double scale, double bucket_s, double window_s, int min_points, double max_jump_s) {
+                 return new ClockSync(syncOptions(scale, bucket_s, window_s, min_points, max_jump_s));
+             }),
+             py::arg("scale") = 1.0, py::arg("bucket_s") = 0.5, py::arg("window_s") = 60.0,
+             py::arg("min_points") = 4, py::arg("max_jump_s") = 1.0, OPTIONS_DOC)
+        .def(
+            "addSample",
+            [](ClockSync& self, double controller_time, py::object host_time) {
+                self.addSample(controller_time, host_time.is_none() ? steadyNow() : host_time.cast<double>());
+            },
+            py::arg("controller_time"), py::arg("host_time") = py::none(),
+            R"doc(
+                Add the timestamp of a message and its arrival time, e.g. RobotException.getTimestamp() in the
+                exception callback.
+
+                Args:
+                    controller_time (float): Timestamp of the message, in controller units
+                    host_time (float): time.monotonic() at its arrival, now when None
+            )doc")
+        .def("reset", &ClockSync::reset, "Forget the samples.")
+        .def("getState", &ClockSync::state)
+        .def("toHost", &ClockSync::toHost, py::arg("controller_time"),
+             R"doc(
+                Host time of a controller timestamp, on the clock of time.monotonic().
+
+                Raises:
+                    RuntimeError: Not enough samples yet
+            )doc")
+        .def("toController", &ClockSync::toController, py::arg("host_time"),
+             R"doc(
+                Controller timestamp of a time.monotonic() time.
+
+                Raises:
+                    RuntimeError: Not enough samples yet
+            )doc");
+
+    py::class_<RtsiClockSync>(m, "RtsiClockSync",
+                              "Clock synchronization with the RTSI timestamp: a background thread stamps every new "
+                              "RTSI sample with its host arrival time.")
+        .def(py::init([](double bucket_s, double window_s, int min_points, double max_jump_s) {
+                 return new RtsiClockSync(syncOptions(1.0, bucket_s, window_s, min_points, max_jump_s));
+             }),
+             py::arg("bucket_s") = 0.5, py::arg("window_s") = 60.0, py::arg("min_points") = 4,
+             py::arg("max_jump_s") = 1.0, "Same options as ClockSync, the RTSI timestamp is in seconds.")
+        .def(
+            "start",
+            [](RtsiClockSync& self, RtsiIOInterface& rtsi, int poll_us, int cpu, int priority) {
+                return self.start(&rtsi, poll_us, cpu, priority);
+            },
+            py::arg("rtsi"), py::arg("poll_us") = 100, py::arg("cpu") = -1, py::arg("priority") = 0,
+            py::keep_alive<1, 2>(),
+            R"doc(
+                Start polling the timestamp of a connected RTSI interface. A sample is stamped when the thread first
+                sees it, up to poll_us after its arrival.
+
+                Args:
+                    rtsi (RtsiIOInterface): Connected RTSI interface
+                    poll_us (int): Polling period
+                    cpu (int): Core of the thread, < 0 for no pinning
+                    priority (int): SCHED_FIFO priority, <= 0 keeps the default policy
+
+                Returns:
+                    bool: False if already running
+            )doc")
+        .def("stop", &RtsiClockSync::stop, py::call_guard<py::gil_scoped_release>(),
+             "Stop the thread and wait for it.")
+        .def("isRunning", &RtsiClockSync::isRunning)
+        .def("getState", [](const RtsiClockSync& self) { return self.sync().state(); })
+        .def(
+            "toHost", [](const RtsiClockSync& self, double timestamp) { return self.sync().toHost(timestamp); },
+            py::arg("timestamp"),
+            R"doc(
+                Host time (time.monotonic()) of an RTSI timestamp, e.g. rtsi.getTimestamp().
+
+                Raises:
+                    RuntimeError: Not enough samples yet
+            )doc")
+        .def(
+            "toController",
+            [](const RtsiClockSync& self, double host_time) { return self.sync().toController(host_time); },
+            py::arg("host_time"), "RTSI timestamp of a time.monotonic() time.")
+        .def(
+            "getLastSample",
+            [](const RtsiClockSync& self) {
+                double controller_time = 0.0;
+                double host_time = 0.0;
+                self.lastSample(controller_time, host_time);
+                return std::make_pair(controller_time, host_time);
+            },
+            "Timestamp of the last RTSI sample and the time.monotonic() time it was seen.");
+}
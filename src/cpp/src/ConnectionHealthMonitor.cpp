@@ -0,0 +1,371 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "ConnectionHealthMonitor.hpp"
+#include "RtToolkit.hpp"
+#include "SamplingUtils.hpp"
+#include "SdkThreads.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <linux/tcp.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Value of tcpi_state for an established connection
+constexpr uint8_t TCP_STATE_ESTABLISHED = 1;
+
+// Period of the descriptor scan while no connection is found
+constexpr double RESCAN_INTERVAL_S = 0.01;
+
+#if defined(__linux__)
+
+// Local port and peer of a socket, false if it is not a connected TCP socket
+bool socketEndpoints(int fd, int& local_port, sockaddr_storage& peer) {
+    sockaddr_storage local{};
+    socklen_t len = sizeof(local);
+    if (::getsockname(fd, reinterpret_cast<sockaddr*>(&local), &len) != 0) {
+        return false;
+    }
+    if (local.ss_family == AF_INET) {
+        local_port = ntohs(reinterpret_cast<sockaddr_in*>(&local)->sin_port);
+    } else if (local.ss_family == AF_INET6) {
+        local_port = ntohs(reinterpret_cast<sockaddr_in6*>(&local)->sin6_port);
+    } else {
+        return false;
+    }
+    int type = 0;
+    len = sizeof(type);
+    if (::getsockopt(fd, SOL_SOCKET, SO_TYPE, &type, &len) != 0 || type != SOCK_STREAM) {
+        return false;
+    }
+    // The listening socket has the same local port but no peer
+    len = sizeof(peer);
+    return ::getpeername(fd, reinterpret_cast<sockaddr*>(&peer), &len) == 0;
+}
+
+bool samePeer(const sockaddr_storage& a, const sockaddr_storage& b) {
+    if (a.ss_family != b.ss_family) {
+        return false;
+    }
+    const size_t size = a.ss_family == AF_INET ? sizeof(sockaddr_in) : sizeof(sockaddr_in6);
+    return std::memcmp(&a, &b, size) == 0;
+}
+
+bool readTcpInfo(int fd, tcp_info& info, socklen_t& len) {
+    std::memset(&info, 0, sizeof(info));
+    len = sizeof(info);
+    return ::getsockopt(fd, IPPROTO_TCP, TCP_INFO, &info, &len) == 0;
+}
+
+/**
+ * @brief The established connection of a local port among the descriptors of the process, -1 if there is none.
+ */
+int findConnection(int port, sockaddr_storage& peer) {
+    DIR* dir = ::opendir("/proc/self/fd");
+    if (dir == nullptr) {
+        return -1;
+    }
+    int found = -1;
+    while (dirent* entry = ::readdir(dir)) {
+        char* end = nullptr;
+        const long fd = std::strtol(entry->d_name, &end, 10);
+        if (end == entry->d_name || *end != '\0' || fd == ::dirfd(dir)) {
+            continue;
+        }
+        struct stat st{};
+        int local_port = 0;
+        sockaddr_storage candidate{};
+        if (::fstat(static_cast<int>(fd), &st) != 0 || !S_ISSOCK(st.st_mode) ||
+            !socketEndpoints(static_cast<int>(fd), local_port, candidate) || local_port != port) {
+            continue;
+        }
+        // A previous connection may linger in CLOSE_WAIT until the SDK closes it
+        tcp_info info;
+        socklen_t len = 0;
+        if (readTcpInfo(static_cast<int>(fd), info, len) && info.tcpi_state == TCP_STATE_ESTABLISHED) {
+            found = static_cast<int>(fd);
+            peer = candidate;
+            break;
+        }
+    }
+    ::closedir(dir);
+    return found;
+}
+
+#endif
+
+}  // namespace
+
+struct ConnectionHealthMonitor::TcpSample {
+    double srtt_us = 0.0;
+    double rttvar_us = 0.0;
+    uint64_t segs_in = 0;
+    uint64_t segs_out = 0;
+    bool has_segs = false;  // Kernels before 4.2 do not report the segment counters
+    uint64_t total_retrans = 0;
+    double last_data_sent_ms = 0.0;
+    double last_ack_recv_ms = 0.0;
+    uint32_t unacked = 0;
+};
+
+ConnectionHealthMonitor::~ConnectionHealthMonitor() {
+    stop();
+    SdkThreadRegistry::instance().untrack(this);
+}
+
+bool ConnectionHealthMonitor::start(int port, const Options& options) {
+    if (port <= 0 || port > 65535) {
+        throw std::invalid_argument("port must be in [1, 65535]");
+    }
+    if (options.poll_us <= 0 || options.read_timeout_ms <= 0 || options.warn_fraction <= 0 ||
+        options.warn_fraction > 1 || options.window <= 0) {
+        throw std::invalid_argument("poll_us, read_timeout_ms and window must be positive, warn_fraction in (0, 1]");
+    }
+#if defined(__linux__)
+    if (running_) {
+        return false;
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    port_ = port;
+    options_ = options;
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        stats_ = ConnectionHealthStats();
+        window_.assign(static_cast<size_t>(options.window), 0.0);
+        window_next_ = 0;
+        window_full_ = false;
+        last_retransmit_ = -1e9;
+        last_issue_ = -1e9;
+    }
+    running_ = true;
+    thread_ = std::thread(&ConnectionHealthMonitor::loop, this);
+    return true;
+#else
+    (void)options;
+    return false;
+#endif
+}
+
+void ConnectionHealthMonitor::stop() {
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        running_ = false;
+    }
+    wait_cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void ConnectionHealthMonitor::setEventCallback(EventCallback cb) {
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    event_cb_ = std::move(cb);
+}
+
+ConnectionHealthStats ConnectionHealthMonitor::stats() const {
+    std::vector<double> samples = rttSamples();
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    ConnectionHealthStats stats = stats_;
+    if (!samples.empty()) {
+        std::sort(samples.begin(), samples.end());
+        stats.rtt_min_ms = samples.front();
+        stats.rtt_p50_ms = percentile(samples, 0.5);
+        stats.rtt_p90_ms = percentile(samples, 0.9);
+        stats.rtt_p99_ms = percentile(samples, 0.99);
+        stats.rtt_max_ms = samples.back();
+    }
+    return stats;
+}
+
+std::vector<double> ConnectionHealthMonitor::rttSamples() const {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    if (!window_full_) {
+        return std::vector<double>(window_.begin(), window_.begin() + static_cast<std::ptrdiff_t>(window_next_));
+    }
+    std::vector<double> samples(window_.begin() + static_cast<std::ptrdiff_t>(window_next_), window_.end());
+    samples.insert(samples.end(), window_.begin(), window_.begin() + static_cast<std::ptrdiff_t>(window_next_));
+    return samples;
+}
+
+void ConnectionHealthMonitor::loop() {
+#if defined(__linux__)
+    setThreadName(0, "elite_health");
+    SdkThreadRegistry::instance().track(this, "ConnectionHealth", {static_cast<int>(::syscall(SYS_gettid))});
+
+    const auto period = std::chrono::microseconds(options_.poll_us);
+    auto next = std::chrono::steady_clock::now();
+    int fd = -1;
+    sockaddr_storage peer{};
+    double last_scan = -1e9;
+    while (running_) {
+        const double now = steadyNow();
+        // The descriptor belongs to the SDK: it is checked every cycle in case it was closed and its number reused
+        int local_port = 0;
+        sockaddr_storage current{};
+        if (fd >= 0 && (!socketEndpoints(fd, local_port, current) || local_port != port_ || !samePeer(peer, current))) {
+            fd = -1;
+        }
+        tcp_info info;
+        socklen_t len = 0;
+        bool established = false;
+        if (fd < 0 && now - last_scan >= RESCAN_INTERVAL_S) {
+            last_scan = now;
+            fd = findConnection(port_, peer);
+            if (fd >= 0 && readTcpInfo(fd, info, len)) {
+                std::lock_guard<std::mutex> lock(stats_mutex_);
+                stats_.connections++;
+                last_segs_in_ = info.tcpi_segs_in;
+                last_segs_out_ = info.tcpi_segs_out;
+                last_retrans_ = info.tcpi_total_retrans;
+                last_srtt_us_ = -1.0;
+                last_send_ = now;
+                in_gap_ = false;
+            }
+        }
+        if (fd >= 0 && readTcpInfo(fd, info, len)) {
+            established = info.tcpi_state == TCP_STATE_ESTABLISHED;
+        }
+        if (established) {
+            TcpSample tcp;
+            tcp.srtt_us = info.tcpi_rtt;
+            tcp.rttvar_us = info.tcpi_rttvar;
+            tcp.has_segs = len >= offsetof(tcp_info, tcpi_segs_in) + sizeof(info.tcpi_segs_in);
+            tcp.segs_in = info.tcpi_segs_in;
+            tcp.segs_out = info.tcpi_segs_out;
+            tcp.total_retrans = info.tcpi_total_retrans;
+            tcp.last_data_sent_ms = info.tcpi_last_data_sent;
+            tcp.last_ack_recv_ms = info.tcpi_last_ack_recv;
+            tcp.unacked = info.tcpi_unacked;
+            sample(tcp, now);
+        } else {
+            fd = -1;
+            setState(ConnectionHealth::DISCONNECTED, 0, now);
+        }
+
+        next += period;
+        const auto wake = std::chrono::steady_clock::now();
+        if (next < wake) {
+            next = wake;  // Do not catch up on missed cycles
+        }
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        wait_cv_.wait_until(lock, next, [this] { return !running_; });
+    }
+#endif
+}
+
+void ConnectionHealthMonitor::sample(const TcpSample& tcp, double now) {
+    uint32_t issues = 0;
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        stats_.rtt_ms = tcp.srtt_us / 1000.0;
+        stats_.rttvar_ms = tcp.rttvar_us / 1000.0;
+        // One acknowledgement since the last poll moved srtt by 1/8 of its RTT sample, which can be undone. Several
+        // acknowledgements are mixed together and give no sample.
+        if (tcp.has_segs && last_srtt_us_ >= 0 && tcp.segs_in - last_segs_in_ == 1) {
+            const double rtt_ms = std::max(8.0 * tcp.srtt_us - 7.0 * last_srtt_us_, 0.0) / 1000.0;
+            stats_.rtt_samples++;
+            window_[window_next_] = rtt_ms;
+            window_next_ = (window_next_ + 1) % window_.size();
+            window_full_ = window_full_ || window_next_ == 0;
+        }
+        last_segs_in_ = tcp.segs_in;
+        last_srtt_us_ = tcp.srtt_us;
+        if (tcp.total_retrans > last_retrans_) {
+            stats_.retransmits += tcp.total_retrans - last_retrans_;
+            last_retransmit_ = now;
+        }
+        last_retrans_ = tcp.total_retrans;
+
+        // Segment counters time the commands at the sampling period, tcpi_last_data_sent only at the kernel tick
+        if (tcp.has_segs) {
+            if (tcp.segs_out != last_segs_out_) {
+                last_segs_out_ = tcp.segs_out;
+                last_send_ = now;
+            }
+            stats_.send_gap_ms = (now - last_send_) * 1000.0;
+        } else {
+            stats_.send_gap_ms = tcp.last_data_sent_ms;
+        }
+        if (stats_.send_gap_ms >= options_.late_ms) {
+            if (!in_gap_) {
+                stats_.late_packets++;
+                in_gap_ = true;
+            }
+        } else {
+            in_gap_ = false;
+        }
+        stats_.unacked = tcp.unacked;
+
+        // The command sent now reaches the controller about half an RTT later
+        const double warn_ms = options_.warn_fraction * options_.read_timeout_ms;
+        if (stats_.rtt_ms > options_.rtt_limit_ms) {
+            issues |= static_cast<uint32_t>(ConnectionIssue::RTT_HIGH);
+        }
+        if ((now - last_retransmit_) * 1000.0 < options_.retransmit_hold_ms) {
+            issues |= static_cast<uint32_t>(ConnectionIssue::RETRANSMIT);
+        }
+        if (stats_.send_gap_ms + stats_.rtt_ms / 2 >= warn_ms) {
+            issues |= static_cast<uint32_t>(ConnectionIssue::SEND_GAP);
+        }
+        if (tcp.unacked > 0 && tcp.last_ack_recv_ms >= warn_ms) {
+            issues |= static_cast<uint32_t>(ConnectionIssue::ACK_STALL);
+        }
+        stats_.issues = issues;
+        if (issues != 0) {
+            last_issue_ = now;
+        }
+    }
+    const bool recovered = (now - last_issue_) * 1000.0 >= options_.recover_ms;
+    setState(issues != 0 || !recovered ? ConnectionHealth::DEGRADED : ConnectionHealth::HEALTHY, issues, now);
+}
+
+void ConnectionHealthMonitor::setState(ConnectionHealth state, uint32_t issues, double now) {
+    ConnectionHealthEvent event;
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        if (stats_.state == ConnectionHealth::DISCONNECTED && state == ConnectionHealth::DEGRADED && issues == 0) {
+            // A new connection is healthy until an issue shows up
+            last_issue_ = -1e9;
+            state = ConnectionHealth::HEALTHY;
+        }
+        if (stats_.state == state) {
+            return;
+        }
+        event.previous = stats_.state;
+        event.state = state;
+        event.issues = issues;
+        event.rtt_ms = stats_.rtt_ms;
+        event.send_gap_ms = stats_.send_gap_ms;
+        event.timestamp = now;
+        stats_.state = state;
+        if (state == ConnectionHealth::DEGRADED) {
+            stats_.degradations++;
+        }
+        if (state == ConnectionHealth::DISCONNECTED) {
+            stats_.issues = 0;
+        }
+    }
+    EventCallback cb;
+    {
+        std::lock_guard<std::mutex> lock(callback_mutex_);
+        cb = event_cb_;
+    }
+    if (cb) {
+        cb(event);
+    }
+}
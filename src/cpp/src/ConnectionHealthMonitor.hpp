@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief State of a monitored control connection.
+ */
+enum class ConnectionHealth : int {
+    DISCONNECTED = 0,  // No established connection on the port
+    HEALTHY = 1,
+    DEGRADED = 2,  // One of the ConnectionIssue conditions holds, or held less than `recover_ms` ago
+};
+
+/**
+ * @brief Conditions that degrade a connection, combined as bit flags.
+ */
+enum class ConnectionIssue : uint32_t {
+    NONE = 0,
+    RTT_HIGH = 1,     // The smoothed RTT of the kernel exceeds `rtt_limit_ms`
+    RETRANSMIT = 2,   // The kernel retransmitted a segment in the last `retransmit_hold_ms`
+    SEND_GAP = 4,     // No command sent for `warn_fraction` of the controller read timeout
+    ACK_STALL = 8,    // Sent data has not been acknowledged for `warn_fraction` of the read timeout
+};
+
+struct ConnectionHealthStats {
+    ConnectionHealth state = ConnectionHealth::DISCONNECTED;
+    uint32_t issues = 0;        // ConnectionIssue flags of the last sample
+    uint64_t connections = 0;   // Connections seen on the port since start()
+    uint64_t rtt_samples = 0;   // Per-ACK RTT samples recovered since start(), see ConnectionHealthMonitor
+    double rtt_ms = 0.0;        // Smoothed RTT of the kernel (srtt, tcpi_rtt), an average with gain 1/8
+    double rttvar_ms = 0.0;     // Mean deviation of the RTT (rttvar, tcpi_rttvar)
+    double rtt_min_ms = 0.0;    // Over the window of per-ACK samples
+    double rtt_p50_ms = 0.0;
+    double rtt_p90_ms = 0.0;
+    double rtt_p99_ms = 0.0;
+    double rtt_max_ms = 0.0;
+    uint64_t retransmits = 0;   // Segments retransmitted by the kernel since start()
+    uint64_t late_packets = 0;  // Commands sent more than `late_ms` after the previous one
+    double send_gap_ms = 0.0;   // Time since the last command was sent
+    uint32_t unacked = 0;       // Segments sent and not acknowledged yet
+    uint64_t degradations = 0;  // Transitions to DEGRADED
+};
+
+/**
+ * @brief Change of state of a monitored connection.
+ */
+struct ConnectionHealthEvent {
+    ConnectionHealth state = ConnectionHealth::DISCONNECTED;
+    ConnectionHealth previous = ConnectionHealth::DISCONNECTED;
+    uint32_t issues = 0;       // ConnectionIssue flags that caused a degradation
+    double rtt_ms = 0.0;       // Smoothed RTT of the kernel
+    double send_gap_ms = 0.0;
+    double timestamp = 0.0;    // Steady clock time, in seconds (same clock as Python time.monotonic())
+};
+
+/**
+ * @brief Measure the health of a control connection of the driver (the reverse socket by default) from a background
+ * thread, and report a degradation before the controller read timeout stops the robot.
+ *
+ * The sockets belong to the SDK and the control script has no echo, so the monitor finds the connected socket of the
+ * port among the descriptors of the process and samples its kernel TCP statistics: the smoothed RTT and its deviation,
+ * the retransmission counter, the time since the last sent segment and the unacknowledged data. Linux only: elsewhere
+ * start() fails.
+ *
+ * The kernel only reports the smoothed RTT, srtt = 7/8 srtt + 1/8 sample. When exactly one segment (the
+ * acknowledgement of a command) arrived between two polls, the sample of that acknowledgement is recovered as
+ * 8 srtt - 7 srtt_before, to the microsecond resolution of tcpi_rtt. Only these samples enter the window of the
+ * percentiles: with acknowledgements faster than the sampling period, or without the segment counters of Linux 4.2,
+ * the percentiles are unavailable and stay at 0.
+ */
+class ConnectionHealthMonitor {
+   public:
+    using EventCallback = std::function<void(const ConnectionHealthEvent& event)>;
+
+    struct Options {
+        int poll_us = 1000;              // Sampling period
+        double read_timeout_ms = 100.0;  // timeout_ms of the write calls: the controller stops without a command
+        double warn_fraction = 0.5;      // Part of the read timeout after which a send gap or an ACK stall degrades
+        double late_ms = 16.0;           // Gap between two commands counted as a late packet
+        double rtt_limit_ms = 10.0;      // Smoothed RTT that degrades the connection
+        int window = 1024;               // Per-ACK RTT samples kept for the percentiles
+        int retransmit_hold_ms = 1000;   // How long a retransmission keeps the connection degraded
+        int recover_ms = 500;            // Time without issue before a degraded connection is healthy again
+    };
+
+    ConnectionHealthMonitor() = default;
+    ~ConnectionHealthMonitor();
+
+    ConnectionHealthMonitor(const ConnectionHealthMonitor&) = delete;
+    ConnectionHealthMonitor& operator=(const ConnectionHealthMonitor&) = delete;
+
+    /**
+     * @brief Start monitoring the local TCP port `port`. The connection is found again after a reconnection.
+     *
+     * @return false if the monitor is already running or the platform is not supported
+     * @throws std::invalid_argument if an option is out of range
+     */
+    bool start(int port, const Options& options);
+
+    /**
+     * @brief Stop the thread and wait for it.
+     */
+    void stop();
+
+    bool isRunning() const { return running_; }
+
+    int port() const { return port_; }
+
+    /**
+     * @brief Invoked on the monitor thread at every change of state. Pass an empty function to remove it.
+     */
+    void setEventCallback(EventCallback cb);
+
+    ConnectionHealthStats stats() const;
+
+    /**
+     * @brief Per-ACK RTT samples of the window, oldest first, in milliseconds.
+     */
+    std::vector<double> rttSamples() const;
+
+   private:
+    struct TcpSample;
+
+    void loop();
+    void sample(const TcpSample& tcp, double now);
+    void setState(ConnectionHealth state, uint32_t issues, double now);
+
+    int port_ = 0;
+    Options options_;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+
+    std::mutex callback_mutex_;
+    EventCallback event_cb_;
+
+    // Everything below is written by the monitor thread under stats_mutex_
+    mutable std::mutex stats_mutex_;
+    ConnectionHealthStats stats_;
+    std::vector<double> window_;
+    size_t window_next_ = 0;
+    bool window_full_ = false;
+    uint64_t last_segs_in_ = 0;
+    uint64_t last_segs_out_ = 0;
+    uint64_t last_retrans_ = 0;
+    double last_srtt_us_ = -1.0;  // tcpi_rtt of the previous poll, < 0 on a new connection
+    double last_send_ = 0.0;
+    double last_retransmit_ = -1e9;
+    double last_issue_ = -1e9;
+    bool in_gap_ = false;
+};
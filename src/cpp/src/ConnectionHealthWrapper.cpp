@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "ConnectionHealthWrapper.hpp"
+#include "ConnectionHealthMonitor.hpp"
+#include "GilSafeObject.hpp"
+
+#include <Elite/EliteDriver.hpp>
+
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+using namespace ELITE;
+
+using Stats = ConnectionHealthStats;
+using Event = ConnectionHealthEvent;
+
+static ConnectionHealthMonitor::Options monitorOptions(int poll_us, double read_timeout_ms, double warn_fraction,
+                                                       double late_ms, double rtt_limit_ms, int window,
+                                                       int retransmit_hold_ms, int recover_ms) {
+    ConnectionHealthMonitor::Options options;
+    options.poll_us = poll_us;
+    options.read_timeout_ms = read_timeout_ms;
+    options.warn_fraction = warn_fraction;
+    options.late_ms = late_ms;
+    options.rtt_limit_ms = rtt_limit_ms;
+    options.window = window;
+    options.retransmit_hold_ms = retransmit_hold_ms;
+    options.recover_ms = recover_ms;
+    return options;
+}
+
+void bindConnectionHealth(py::module_& m) {
+    py::enum_<ConnectionHealth>(m, "ConnectionHealth", py::arithmetic())
+        .value("DISCONNECTED", ConnectionHealth::DISCONNECTED, "No established connection on the port")
+        .value("HEALTHY", ConnectionHealth::HEALTHY)
+        .value("DEGRADED", ConnectionHealth::DEGRADED, "An issue holds, or held less than recover_ms ago")
+        .export_values();
+
+    py::enum_<ConnectionIssue>(m, "ConnectionIssue", py::arithmetic())
+        .value("NONE", ConnectionIssue::NONE)
+        .value("RTT_HIGH", ConnectionIssue::RTT_HIGH, "The smoothed RTT of the kernel exceeds rtt_limit_ms")
+        .value("RETRANSMIT", ConnectionIssue::RETRANSMIT, "A segment was retransmitted in the last retransmit_hold_ms")
+        .value("SEND_GAP", ConnectionIssue::SEND_GAP, "No command sent for warn_fraction of the read timeout")
+        .value("ACK_STALL", ConnectionIssue::ACK_STALL,
+               "Sent data unacknowledged for warn_fraction of the read timeout")
+        .export_values();
+
+    py::class_<Stats>(m, "ConnectionHealthStats")
+        .def_readonly("state", &Stats::state)
+        .def_readonly("issues", &Stats::issues, "ConnectionIssue flags of the last sample.")
+        .def_readonly("connections", &Stats::connections, "Connections seen on the port since start().")
+        .def_readonly("rtt_samples", &Stats::rtt_samples,
+                      "Per-ACK RTT samples recovered since start(), only when one segment arrived between two polls.")
+        .def_readonly("rtt_ms", &Stats::rtt_ms, "Smoothed RTT of the kernel (srtt), an average with gain 1/8.")
+        .def_readonly("rttvar_ms", &Stats::rttvar_ms, "Mean deviation of the RTT of the kernel (rttvar).")
+        .def_readonly("rtt_min_ms", &Stats::rtt_min_ms, "Minimum over the window of per-ACK samples, 0 if none.")
+        .def_readonly("rtt_p50_ms", &Stats::rtt_p50_ms)
+        .def_readonly("rtt_p90_ms", &Stats::rtt_p90_ms)
+        .def_readonly("rtt_p99_ms", &Stats::rtt_p99_ms)
+        .def_readonly("rtt_max_ms", &Stats::rtt_max_ms, "Maximum over the window.")
+        .def_readonly("retransmits", &Stats::retransmits, "Segments retransmitted since start().")
+        .def_readonly("late_packets", &Stats::late_packets, "Commands sent more than late_ms after the previous one.")
+        .def_readonly("send_gap_ms", &Stats::send_gap_ms, "Time since the last command was sent.")
+        .def_readonly("unacked", &Stats::unacked, "Segments sent and not acknowledged yet.")
+        .def_readonly("degradations", &Stats::degradations, "Transitions to DEGRADED.")
+        .def("__repr__", [](const Stats& s) {
+            return py::str("<ConnectionHealthStats state={} rtt={:.3f}ms rttvar={:.3f}ms p99={:.3f}ms retransmits={} "
+                           "late={} degradations={}>")
+                .format(py::cast(s.state), s.rtt_ms, s.rttvar_ms, s.rtt_p99_ms, s.retransmits, s.late_packets,
+                        s.degradations);
+        });
+
+    py::class_<Event>(m, "ConnectionHealthEvent")
+        .def_readonly("state", &Event::state)
+        .def_readonly("previous", &Event::previous)
+        .def_readonly("issues", &Event::issues, "ConnectionIssue flags that caused a degradation.")
+        .def_readonly("rtt_ms", &Event::rtt_ms, "Smoothed RTT of the kernel.")
+        .def_readonly("send_gap_ms", &Event::send_gap_ms)
+        .def_readonly("timestamp", &Event::timestamp, "Same clock as time.monotonic().")
+        .def("__repr__", [](const Event& e) {
+            return py::str("<ConnectionHealthEvent {} -> {} issues={} send_gap={:.1f}ms>")
+                .format(py::cast(e.previous), py::cast(e.state), e.issues, e.send_gap_ms);
+        });
+
+    py::class_<ConnectionHealthMonitor, GilReleasingPtr<ConnectionHealthMonitor>>(
+        m, "ConnectionHealthMonitor",
+        "Measures RTT, retransmissions and command gaps of a driver connection from a background thread, and reports "
+        "a degradation before the controller read timeout stops the robot.")
+        .def(py::init<>())
+        .def(
+            "start",
+            [](ConnectionHealthMonitor& self, int port, int poll_us, double read_timeout_ms, double warn_fraction,
+               double late_ms, double rtt_limit_ms, int window, int retransmit_hold_ms, int recover_ms) {
+                return self.start(port, monitorOptions(poll_us, read_timeout_ms, warn_fraction, late_ms, rtt_limit_ms,
+                                                       window, retransmit_hold_ms, recover_ms));
+            },
+            py::arg("port"), py::arg("poll_us") = 1000, py::arg("read_timeout_ms") = 100.0,
+            py::arg("warn_fraction") = 0.5, py::arg("late_ms") = 16.0, py::arg("rtt_limit_ms") = 10.0,
+            py::arg("window") = 1024, py::arg("retransmit_hold_ms") = 1000, py::arg("recover_ms") = 500,
+            R"doc(
+                Start monitoring the connection accepted on a local port of the driver, usually
+                EliteDriverConfig.reverse_port. The connection is found again after the robot reconnects. Linux only.
+
+                Args:
+                    port (int): Local TCP port of the connection
+                    poll_us (int): Sampling period
+                    read_timeout_ms (float): timeout_ms given to writeServoj and the other write calls
+                    warn_fraction (float): Part of the read timeout after which a command gap or unacknowledged data
+                        degrades the connection
+                    late_ms (float): Gap between two commands counted as a late packet, e.g. twice the servo period
+                    rtt_limit_ms (float): Smoothed RTT of the kernel that degrades the connection
+                    window (int): Per-ACK RTT samples kept for the percentiles
+                    retransmit_hold_ms (int): How long a retransmission keeps the connection degraded
+                    recover_ms (int): Time without issue before the connection is healthy again
+
+                Returns:
+                    bool: False if the monitor is already running or the platform is not supported
+
+                Raises:
+                    ValueError: An option is out of range
+            )doc")
+        .def(
+            "start",
+            [](ConnectionHealthMonitor& self, const EliteDriverConfig& config, double read_timeout_ms) {
+                ConnectionHealthMonitor::Options options;
+                options.read_timeout_ms = read_timeout_ms;
+                options.late_ms = 2000.0 * config.servoj_time;
+                return self.start(config.reverse_port, options);
+            },
+            py::arg("config"), py::arg("read_timeout_ms") = 100.0,
+            "Monitor the reverse socket of a driver, with late packets at twice servoj_time and default options.")
+        .def("stop", &ConnectionHealthMonitor::stop, py::call_guard<py::gil_scoped_release>(),
+             "Stop the monitor thread and wait for it.")
+        .def("isRunning", &ConnectionHealthMonitor::isRunning)
+        .def("getPort", &ConnectionHealthMonitor::port)
+        .def(
+            "setEventCallback",
+            [](ConnectionHealthMonitor& self, py::object cb) {
+                if (cb.is_none()) {
+                    self.setEventCallback(nullptr);
+                    return;
+                }
+                auto cb_ptr = makeGilSafe(std::move(cb));
+                self.setEventCallback([cb_ptr](const ConnectionHealthEvent& event) {
+                    py::gil_scoped_acquire gil;
+                    try {
+                        (*cb_ptr)(event);
+                    } catch (const py::error_already_set& e) {
+                        py::print("Python callback raised exception:", e.what());
+                    }
+                });
+            },
+            py::arg("cb"),
+            R"doc(
+                Register a callback invoked on the monitor thread at every change of state. A DEGRADED event with
+                SEND_GAP comes before the controller read timeout: slow down or stop cleanly from it.
+
+                Args:
+                    cb (Callable[[ConnectionHealthEvent], None]): Pass None to remove the callback.
+            )doc")
+        .def("getStats", &ConnectionHealthMonitor::stats,
+             R"doc(
+                Smoothed RTT and deviation of the kernel, per-ACK RTT percentiles, counters and current state.
+
+                The kernel only reports the smoothed RTT. A per-ACK sample is recovered when exactly one segment
+                arrived between two polls; when acknowledgements come faster than poll_us, or on kernels before 4.2,
+                there is none and the percentiles stay at 0.
+            )doc")
+        .def("getRttSamples", &ConnectionHealthMonitor::rttSamples,
+             "Per-ACK RTT samples of the window in ms, oldest first.");
+}
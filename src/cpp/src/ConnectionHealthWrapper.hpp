@@ -0,0 +1,7 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <pybind11/pybind11.h>
+
+void bindConnectionHealth(pybind11::module_& m);
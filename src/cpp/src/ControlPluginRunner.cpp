@@ -0,0 +1,284 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "ControlPluginRunner.hpp"
+#include "RtToolkit.hpp"
+#include "SdkThreads.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Tries of the loop to read a consistent parameter block before it keeps the previous one for the cycle
+constexpr int PARAM_READ_ATTEMPTS = 64;
+
+}  // namespace
+
+void SeqLockArray::write(const double* values, size_t offset, size_t count) {
+    if (offset > values_.size() || count > values_.size() - offset) {
+        throw std::out_of_range("Parameter range out of the block");
+    }
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    sequence_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < count; ++i) {
+        values_[offset + i].store(values[i], std::memory_order_relaxed);
+    }
+    sequence_.fetch_add(1, std::memory_order_release);
+}
+
+void SeqLockArray::read(double* out) const {
+    uint64_t before = 0;
+    uint64_t after = 0;
+    do {
+        before = sequence_.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;
+        }
+        for (size_t i = 0; i < values_.size(); ++i) {
+            out[i] = values_[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = sequence_.load(std::memory_order_relaxed);
+    } while ((before & 1) || before != after);
+}
+
+bool SeqLockArray::tryRead(double* out, int attempts, uint64_t& version) const {
+    for (int attempt = 0; attempt < attempts; ++attempt) {
+        const uint64_t before = sequence_.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;
+        }
+        for (size_t i = 0; i < values_.size(); ++i) {
+            out[i] = values_[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_.load(std::memory_order_relaxed) == before) {
+            version = before / 2;
+            return true;
+        }
+    }
+    return false;
+}
+
+struct ControlPluginRunner::Library {
+#ifdef _WIN32
+    HMODULE handle = nullptr;
+#else
+    void* handle = nullptr;
+#endif
+    EliteControlStepFn step = nullptr;
+    EliteControlCreateFn create = nullptr;
+    EliteControlDestroyFn destroy = nullptr;
+
+    template <typename Fn>
+    Fn symbol(const char* name) const {
+#ifdef _WIN32
+        return reinterpret_cast<Fn>(reinterpret_cast<void*>(::GetProcAddress(handle, name)));
+#else
+        return reinterpret_cast<Fn>(::dlsym(handle, name));
+#endif
+    }
+
+    ~Library() {
+        if (handle != nullptr) {
+#ifdef _WIN32
+            ::FreeLibrary(handle);
+#else
+            ::dlclose(handle);
+#endif
+        }
+    }
+};
+
+ControlPluginRunner::ControlPluginRunner(const std::string& library_path, size_t param_count)
+    : library_(new Library()), params_(param_count) {
+#ifdef _WIN32
+    library_->handle = ::LoadLibraryA(library_path.c_str());
+    if (library_->handle == nullptr) {
+        throw std::runtime_error("Cannot load control plugin " + library_path);
+    }
+#else
+    // RTLD_NOW: an unresolved symbol fails here rather than in the real-time thread
+    library_->handle = ::dlopen(library_path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (library_->handle == nullptr) {
+        throw std::runtime_error("Cannot load control plugin " + library_path + ": " + ::dlerror());
+    }
+#endif
+    auto abi_version = library_->symbol<EliteControlAbiVersionFn>("elite_control_abi_version");
+    library_->step = library_->symbol<EliteControlStepFn>("elite_control_step");
+    if (abi_version == nullptr || library_->step == nullptr) {
+        throw std::runtime_error("Control plugin " + library_path +
+                                 " does not export elite_control_abi_version and elite_control_step");
+    }
+    if (abi_version() != ELITE_CONTROL_ABI_VERSION) {
+        throw std::runtime_error("Control plugin " + library_path + " has ABI version " +
+                                 std::to_string(abi_version()) + ", expected " +
+                                 std::to_string(ELITE_CONTROL_ABI_VERSION));
+    }
+    library_->create = library_->symbol<EliteControlCreateFn>("elite_control_create");
+    library_->destroy = library_->symbol<EliteControlDestroyFn>("elite_control_destroy");
+    auto plugin_name = library_->symbol<EliteControlNameFn>("elite_control_name");
+    if (plugin_name != nullptr && plugin_name() != nullptr) {
+        name_ = plugin_name();
+    } else {
+        name_ = library_path.substr(library_path.find_last_of("/\\") + 1);
+    }
+    if (library_->create != nullptr) {
+        context_ = library_->create(static_cast<uint32_t>(param_count));
+    }
+}
+
+ControlPluginRunner::ControlPluginRunner(std::string name, EliteControlStepFn step, void* context, size_t param_count)
+    : library_(new Library()), name_(std::move(name)), context_(context), params_(param_count) {
+    library_->step = step;
+}
+
+ControlPluginRunner::~ControlPluginRunner() {
+    stop();
+    SdkThreadRegistry::instance().untrack(this);
+    if (library_->destroy != nullptr) {
+        library_->destroy(context_);
+    }
+}
+
+void ControlPluginRunner::setParameters(const double* values, size_t offset, size_t count) {
+    params_.write(values, offset, count);
+}
+
+std::vector<double> ControlPluginRunner::parameters() const {
+    std::vector<double> values(params_.size());
+    params_.read(values.data());
+    return values;
+}
+
+std::vector<double> ControlPluginRunner::telemetry() const {
+    std::vector<double> values(telemetry_.size());
+    telemetry_.read(values.data());
+    return values;
+}
+
+ControlPluginRunner::Stats ControlPluginRunner::stats() const {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    Stats stats = stats_;
+    stats.running = running_;
+    return stats;
+}
+
+bool ControlPluginRunner::start(StateReader reader, CommandWriter writer, const Options& options) {
+    if (running_) {
+        return false;
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        stats_ = Stats();
+    }
+    stop_requested_ = false;
+    running_ = true;
+    thread_ = std::thread(&ControlPluginRunner::loop, this, std::move(reader), std::move(writer), options);
+    return true;
+}
+
+void ControlPluginRunner::stop() {
+    stop_requested_ = true;
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void ControlPluginRunner::loop(StateReader reader, CommandWriter writer, Options options) {
+    using Clock = std::chrono::steady_clock;
+    Stats local;
+    // Everything the loop touches is allocated before the first cycle. The first parameters are read before the
+    // thread gets its real-time priority, the loop then keeps the last consistent block.
+    std::vector<double> params(params_.size());
+    std::vector<double> next_params(params_.size());
+    uint64_t params_version = params_.version();
+    params_.read(params.data());
+    if (options.cpu >= 0) {
+        setThreadAffinity(0, {options.cpu});
+    }
+#ifndef _WIN32
+    if (options.priority > 0) {
+        local.realtime = setThreadScheduling(0, SCHED_FIFO, options.priority);
+    }
+#endif
+    setThreadName(0, "elite_ctrl");
+#if defined(__linux__)
+    // Listed by listSdkThreads() with the other SDK threads
+    SdkThreadRegistry::instance().track(this, "ControlPlugin", {static_cast<int>(::syscall(SYS_gettid))});
+#endif
+
+    EliteControlState state;
+    std::memset(&state, 0, sizeof(state));
+    EliteControlOutput out;
+    double previous_timestamp = 0.0;
+    double step_sum_us = 0.0;
+    const auto poll = std::chrono::microseconds(std::max(options.poll_us, 1));
+
+    while (!stop_requested_) {
+        if (!reader(state)) {
+            std::this_thread::sleep_for(poll);
+            continue;
+        }
+        state.cycle = local.cycles;
+        state.dt = local.cycles == 0 ? 0.0 : state.timestamp - previous_timestamp;
+        previous_timestamp = state.timestamp;
+        local.max_period_us = std::max(local.max_period_us, state.dt * 1e6);
+        if (params_.tryRead(next_params.data(), PARAM_READ_ATTEMPTS, params_version)) {
+            params.swap(next_params);
+        } else {
+            ++local.param_misses;
+        }
+        state.params_version = params_version;
+
+        std::memset(&out, 0, sizeof(out));
+        const auto begin = Clock::now();
+        const int result = library_->step(context_, &state, params.data(), static_cast<uint32_t>(params.size()), &out);
+        const double step_us = std::chrono::duration<double, std::micro>(Clock::now() - begin).count();
+
+        local.last_result = result;
+        if (result == 0 && out.command != ELITE_CONTROL_NONE) {
+            if (out.timeout_ms <= 0) {
+                out.timeout_ms = options.timeout_ms;
+            }
+            if (!writer(out)) {
+                ++local.write_failures;
+            }
+        }
+        telemetry_.write(out.telemetry, 0, ELITE_CONTROL_TELEMETRY_SIZE);
+
+        ++local.cycles;
+        local.last_step_us = step_us;
+        local.max_step_us = std::max(local.max_step_us, step_us);
+        step_sum_us += step_us;
+        local.avg_step_us = step_sum_us / static_cast<double>(local.cycles);
+        // Never wait for a reader of the statistics, publish on a later cycle instead
+        std::unique_lock<std::mutex> lock(stats_mutex_, std::try_to_lock);
+        if (lock.owns_lock()) {
+            stats_ = local;
+        }
+        if (result != 0) {
+            break;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        stats_ = local;
+    }
+    running_ = false;
+}
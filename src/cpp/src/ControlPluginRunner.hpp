@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include "EliteControlPlugin.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Array of doubles written by one side and read by a real-time thread without locks (sequence lock).
+ *
+ * read() retries while a write is in progress. A real-time reader uses tryRead() instead: a writer of lower priority
+ * preempted in the middle of a write would keep it spinning. Writers are serialized by a mutex.
+ */
+class SeqLockArray {
+   public:
+    explicit SeqLockArray(size_t size) : values_(size) {}
+
+    size_t size() const { return values_.size(); }
+
+    void write(const double* values, size_t offset, size_t count);
+
+    // Copy the whole array, consistent with a single write
+    void read(double* out) const;
+
+    // Same as read() with at most `attempts` tries. On failure `out` may be torn and `version` is left unchanged.
+    bool tryRead(double* out, int attempts, uint64_t& version) const;
+
+    // Number of completed writes
+    uint64_t version() const { return sequence_.load(std::memory_order_acquire) / 2; }
+
+   private:
+    std::vector<std::atomic<double>> values_;
+    std::atomic<uint64_t> sequence_{0};
+    std::mutex write_mutex_;
+};
+
+/**
+ * @brief Load a control-law plugin (EliteControlPlugin.h) and call its step() on a real-time thread for every new
+ * robot sample.
+ *
+ * The thread reads the state through a StateReader and sends the command of the step through a CommandWriter, so it
+ * never touches Python. Parameters and telemetry go through sequence locks: Python writes and reads them at any time
+ * without stalling the loop.
+ */
+class ControlPluginRunner {
+   public:
+    // Fill `state` from a new sample. false when no sample arrived since the last call.
+    using StateReader = std::function<bool(EliteControlState& state)>;
+    // Send the command of a cycle. false if it could not be sent.
+    using CommandWriter = std::function<bool(const EliteControlOutput& out)>;
+
+    struct Options {
+        int cpu = -1;          // Core of the thread, < 0 for no pinning
+        int priority = 80;     // SCHED_FIFO priority, <= 0 keeps the default policy
+        int poll_us = 200;     // Sleep between two checks for a new sample
+        int timeout_ms = 100;  // Command timeout when the plugin leaves it at 0
+    };
+
+    struct Stats {
+        bool running = false;
+        bool realtime = false;  // The thread got the requested FIFO priority
+        uint64_t cycles = 0;
+        uint64_t write_failures = 0;
+        uint64_t param_misses = 0;  // Cycles that kept the previous parameters, a write was in progress
+        int last_result = 0;  // Last return value of step(), non-zero stopped the loop
+        double last_step_us = 0.0;
+        double max_step_us = 0.0;
+        double avg_step_us = 0.0;
+        double max_period_us = 0.0;  // Largest time between two samples
+    };
+
+    /**
+     * @param library_path Shared library of the plugin
+     * @param param_count Size of the parameter block
+     * @throws std::runtime_error if the library cannot be loaded, lacks a required symbol or has another ABI version
+     */
+    ControlPluginRunner(const std::string& library_path, size_t param_count);
+
+    /**
+     * @brief Run a control law built into the SDK, with the same ABI as a plugin.
+     *
+     * @param context Passed to `step`, owned by the caller and valid until destruction
+     */
+    ControlPluginRunner(std::string name, EliteControlStepFn step, void* context, size_t param_count);
+    ~ControlPluginRunner();
+
+    ControlPluginRunner(const ControlPluginRunner&) = delete;
+    ControlPluginRunner& operator=(const ControlPluginRunner&) = delete;
+
+    /**
+     * @brief Name returned by elite_control_name(), the file name otherwise.
+     */
+    const std::string& name() const { return name_; }
+
+    size_t parameterCount() const { return params_.size(); }
+
+    /**
+     * @brief Write `count` parameters from index `offset`. Visible to the next step().
+     */
+    void setParameters(const double* values, size_t offset, size_t count);
+    std::vector<double> parameters() const;
+
+    /**
+     * @brief Start the real-time thread. The reader and the writer must stay valid until stop().
+     *
+     * @return false if the loop is already running
+     */
+    bool start(StateReader reader, CommandWriter writer, const Options& options);
+
+    /**
+     * @brief Stop the thread and wait for it.
+     */
+    void stop();
+
+    bool isRunning() const { return running_; }
+
+    Stats stats() const;
+
+    /**
+     * @brief Telemetry of the last cycle.
+     */
+    std::vector<double> telemetry() const;
+
+   private:
+    void loop(StateReader reader, CommandWriter writer, Options options);
+
+    struct Library;
+    std::unique_ptr<Library> library_;
+    std::string name_;
+    void* context_ = nullptr;
+
+    SeqLockArray params_;
+    SeqLockArray telemetry_{ELITE_CONTROL_TELEMETRY_SIZE};
+
+    std::atomic<bool> running_{false};
+    std::atomic<bool> stop_requested_{false};
+    std::thread thread_;
+
+    mutable std::mutex stats_mutex_;
+    Stats stats_;
+};
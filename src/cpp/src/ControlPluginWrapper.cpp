@@ -0,0 +1,318 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "ControlPluginWrapper.hpp"
+#include "AdmittanceController.hpp"
+#include "ControlPluginRunner.hpp"
+#include "NdArrayUtils.hpp"
+#include "SamplingUtils.hpp"
+#include "TrajectoryServo.hpp"
+
+#include <Elite/EliteDriver.hpp>
+#include <Elite/RtsiIOInterface.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace py = pybind11;
+using namespace ELITE;
+
+static py::array_t<double> toArray(const std::vector<double>& values) {
+    return py::array_t<double>(static_cast<py::ssize_t>(values.size()), values.data());
+}
+
+static void copy6(const vector6d_t& from, double* to) { std::copy(from.begin(), from.end(), to); }
+
+static ControlPluginRunner::StateReader rtsiReader(RtsiIOInterface* rtsi) {
+    double last_timestamp = -1.0;
+    return [rtsi, last_timestamp](EliteControlState& state) mutable {
+        return readRtsiSample(rtsi, last_timestamp, state.timestamp, [rtsi, &state] {
+            copy6(rtsi->getActualJointPositions(), state.actual_joint_positions);
+            copy6(rtsi->getActualJointVelocity(), state.actual_joint_velocity);
+            copy6(rtsi->getActualJointTorques(), state.actual_joint_torques);
+            copy6(rtsi->getActualTCPPose(), state.actual_tcp_pose);
+            copy6(rtsi->getActualTCPVelocity(), state.actual_tcp_velocity);
+            copy6(rtsi->getActualTCPForce(), state.actual_tcp_force);
+            copy6(rtsi->getTargetJointPositions(), state.target_joint_positions);
+            copy6(rtsi->getTargetJointVelocity(), state.target_joint_velocity);
+        });
+    };
+}
+
+static ControlPluginRunner::CommandWriter driverWriter(EliteDriver* driver) {
+    return [driver](const EliteControlOutput& out) {
+        vector6d_t values;
+        std::copy(out.values, out.values + 6, values.begin());
+        switch (out.command) {
+            case ELITE_CONTROL_SERVOJ:
+                return driver->writeServoj(values, out.timeout_ms, false);
+            case ELITE_CONTROL_SERVOJ_CARTESIAN:
+                return driver->writeServoj(values, out.timeout_ms, true);
+            case ELITE_CONTROL_SPEEDJ:
+                return driver->writeSpeedj(values, out.timeout_ms);
+            case ELITE_CONTROL_SPEEDL:
+                return driver->writeSpeedl(values, out.timeout_ms);
+            case ELITE_CONTROL_IDLE:
+                return driver->writeIdle(out.timeout_ms);
+            default:
+                return false;
+        }
+    };
+}
+
+static ControlPluginRunner::Options runnerOptions(int cpu, int priority, int poll_us, int timeout_ms) {
+    ControlPluginRunner::Options options;
+    options.cpu = cpu;
+    options.priority = priority;
+    options.poll_us = poll_us;
+    options.timeout_ms = timeout_ms;
+    return options;
+}
+
+static void bindAdmittanceController(py::module_& m) {
+    py::class_<AdmittanceController>(m, "AdmittanceController",
+                                     "Native admittance / impedance controller: RTSI TCP force in, writeSpeedl out, on "
+                                     "a real-time thread.")
+        .def(py::init<>(), R"doc(
+                Create the controller with conservative defaults: mass 10 kg / 1 kg.m^2, damping 100 N.s/m /
+                5 N.m.s/rad, no stiffness, every axis selected, 0.1 m/s / 0.5 rad/s, deadband 2 N / 0.2 N.m and no
+                workspace limit.
+            )doc")
+        .def("setMass", &AdmittanceController::setMass, py::arg("mass"),
+             R"doc(
+                Virtual mass of each axis [x, y, z, rx, ry, rz] (kg, kg.m^2).
+
+                Raises:
+                    ValueError: A mass is not positive
+            )doc")
+        .def("setDamping", &AdmittanceController::setDamping, py::arg("damping"),
+             R"doc(
+                Virtual damping of each axis (N.s/m, N.m.s/rad).
+
+                Raises:
+                    ValueError: A damping is negative
+            )doc")
+        .def("setStiffness", &AdmittanceController::setStiffness, py::arg("stiffness"),
+             "Virtual stiffness of each axis toward the anchor pose (N/m, N.m/rad). 0 for pure admittance.")
+        .def("setSelection", &AdmittanceController::setSelection, py::arg("selection"),
+             "Axes driven by the model. Unselected axes are commanded a zero velocity.")
+        .def("setVelocityLimits", &AdmittanceController::setVelocityLimits, py::arg("max_velocity"),
+             "Largest commanded velocity of each axis (m/s, rad/s).")
+        .def("setDeadband", &AdmittanceController::setDeadband, py::arg("deadband"),
+             "Force and torque ignored on each axis (N, N.m), against sensor noise and offset.")
+        .def("setWorkspace", &AdmittanceController::setWorkspace, py::arg("min"), py::arg("max"),
+             R"doc(
+                Box of the TCP position in the base frame [x, y, z]. The velocity toward a face is reduced so the
+                TCP stops on it.
+
+                Raises:
+                    ValueError: A minimum is above its maximum
+            )doc")
+        .def("resetAnchor", &AdmittanceController::resetAnchor,
+             "Take the current TCP pose as the rest pose of the springs, on the next cycle.")
+        .def(
+            "start",
+            [](AdmittanceController& self, RtsiIOInterface& rtsi, EliteDriver& driver, int cpu, int priority,
+               int poll_us, int timeout_ms) {
+                return self.runner().start(rtsiReader(&rtsi), driverWriter(&driver),
+                                           runnerOptions(cpu, priority, poll_us, timeout_ms));
+            },
+            py::arg("rtsi"), py::arg("driver"), py::arg("cpu") = -1, py::arg("priority") = 80, py::arg("poll_us") = 200,
+            py::arg("timeout_ms") = 100, py::keep_alive<1, 2>(), py::keep_alive<1, 3>(),
+            R"doc(
+                Start the real-time thread. The model starts at rest, anchored at the current TCP pose. The RTSI
+                output recipe must contain actual_TCP_pose and actual_TCP_force.
+
+                Args:
+                    rtsi (RtsiIOInterface): Connected RTSI interface
+                    driver (EliteDriver): Driver running the external control script
+                    cpu (int): Core of the thread, < 0 for no pinning
+                    priority (int): SCHED_FIFO priority, <= 0 keeps the default policy
+                    poll_us (int): Interval between two checks for a new sample
+                    timeout_ms (int): Timeout of each writeSpeedl
+
+                Returns:
+                    bool: False if the loop is already running
+            )doc")
+        .def(
+            "stop", [](AdmittanceController& self) { self.runner().stop(); },
+            py::call_guard<py::gil_scoped_release>(), "Stop the real-time thread and wait for it.")
+        .def("isRunning", [](const AdmittanceController& self) { return self.runner().isRunning(); })
+        .def(
+            "getStats", [](const AdmittanceController& self) { return self.runner().stats(); },
+            "Cycle count, step timings and write failures.")
+        .def(
+            "getParameters", [](const AdmittanceController& self) { return toArray(self.runner().parameters()); },
+            "Copy of the parameter block.")
+        .def(
+            "getTelemetry", [](const AdmittanceController& self) { return toArray(self.runner().telemetry()); },
+            R"doc(
+                Values of the last cycle: commanded velocity [0:6], force after the deadband [6:12], distance [12]
+                and angle [13] to the anchor, bit mask of the axes clamped by a limit [14].
+            )doc");
+}
+
+static void bindTrajectoryServo(py::module_& m) {
+    py::class_<TrajectoryServo>(m, "TrajectoryServo",
+                                "Native joint servo: jerk-limited setpoints toward the last target, sent with "
+                                "writeServoj on a real-time thread.")
+        .def(py::init<>(), "Create the servo with limits of 1 rad/s, 1 rad/s^2 and 10 rad/s^3 on every joint.")
+        .def("setLimits", &TrajectoryServo::setLimits, py::arg("max_velocity"), py::arg("max_acceleration"),
+             py::arg("max_jerk"),
+             R"doc(
+                Joint limits, applied from the current setpoint on the next cycle.
+
+                Raises:
+                    ValueError: A limit is not positive
+            )doc")
+        .def("setTarget", &TrajectoryServo::setTarget, py::arg("target"),
+             "New joint target [rad], planned from the current setpoint on the next cycle. Call it at any time, "
+             "also in the middle of a motion.")
+        .def(
+            "start",
+            [](TrajectoryServo& self, RtsiIOInterface& rtsi, EliteDriver& driver, int cpu, int priority, int poll_us,
+               int timeout_ms) {
+                return self.runner().start(rtsiReader(&rtsi), driverWriter(&driver),
+                                           runnerOptions(cpu, priority, poll_us, timeout_ms));
+            },
+            py::arg("rtsi"), py::arg("driver"), py::arg("cpu") = -1, py::arg("priority") = 80, py::arg("poll_us") = 200,
+            py::arg("timeout_ms") = 100, py::keep_alive<1, 2>(), py::keep_alive<1, 3>(),
+            R"doc(
+                Start the real-time thread. The motion starts at rest from the measured joint positions and holds
+                them until a target is set; a target set before start() is ignored, so that a restart does not
+                move to a stale target. The RTSI output recipe must contain actual_joint_positions.
+
+                Args:
+                    rtsi (RtsiIOInterface): Connected RTSI interface
+                    driver (EliteDriver): Driver running the external control script
+                    cpu (int): Core of the thread, < 0 for no pinning
+                    priority (int): SCHED_FIFO priority, <= 0 keeps the default policy
+                    poll_us (int): Interval between two checks for a new sample
+                    timeout_ms (int): Timeout of each writeServoj
+
+                Returns:
+                    bool: False if the loop is already running
+            )doc")
+        .def(
+            "stop", [](TrajectoryServo& self) { self.runner().stop(); }, py::call_guard<py::gil_scoped_release>(),
+            "Stop the real-time thread and wait for it.")
+        .def("isRunning", [](const TrajectoryServo& self) { return self.runner().isRunning(); })
+        .def(
+            "isTargetReached",
+            [](const TrajectoryServo& self) {
+                return self.runner().telemetry()[TrajectoryServo::TELEMETRY_REACHED] != 0.0;
+            },
+            "The setpoint reached the last target.")
+        .def(
+            "getStats", [](const TrajectoryServo& self) { return self.runner().stats(); },
+            "Cycle count, step timings and write failures.")
+        .def(
+            "getTelemetry", [](const TrajectoryServo& self) { return toArray(self.runner().telemetry()); },
+            R"doc(
+                Values of the last cycle: setpoint velocity [0:6] and acceleration [6:12], time to the target [12],
+                time of the last planning in us [13], 1 once the target is reached [14].
+            )doc");
+}
+
+void bindControlPlugin(py::module_& m) {
+    py::class_<ControlPluginRunner::Stats>(m, "ControlPluginStats")
+        .def_readonly("running", &ControlPluginRunner::Stats::running)
+        .def_readonly("realtime", &ControlPluginRunner::Stats::realtime, "The thread got the requested FIFO priority.")
+        .def_readonly("cycles", &ControlPluginRunner::Stats::cycles)
+        .def_readonly("write_failures", &ControlPluginRunner::Stats::write_failures)
+        .def_readonly("param_misses", &ControlPluginRunner::Stats::param_misses,
+                      "Cycles that kept the previous parameters because a write was in progress.")
+        .def_readonly("last_result", &ControlPluginRunner::Stats::last_result,
+                      "Last return value of step(). A non-zero value stopped the loop.")
+        .def_readonly("last_step_us", &ControlPluginRunner::Stats::last_step_us)
+        .def_readonly("max_step_us", &ControlPluginRunner::Stats::max_step_us)
+        .def_readonly("avg_step_us", &ControlPluginRunner::Stats::avg_step_us)
+        .def_readonly("max_period_us", &ControlPluginRunner::Stats::max_period_us,
+                      "Largest controller time between two samples.")
+        .def("__repr__", [](const ControlPluginRunner::Stats& s) {
+            return py::str("<ControlPluginStats running={} cycles={} write_failures={} last_result={} "
+                           "avg_step={:.1f}us max_step={:.1f}us>")
+                .format(s.running, s.cycles, s.write_failures, s.last_result, s.avg_step_us, s.max_step_us);
+        });
+
+    py::class_<ControlPluginRunner>(m, "ControlPlugin",
+                                    "Native control law (shared library with the EliteControlPlugin.h C ABI) called "
+                                    "by a real-time thread on every RTSI sample.")
+        .def(py::init<const std::string&, size_t>(), py::arg("path"), py::arg("param_count") = 32,
+             R"doc(
+                Load a control plugin. The library is loaded with all its symbols resolved and its context created.
+
+                Args:
+                    path (str): Shared library of the plugin
+                    param_count (int): Size of the parameter block passed to step()
+
+                Raises:
+                    RuntimeError: The library cannot be loaded, lacks elite_control_abi_version or
+                        elite_control_step, or was built for another ABI version
+            )doc")
+        .def("name", &ControlPluginRunner::name, "Name returned by elite_control_name(), the file name otherwise.")
+        .def("parameterCount", &ControlPluginRunner::parameterCount)
+        .def(
+            "setParameters",
+            [](ControlPluginRunner& self, const DoubleArray& values, size_t offset) {
+                if (values.ndim() != 1) {
+                    throw std::runtime_error("values must be a 1-D array");
+                }
+                self.setParameters(values.data(), offset, static_cast<size_t>(values.shape(0)));
+            },
+            py::arg("values"), py::arg("offset") = 0,
+            R"doc(
+                Write parameters from index `offset`. The next step() sees all of them or none of them: the block is
+                published with a sequence lock that the real-time thread reads without waiting.
+
+                Args:
+                    values (numpy.ndarray | list[float]): Parameter values
+                    offset (int): Index of the first value in the block
+            )doc")
+        .def(
+            "setParameter",
+            [](ControlPluginRunner& self, size_t index, double value) { self.setParameters(&value, index, 1); },
+            py::arg("index"), py::arg("value"), "Write one parameter.")
+        .def(
+            "getParameters", [](const ControlPluginRunner& self) { return toArray(self.parameters()); },
+            "Copy of the parameter block.")
+        .def(
+            "start",
+            [](ControlPluginRunner& self, RtsiIOInterface& rtsi, EliteDriver& driver, int cpu, int priority, int poll_us,
+               int timeout_ms) {
+                return self.start(rtsiReader(&rtsi), driverWriter(&driver),
+                                  runnerOptions(cpu, priority, poll_us, timeout_ms));
+            },
+            py::arg("rtsi"), py::arg("driver"), py::arg("cpu") = -1, py::arg("priority") = 80, py::arg("poll_us") = 200,
+            py::arg("timeout_ms") = 100, py::keep_alive<1, 2>(), py::keep_alive<1, 3>(),
+            R"doc(
+                Start the real-time thread. For every new RTSI sample it reads the robot state from `rtsi`, calls the
+                plugin step() and sends its command through `driver` (writeServoj, writeSpeedj, writeSpeedl or
+                writeIdle). The loop never takes the GIL.
+
+                New samples are detected by polling the RTSI timestamp every `poll_us`.
+
+                Args:
+                    rtsi (RtsiIOInterface): Connected RTSI interface
+                    driver (EliteDriver): Driver running the external control script
+                    cpu (int): Core of the thread, < 0 for no pinning
+                    priority (int): SCHED_FIFO priority, <= 0 keeps the default policy
+                    poll_us (int): Interval between two checks for a new sample
+                    timeout_ms (int): Command timeout when the plugin leaves it at 0
+
+                Returns:
+                    bool: False if the loop is already running
+            )doc")
+        .def("stop", &ControlPluginRunner::stop, py::call_guard<py::gil_scoped_release>(),
+             "Stop the real-time thread and wait for it.")
+        .def("isRunning", &ControlPluginRunner::isRunning)
+        .def("getStats", &ControlPluginRunner::stats, "Cycle count, step timings and write failures.")
+        .def(
+            "getTelemetry", [](const ControlPluginRunner& self) { return toArray(self.telemetry()); },
+            "Telemetry values written by the last step().");
+
+    bindAdmittanceController(m);
+    bindTrajectoryServo(m);
+}
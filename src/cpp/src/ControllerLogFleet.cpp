@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "ControllerLogFleet.hpp"
+
+#include <Elite/ControllerLog.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+
+using namespace ELITE;
+
+namespace {
+
+// Pause before a retry, multiplied by the attempt number.
+constexpr auto RETRY_DELAY = std::chrono::milliseconds(500);
+
+bool fileExists(const std::string& path) {
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (f == nullptr) {
+        return false;
+    }
+    std::fclose(f);
+    return true;
+}
+
+}  // namespace
+
+ControllerLogFleet::ControllerLogFleet(int workers, Downloader downloader)
+    : downloader_(downloader ? std::move(downloader) : Downloader(ControllerLog::downloadSystemLog)),
+      workers_(workers > 0 ? workers : 1) {}
+
+void ControllerLogFleet::setProgressCallback(ProgressCallback cb) {
+    std::shared_ptr<const ProgressCallback> ptr;
+    if (cb) {
+        ptr = std::make_shared<const ProgressCallback>(std::move(cb));
+    }
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    callback_ = std::move(ptr);
+}
+
+void ControllerLogFleet::cancel() {
+    cancelled_ = true;
+    std::lock_guard<std::mutex> lock(cancel_mutex_);
+    cancel_cv_.notify_all();
+}
+
+std::vector<ControllerLogFleet::Result> ControllerLogFleet::progress() const {
+    std::lock_guard<std::mutex> lock(results_mutex_);
+    return results_;
+}
+
+void ControllerLogFleet::runJob(size_t index, const Job& job) {
+    auto update = [&](auto&& fn) {
+        std::lock_guard<std::mutex> lock(results_mutex_);
+        fn(results_[index]);
+    };
+
+    if (cancelled_) {
+        update([](Result& r) { r.state = JobState::CANCELLED; });
+        return;
+    }
+    if (resume_ && fileExists(job.path)) {
+        update([](Result& r) { r.state = JobState::SKIPPED; });
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::string part = job.path + ".part";
+    const int attempts = 1 + retries_;
+    bool ok = false;
+    bool interrupted = false;
+    std::string error;
+    for (int attempt = 1; attempt <= attempts && !ok; ++attempt) {
+        if (attempt > 1) {
+            std::unique_lock<std::mutex> lock(cancel_mutex_);
+            if (cancel_cv_.wait_for(lock, RETRY_DELAY * (attempt - 1), [this] { return cancelled_.load(); })) {
+                interrupted = true;
+                break;
+            }
+        }
+        update([&](Result& r) {
+            r.state = JobState::RUNNING;
+            r.attempts = attempt;
+        });
+
+        ProgressThrottle throttle(progress_interval_ms_);
+        error.clear();
+        ok = downloader_(job.robot_ip, job.password, part, [&](int total, int received, const char* err) {
+            update([&](Result& r) {
+                r.total = total;
+                r.received = received;
+            });
+            if (err != nullptr) {
+                error = err;
+            }
+            if (!throttle.shouldReport(total, received, err)) {
+                return;
+            }
+            std::shared_ptr<const ProgressCallback> cb;
+            {
+                std::lock_guard<std::mutex> lock(callback_mutex_);
+                cb = callback_;
+            }
+            if (cb) {
+                std::lock_guard<std::mutex> lock(report_mutex_);
+                (*cb)(index, total, received, err);
+            }
+        });
+        if (ok) {
+            // Replace a stale log left by a run without resume
+            std::remove(job.path.c_str());
+            if (std::rename(part.c_str(), job.path.c_str()) != 0) {
+                ok = false;
+                error = "Cannot rename " + part + " to " + job.path;
+            }
+        } else {
+            std::remove(part.c_str());
+            if (error.empty()) {
+                error = "Download failed";
+            }
+        }
+    }
+
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    update([&](Result& r) {
+        r.state = ok ? JobState::DONE : (interrupted ? JobState::CANCELLED : JobState::FAILED);
+        r.error = ok ? std::string() : error;
+        r.elapsed = elapsed;
+    });
+}
+
+std::vector<ControllerLogFleet::Result> ControllerLogFleet::run(const std::vector<Job>& jobs) {
+    std::lock_guard<std::mutex> run_lock(run_mutex_);
+    cancelled_ = false;
+    {
+        std::lock_guard<std::mutex> lock(results_mutex_);
+        results_.assign(jobs.size(), Result());
+    }
+
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+        for (size_t i = next++; i < jobs.size(); i = next++) {
+            runJob(i, jobs[i]);
+        }
+    };
+    const size_t count = std::min<size_t>(static_cast<size_t>(workers_.load()), jobs.size());
+    std::vector<std::thread> pool;
+    for (size_t w = 1; w < count; ++w) {
+        pool.emplace_back(worker);
+    }
+    if (count > 0) {
+        worker();
+    }
+    for (auto& t : pool) {
+        t.join();
+    }
+    return progress();
+}
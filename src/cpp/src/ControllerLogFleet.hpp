@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Limit the rate of download progress reports.
+ *
+ * Errors and the first report of a complete transfer always pass, other reports pass at most once per interval.
+ */
+class ProgressThrottle {
+   public:
+    explicit ProgressThrottle(int interval_ms)
+        : interval_(std::chrono::milliseconds(interval_ms > 0 ? interval_ms : 0)) {}
+
+    bool shouldReport(int total, int received, const char* err) {
+        if (err != nullptr) {
+            return true;
+        }
+        const bool complete = total > 0 && received >= total;
+        if (complete) {
+            const bool first = !complete_reported_;
+            complete_reported_ = true;
+            return first;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        if (reported_ && now - last_ < interval_) {
+            return false;
+        }
+        reported_ = true;
+        last_ = now;
+        return true;
+    }
+
+   private:
+    std::chrono::steady_clock::duration interval_;
+    std::chrono::steady_clock::time_point last_;
+    bool reported_ = false;
+    bool complete_reported_ = false;
+};
+
+/**
+ * @brief Download the system logs of many controllers concurrently with a bounded pool of workers.
+ *
+ * Each log is written to `<path>.part` and renamed to `<path>` once complete, so an existing `<path>` is always a
+ * full download. With resume enabled, a run skips the robots whose log is already there: an interrupted fleet
+ * download restarts only the missing robots. Failed downloads are retried.
+ */
+class ControllerLogFleet {
+   public:
+    struct Job {
+        std::string robot_ip;
+        std::string password;
+        std::string path;
+    };
+
+    enum class JobState : int { PENDING = 0, RUNNING, DONE, SKIPPED, FAILED, CANCELLED };
+
+    struct Result {
+        JobState state = JobState::PENDING;
+        int attempts = 0;
+        int total = 0;     // File size reported by the transfer, in bytes
+        int received = 0;  // Bytes downloaded
+        std::string error;
+        double elapsed = 0.0;  // Seconds
+    };
+
+    // Called from the worker threads, one call at a time
+    using ProgressCallback = std::function<void(size_t job, int total, int received, const char* err)>;
+    // Signature of ControllerLog::downloadSystemLog
+    using Downloader = std::function<bool(const std::string& robot_ip, const std::string& password,
+                                          const std::string& path, std::function<void(int, int, const char*)> cb)>;
+
+    /**
+     * @param workers Largest number of concurrent downloads
+     * @param downloader Transfer function, ControllerLog::downloadSystemLog by default
+     */
+    explicit ControllerLogFleet(int workers = 4, Downloader downloader = nullptr);
+
+    void setWorkers(int workers) { workers_ = workers > 0 ? workers : 1; }
+    int getWorkers() const { return workers_; }
+
+    /**
+     * @brief Set the number of retries of a failed download. Default 1.
+     */
+    void setRetries(int retries) { retries_ = retries > 0 ? retries : 0; }
+    int getRetries() const { return retries_; }
+
+    /**
+     * @brief Set the minimum interval between two progress reports of a download. Default 200 ms.
+     */
+    void setProgressInterval(int interval_ms) { progress_interval_ms_ = interval_ms > 0 ? interval_ms : 0; }
+    int getProgressInterval() const { return progress_interval_ms_; }
+
+    /**
+     * @brief Skip the robots whose log file already exists. Default true.
+     */
+    void setResume(bool resume) { resume_ = resume; }
+    bool getResume() const { return resume_; }
+
+    void setProgressCallback(ProgressCallback cb);
+
+    /**
+     * @brief Download every job and wait for the end. Only one run at a time.
+     *
+     * @return Result of each job, in the order of `jobs`
+     */
+    std::vector<Result> run(const std::vector<Job>& jobs);
+
+    /**
+     * @brief Stop the current run: pending jobs and retries are cancelled, transfers in progress finish.
+     */
+    void cancel();
+
+    /**
+     * @brief Snapshot of the results of the current or last run.
+     */
+    std::vector<Result> progress() const;
+
+   private:
+    void runJob(size_t index, const Job& job);
+
+    Downloader downloader_;
+    std::atomic<int> workers_;
+    std::atomic<int> retries_{1};
+    std::atomic<int> progress_interval_ms_{200};
+    std::atomic<bool> resume_{true};
+
+    std::mutex run_mutex_;
+    std::atomic<bool> cancelled_{false};
+    std::mutex cancel_mutex_;
+    std::condition_variable cancel_cv_;
+
+    mutable std::mutex results_mutex_;
+    std::vector<Result> results_;
+
+    std::mutex callback_mutex_;
+    std::shared_ptr<const ProgressCallback> callback_;
+    // Serializes the progress reports of the workers
+    std::mutex report_mutex_;
+};
@@ -2,11 +2,105 @@
 // Copyright (c) 2025, Elite Robots.
 #include "ControllerLogWrapper.hpp"
 #include <pybind11/functional.h>
+#include <pybind11/stl.h>
+#include "ControllerLogFleet.hpp"
 #include "Elite/ControllerLog.hpp"
+#include "GilSafeObject.hpp"
 
 using namespace ELITE;
 namespace py = pybind11;
 
+static void bindControllerLogFleet(py::module_& m) {
+    py::class_<ControllerLogFleet> fleet(
+        m, "ControllerLogFleet",
+        "Download the system logs of many robots concurrently, with a bounded number of workers, retries and resume.");
+
+    py::enum_<ControllerLogFleet::JobState>(fleet, "JobState", py::arithmetic())
+        .value("PENDING", ControllerLogFleet::JobState::PENDING)
+        .value("RUNNING", ControllerLogFleet::JobState::RUNNING)
+        .value("DONE", ControllerLogFleet::JobState::DONE)
+        .value("SKIPPED", ControllerLogFleet::JobState::SKIPPED)
+        .value("FAILED", ControllerLogFleet::JobState::FAILED)
+        .value("CANCELLED", ControllerLogFleet::JobState::CANCELLED)
+        .export_values();
+
+    py::class_<ControllerLogFleet::Result>(fleet, "Result")
+        .def_readonly("state", &ControllerLogFleet::Result::state)
+        .def_readonly("attempts", &ControllerLogFleet::Result::attempts)
+        .def_readonly("total", &ControllerLogFleet::Result::total)
+        .def_readonly("received", &ControllerLogFleet::Result::received)
+        .def_readonly("error", &ControllerLogFleet::Result::error)
+        .def_readonly("elapsed", &ControllerLogFleet::Result::elapsed)
+        .def("__repr__", [](const ControllerLogFleet::Result& r) {
+            return py::str("<ControllerLogFleet.Result state={} attempts={} received={}/{} error='{}'>")
+                .format(r.state, r.attempts, r.received, r.total, r.error);
+        });
+
+    fleet.def(py::init<int>(), py::arg("workers") = 4)
+        .def("setWorkers", &ControllerLogFleet::setWorkers, py::arg("workers"),
+             "Set the largest number of concurrent downloads.")
+        .def("getWorkers", &ControllerLogFleet::getWorkers)
+        .def("setRetries", &ControllerLogFleet::setRetries, py::arg("retries"),
+             "Set the number of retries of a failed download. Default 1.")
+        .def("getRetries", &ControllerLogFleet::getRetries)
+        .def("setProgressInterval", &ControllerLogFleet::setProgressInterval, py::arg("interval_ms"),
+             "Set the minimum interval between two progress reports of one download. Default 200 ms.")
+        .def("getProgressInterval", &ControllerLogFleet::getProgressInterval)
+        .def("setResume", &ControllerLogFleet::setResume, py::arg("resume"),
+             "Skip the robots whose log file already exists. Default True.")
+        .def("getResume", &ControllerLogFleet::getResume)
+        .def(
+            "setProgressCallback",
+            [](ControllerLogFleet& self, py::object cb) {
+                if (cb.is_none()) {
+                    self.setProgressCallback(nullptr);
+                    return;
+                }
+                auto cb_ptr = makeGilSafe(std::move(cb));
+                self.setProgressCallback([cb_ptr](size_t job, int total, int received, const char* err) {
+                    py::gil_scoped_acquire gil;
+                    try {
+                        (*cb_ptr)(job, total, received, err ? py::object(py::str(err)) : py::none());
+                    } catch (const py::error_already_set& e) {
+                        py::print("Python callback raised exception:", e.what());
+                    }
+                });
+            },
+            py::arg("cb"),
+            R"doc(
+                Register the progress callback, called from the worker threads at the progress interval.
+
+                Args:
+                    cb (Callable[[int, int, int, Optional[str]], None]): Receives the job index, the file size, the
+                        downloaded size and the error message. None removes the callback.
+            )doc")
+        .def(
+            "download",
+            [](ControllerLogFleet& self, const std::vector<std::tuple<std::string, std::string, std::string>>& jobs) {
+                std::vector<ControllerLogFleet::Job> list;
+                list.reserve(jobs.size());
+                for (const auto& j : jobs) {
+                    list.push_back({std::get<0>(j), std::get<1>(j), std::get<2>(j)});
+                }
+                py::gil_scoped_release release;
+                return self.run(list);
+            },
+            py::arg("jobs"),
+            R"doc(
+                Download the logs and wait for the end. The GIL is released during the downloads.
+
+                Each log is written to `<path>.part` and renamed to `<path>` once complete.
+
+                Args:
+                    jobs (list[tuple[str, str, str]]): (robot_ip, password, path) of each robot
+                Returns:
+                    list[ControllerLogFleet.Result]: Result of each job, in the order of `jobs`
+            )doc")
+        .def("cancel", &ControllerLogFleet::cancel,
+             "Cancel the pending jobs and retries of the current download. Transfers in progress finish.")
+        .def("getProgress", &ControllerLogFleet::progress, "Snapshot of the results of the current or last download.");
+}
+
 void bindControllerLog(py::module_& m) {
     py::class_<ControllerLog>(m, "ControllerLog")
         .def(py::init<>())
@@ -15,16 +109,32 @@ void bindControllerLog(py::module_& m) {
             [](const std::string& robot_ip,
                const std::string& password,
                const std::string& path,
-               std::function<void(int, int, const char*)> cb) {
-                // Note: if err == nullptr, Python will receive None
-                return ControllerLog::downloadSystemLog(robot_ip, password, path, std::move(cb));
+               py::object cb,
+               int progress_interval_ms) {
+                // Only the reports that pass the throttle take the GIL
+                ProgressThrottle throttle(progress_interval_ms);
+                auto progress = [&cb, &throttle](int f_z, int r_z, const char* err) {
+                    if (cb.is_none() || !throttle.shouldReport(f_z, r_z, err)) {
+                        return;
+                    }
+                    py::gil_scoped_acquire gil;
+                    try {
+                        // Note: if err == nullptr, Python will receive None
+                        cb(f_z, r_z, err ? py::object(py::str(err)) : py::none());
+                    } catch (const py::error_already_set& e) {
+                        py::print("Python callback raised exception:", e.what());
+                    }
+                };
+                py::gil_scoped_release release;
+                return ControllerLog::downloadSystemLog(robot_ip, password, path, progress);
             },
             py::arg("robot_ip"),
             py::arg("password"),
             py::arg("path"),
             py::arg("progress_cb"),
+            py::arg("progress_interval_ms") = 100,
             R"pbdoc(
-                Download system log from the robot.
+                Download system log from the robot. The GIL is released during the transfer.
 
                 Args:
                     robot_ip (str): Robot IP address.
@@ -34,14 +144,18 @@ void bindControllerLog(py::module_& m) {
                         f_z: File size.
                         r_z: Downloaded size.
                         err: Error information (None when there is no error)
+                    progress_interval_ms (int): Minimum interval between two progress reports. Errors and the end of
+                        the transfer are always reported. 0 reports every chunk.
 
                 Returns:
                     bool: True if success, False otherwise.
-                
+
                 Note:
                     1. On Linux, if `libssh` is not installed, you need to ensure that the computer running the SDK has the `scp`, `ssh`,
                        and `sshpass` commands available.
                     2. In Windows, if libssh is not installed, then this interface will not be available.
 
             )pbdoc");
+
+    bindControllerLogFleet(m);
 }
@@ -1,76 +1,335 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2025, Elite Robots.
+#include "DashboardClientWrapper.hpp"
+#include "DashboardPipeline.hpp"
+#include "DashboardStatusPoller.hpp"
+#include "GilSafeObject.hpp"
+
 #include <Elite/DashboardClient.hpp>
 #include <Elite/DataType.hpp>
 
 #include <pybind11/pybind11.h>
+#include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
 namespace py = pybind11;
 using namespace ELITE;
 
+// Submit one command and return a concurrent.futures.Future completed by the reader thread.
+static py::object submitFuture(DashboardPipeline& self, const std::string& cmd) {
+    py::object future = py::module_::import("concurrent.futures").attr("Future")();
+    auto future_ptr = makeGilSafe(future);
+    DashboardPipeline::Callback cb = [future_ptr](bool ok, const std::string& response) {
+        py::gil_scoped_acquire gil;
+        try {
+            if (ok) {
+                future_ptr->attr("set_result")(response);
+            } else {
+                future_ptr->attr("set_exception")(py::handle(PyExc_RuntimeError)("Dashboard request failed: " + response));
+            }
+        } catch (const py::error_already_set&) {
+            // The future was cancelled by the caller
+        }
+    };
+    {
+        py::gil_scoped_release release;
+        self.submit({cmd}, {std::move(cb)});
+    }
+    return future;
+}
+
+static void bindDashboardAsyncClient(py::module_& m) {
+    py::class_<DashboardPipeline, GilReleasingPtr<DashboardPipeline>>(
+        m, "DashboardAsyncClient",
+        "Dashboard client that pipelines commands on one connection. Commands are sent without "
+        "waiting for the previous response, so querying N values costs about one round trip.")
+        .def(py::init<>())
+        .def("connect", &DashboardPipeline::connect, py::arg("ip"), py::arg("port") = 29999, py::arg("timeout_ms") = 5000,
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+                Connect to dashboard server.
+
+                Args:
+                    ip (str): server IP
+                    port (int): server port (default 29999)
+                    timeout_ms (int): connect timeout
+                Returns:
+                    bool: True on success
+            )doc")
+        .def("disconnect", &DashboardPipeline::disconnect, py::call_guard<py::gil_scoped_release>(),
+             "Disconnect from dashboard server. Pending requests fail.")
+        .def("isConnected", &DashboardPipeline::isConnected, "Check connection status.")
+        .def("setTimeout", &DashboardPipeline::setTimeout, py::arg("timeout_ms"),
+             R"doc(
+                Set the time after which an unanswered request fails. A timeout closes the connection,
+                because later responses can no longer be matched to their commands.
+
+                Args:
+                    timeout_ms (int): Request timeout, default 5000
+            )doc")
+        .def("getTimeout", &DashboardPipeline::getTimeout, "Get the request timeout in milliseconds.")
+        .def("submit", &submitFuture, py::arg("cmd"),
+             R"doc(
+                Send a raw dashboard command without waiting for the response.
+
+                Args:
+                    cmd (str): Dashboard command
+                Returns:
+                    concurrent.futures.Future: Completed with the response string, or with RuntimeError on failure.
+            )doc")
+        .def(
+            "submitAsync",
+            [](DashboardPipeline& self, const std::string& cmd) {
+                return py::module_::import("asyncio").attr("wrap_future")(submitFuture(self, cmd));
+            },
+            py::arg("cmd"),
+            R"doc(
+                Same as submit(), returns an asyncio future bound to the running event loop.
+
+                Args:
+                    cmd (str): Dashboard command
+                Returns:
+                    asyncio.Future: Awaitable response string
+            )doc")
+        .def(
+            "sendAndReceive",
+            [](DashboardPipeline& self, const std::string& cmd) { return self.sendAndReceive({cmd}).front(); },
+            py::arg("cmd"), py::call_guard<py::gil_scoped_release>(),
+            R"doc(
+                Send a raw dashboard command and wait for the response.
+
+                Args:
+                    cmd (str): Dashboard command
+                Returns:
+                    str: The response
+            )doc")
+        .def("sendAndReceiveBatch", &DashboardPipeline::sendAndReceive, py::arg("cmds"),
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+                Send several raw dashboard commands in one write and wait for all responses.
+
+                Args:
+                    cmds (list[str]): Dashboard commands
+                Returns:
+                    list[str]: The responses, in the order of `cmds`
+            )doc");
+}
+
+// Convert a cached poller value to the Python type of the matching DashboardClientInterface method.
+static py::object statusToPython(DashboardQuery query, const DashboardStatusValue& value) {
+    if (!value.valid) {
+        return py::none();
+    }
+    const int code = static_cast<int>(value.value);
+    switch (query) {
+        case DashboardQuery::ROBOT_MODE:
+            return py::cast(static_cast<RobotMode>(code));
+        case DashboardQuery::SAFETY_MODE:
+            return py::cast(static_cast<SafetyMode>(code));
+        case DashboardQuery::RUNNING_STATUS:
+        case DashboardQuery::TASK_STATUS:
+            return py::cast(static_cast<TaskStatus>(code));
+        case DashboardQuery::TASK_IS_RUNNING:
+            return py::bool_(code != 0);
+        default:
+            return py::float_(value.value);
+    }
+}
+
+static void bindDashboardStatusPoller(py::module_& m) {
+    py::enum_<DashboardQuery>(m, "DashboardQuery", py::arithmetic())
+        .value("ROBOT_MODE", DashboardQuery::ROBOT_MODE, "robotMode()")
+        .value("SAFETY_MODE", DashboardQuery::SAFETY_MODE, "safetyMode()")
+        .value("RUNNING_STATUS", DashboardQuery::RUNNING_STATUS, "runningStatus()")
+        .value("TASK_STATUS", DashboardQuery::TASK_STATUS, "getTaskStatus()")
+        .value("TASK_IS_RUNNING", DashboardQuery::TASK_IS_RUNNING, "taskIsRunning()")
+        .value("SPEED_SCALING", DashboardQuery::SPEED_SCALING, "speedScaling()")
+        .export_values();
+
+    auto cached = [](DashboardQuery query) {
+        return [query](const DashboardStatusPoller& self) { return statusToPython(query, self.get(query)); };
+    };
+
+    py::class_<DashboardStatusPoller, GilReleasingPtr<DashboardStatusPoller>>(
+        m, "DashboardStatusPoller",
+        "Refreshes a set of dashboard queries from a background thread on one connection. "
+        "Getters return the cached values without any network I/O.")
+        .def(py::init<>())
+        .def("start", &DashboardStatusPoller::start, py::arg("ip"), py::arg("port") = 29999,
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+                Connect to the dashboard server and start polling. A lost connection is retried every second.
+
+                Args:
+                    ip (str): server IP
+                    port (int): server port (default 29999)
+                Returns:
+                    bool: True if the first connection succeeded. Polling starts in any case.
+            )doc")
+        .def("stop", &DashboardStatusPoller::stop, py::call_guard<py::gil_scoped_release>(),
+             "Stop polling and disconnect. Blocks until the polling thread exits.")
+        .def("isRunning", &DashboardStatusPoller::isRunning, "Check whether the polling thread is running.")
+        .def("isConnected", &DashboardStatusPoller::isConnected, "Check whether the dashboard connection is up.")
+        .def("setQueries", &DashboardStatusPoller::setQueries, py::arg("queries"),
+             R"doc(
+                Set the queries refreshed every cycle. Default: all queries.
+
+                Args:
+                    queries (list[DashboardQuery]): Queries to refresh
+            )doc")
+        .def("getQueries", &DashboardStatusPoller::getQueries, "Get the queries refreshed every cycle.")
+        .def("setRate", &DashboardStatusPoller::setRate, py::arg("hz"),
+             R"doc(
+                Set the polling rate, effective immediately. Every cycle costs one round trip per query. Default 10 Hz.
+
+                Args:
+                    hz (float): Polling rate
+            )doc")
+        .def("getRate", &DashboardStatusPoller::getRate, "Get the polling rate in Hz.")
+        .def(
+            "setChangeCallback",
+            [](DashboardStatusPoller& self, py::object cb) {
+                if (cb.is_none()) {
+                    self.setChangeCallback(nullptr);
+                    return;
+                }
+                auto cb_ptr = makeGilSafe(std::move(cb));
+                self.setChangeCallback([cb_ptr](DashboardQuery query, const DashboardStatusValue& value) {
+                    py::gil_scoped_acquire gil;
+                    try {
+                        (*cb_ptr)(query, statusToPython(query, value), value.timestamp);
+                    } catch (const py::error_already_set& e) {
+                        py::print("Python callback raised exception:", e.what());
+                    }
+                });
+            },
+            py::arg("cb"),
+            R"doc(
+                Register a callback invoked on the polling thread when a value changes, or becomes valid or invalid.
+
+                Args:
+                    cb (Callable[[DashboardQuery, object, float], None]): Receives the query, the new value (None when
+                        the connection is lost) and the time of the refresh. Pass None to remove the callback.
+            )doc")
+        .def(
+            "get",
+            [](const DashboardStatusPoller& self, DashboardQuery query) { return statusToPython(query, self.get(query)); },
+            py::arg("query"),
+            R"doc(
+                Get the cached value of a query.
+
+                Args:
+                    query (DashboardQuery): The query
+                Returns:
+                    object: The value, with the type returned by the matching DashboardClientInterface method.
+                        None if the value has not been refreshed yet or the connection is lost.
+            )doc")
+        .def(
+            "getTimestamp",
+            [](const DashboardStatusPoller& self, DashboardQuery query) -> py::object {
+                auto value = self.get(query);
+                return value.valid ? py::object(py::float_(value.timestamp)) : py::none();
+            },
+            py::arg("query"),
+            R"doc(
+                Get the time of the last refresh of a query, on the steady clock of the SDK. On Linux this is the clock
+                of `time.monotonic()`; other platforms may use another clock.
+
+                Args:
+                    query (DashboardQuery): The query
+                Returns:
+                    float: Time in seconds, None if the value is not valid.
+            )doc")
+        .def("robotMode", cached(DashboardQuery::ROBOT_MODE), "Cached robot mode, None if not available")
+        .def("safetyMode", cached(DashboardQuery::SAFETY_MODE), "Cached safety mode, None if not available")
+        .def("runningStatus", cached(DashboardQuery::RUNNING_STATUS), "Cached running status, None if not available")
+        .def("getTaskStatus", cached(DashboardQuery::TASK_STATUS), "Cached task status, None if not available")
+        .def("taskIsRunning", cached(DashboardQuery::TASK_IS_RUNNING), "Cached task running flag, None if not available")
+        .def("speedScaling", cached(DashboardQuery::SPEED_SCALING), "Cached speed scaling, None if not available");
+}
+
 void bindDashboardClient(py::module_& m) {
     py::class_<DashboardClient>(m, "DashboardClientInterface")
         .def(py::init<>())
         .def("connect", &DashboardClient::connect, py::arg("ip"), py::arg("port") = 29999,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
                 Connect to dashboard server.
                 :param ip: server IP
                 :param port: server port (default 29999)
                 :returns: True on success, False on failure
              )doc")
-        .def("disconnect", &DashboardClient::disconnect,
+        .def("disconnect", &DashboardClient::disconnect, py::call_guard<py::gil_scoped_release>(),
              R"doc(
                 Disconnect from dashboard server.
              )doc")
 
-        .def("brakeRelease", &DashboardClient::brakeRelease, "Release brakes, returns True on success")
-        .def("closeSafetyDialog", &DashboardClient::closeSafetyDialog, "Close safety dialog, returns True on success")
-        .def("echo", &DashboardClient::echo, "Send echo to check connection, returns True on success")
-        .def("help", &DashboardClient::help, py::arg("cmd"), "Get help string for `cmd`")
-        .def("log", &DashboardClient::log, py::arg("message"), "Add a log message")
+        .def("brakeRelease", &DashboardClient::brakeRelease, py::call_guard<py::gil_scoped_release>(),
+             "Release brakes, returns True on success")
+        .def("closeSafetyDialog", &DashboardClient::closeSafetyDialog, py::call_guard<py::gil_scoped_release>(),
+             "Close safety dialog, returns True on success")
+        .def("echo", &DashboardClient::echo, py::call_guard<py::gil_scoped_release>(),
+             "Send echo to check connection, returns True on success")
+        .def("help", &DashboardClient::help, py::arg("cmd"), py::call_guard<py::gil_scoped_release>(), "Get help string for `cmd`")
+        .def("log", &DashboardClient::log, py::arg("message"), py::call_guard<py::gil_scoped_release>(), "Add a log message")
         .def("popup", &DashboardClient::popup, py::arg("arg"), py::arg("message") = "",
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
                 Popup or close message box.
                 arg: '-s' to show, '-c' to close
              )doc")
-        .def("quit", &DashboardClient::quit, "Quit dashboard and disconnect")
-        .def("reboot", &DashboardClient::reboot, "Reboot robot and disconnect")
+        .def("quit", &DashboardClient::quit, py::call_guard<py::gil_scoped_release>(), "Quit dashboard and disconnect")
+        .def("reboot", &DashboardClient::reboot, py::call_guard<py::gil_scoped_release>(), "Reboot robot and disconnect")
 
-        .def("robotType", &DashboardClient::robotType, "Get robot type")
-        .def("robotSerialNumber", &DashboardClient::robotSerialNumber, "Get robot serial number")
-        .def("robotID", &DashboardClient::robotID, "Get robot ID")
+        .def("robotType", &DashboardClient::robotType, py::call_guard<py::gil_scoped_release>(), "Get robot type")
+        .def("robotSerialNumber", &DashboardClient::robotSerialNumber, py::call_guard<py::gil_scoped_release>(),
+             "Get robot serial number")
+        .def("robotID", &DashboardClient::robotID, py::call_guard<py::gil_scoped_release>(), "Get robot ID")
 
-        .def("powerOn", &DashboardClient::powerOn, "Power on robot")
-        .def("powerOff", &DashboardClient::powerOff, "Power off robot")
-        .def("shutdown", &DashboardClient::shutdown, "Shutdown robot and disconnect")
+        .def("powerOn", &DashboardClient::powerOn, py::call_guard<py::gil_scoped_release>(), "Power on robot")
+        .def("powerOff", &DashboardClient::powerOff, py::call_guard<py::gil_scoped_release>(), "Power off robot")
+        .def("shutdown", &DashboardClient::shutdown, py::call_guard<py::gil_scoped_release>(), "Shutdown robot and disconnect")
 
-        .def("speedScaling", &DashboardClient::speedScaling, "Get speed scaling [0, 100]%)")
-        .def("setSpeedScaling", &DashboardClient::setSpeedScaling, py::arg("scaling"), "Set speed scaling [0, 100]%")
+        .def("speedScaling", &DashboardClient::speedScaling, py::call_guard<py::gil_scoped_release>(),
+             "Get speed scaling [0, 100]%)")
+        .def("setSpeedScaling", &DashboardClient::setSpeedScaling, py::arg("scaling"), py::call_guard<py::gil_scoped_release>(),
+             "Set speed scaling [0, 100]%")
 
-        .def("robotMode", &DashboardClient::robotMode, "Get current robot mode")
-        .def("safetyMode", &DashboardClient::safetyMode, "Get current safety mode")
-        .def("safetySystemRestart", &DashboardClient::safetySystemRestart, "Restart safety system")
-        .def("runningStatus", &DashboardClient::runningStatus, "Get current task status")
-        .def("unlockProtectiveStop", &DashboardClient::unlockProtectiveStop, "Unlock protective stop")
+        .def("robotMode", &DashboardClient::robotMode, py::call_guard<py::gil_scoped_release>(), "Get current robot mode")
+        .def("safetyMode", &DashboardClient::safetyMode, py::call_guard<py::gil_scoped_release>(), "Get current safety mode")
+        .def("safetySystemRestart", &DashboardClient::safetySystemRestart, py::call_guard<py::gil_scoped_release>(),
+             "Restart safety system")
+        .def("runningStatus", &DashboardClient::runningStatus, py::call_guard<py::gil_scoped_release>(), "Get current task status")
+        .def("unlockProtectiveStop", &DashboardClient::unlockProtectiveStop, py::call_guard<py::gil_scoped_release>(),
+             "Unlock protective stop")
 
-        .def("usage", &DashboardClient::usage, py::arg("cmd"), "Get usage for dashboard command")
-        .def("version", &DashboardClient::version, "Get dashboard version info")
+        .def("usage", &DashboardClient::usage, py::arg("cmd"), py::call_guard<py::gil_scoped_release>(),
+             "Get usage for dashboard command")
+        .def("version", &DashboardClient::version, py::call_guard<py::gil_scoped_release>(), "Get dashboard version info")
 
-        .def("loadConfiguration", &DashboardClient::loadConfiguration, py::arg("path"), "Load robot configuration from path")
-        .def("configurationPath", &DashboardClient::configurationPath, "Get current configuration path")
-        .def("isConfigurationModify", &DashboardClient::isConfigurationModify, "Check if configuration has been modified")
+        .def("loadConfiguration", &DashboardClient::loadConfiguration, py::arg("path"), py::call_guard<py::gil_scoped_release>(),
+             "Load robot configuration from path")
+        .def("configurationPath", &DashboardClient::configurationPath, py::call_guard<py::gil_scoped_release>(),
+             "Get current configuration path")
+        .def("isConfigurationModify", &DashboardClient::isConfigurationModify, py::call_guard<py::gil_scoped_release>(),
+             "Check if configuration has been modified")
 
-        .def("playProgram", &DashboardClient::playProgram, "Play loaded program")
-        .def("pauseProgram", &DashboardClient::pauseProgram, "Pause running program")
-        .def("stopProgram", &DashboardClient::stopProgram, "Stop running program")
+        .def("playProgram", &DashboardClient::playProgram, py::call_guard<py::gil_scoped_release>(), "Play loaded program")
+        .def("pauseProgram", &DashboardClient::pauseProgram, py::call_guard<py::gil_scoped_release>(), "Pause running program")
+        .def("stopProgram", &DashboardClient::stopProgram, py::call_guard<py::gil_scoped_release>(), "Stop running program")
 
-        .def("getTaskPath", &DashboardClient::getTaskPath, "Get current task path")
-        .def("loadTask", &DashboardClient::loadTask, py::arg("path"), "Load task from path")
-        .def("getTaskStatus", &DashboardClient::getTaskStatus, "Get status of current task")
-        .def("taskIsRunning", &DashboardClient::taskIsRunning, "Check if task is running")
-        .def("isTaskSaved", &DashboardClient::isTaskSaved, "Check if task is saved")
+        .def("getTaskPath", &DashboardClient::getTaskPath, py::call_guard<py::gil_scoped_release>(), "Get current task path")
+        .def("loadTask", &DashboardClient::loadTask, py::arg("path"), py::call_guard<py::gil_scoped_release>(),
+             "Load task from path")
+        .def("getTaskStatus", &DashboardClient::getTaskStatus, py::call_guard<py::gil_scoped_release>(),
+             "Get status of current task")
+        .def("taskIsRunning", &DashboardClient::taskIsRunning, py::call_guard<py::gil_scoped_release>(), "Check if task is running")
+        .def("isTaskSaved", &DashboardClient::isTaskSaved, py::call_guard<py::gil_scoped_release>(), "Check if task is saved")
 
         .def("sendAndReceive", &DashboardClient::sendAndReceive, py::arg("cmd"),
+             py::call_guard<py::gil_scoped_release>(),
              "Send a raw dashboard command and receive response");
+
+    bindDashboardAsyncClient(m);
+    bindDashboardStatusPoller(m);
 }
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "DashboardPipeline.hpp"
+
+#include <future>
+#include <memory>
+#include <stdexcept>
+
+namespace {
+
+// Poll period of the reader thread, bounds how late a timeout is detected.
+constexpr int READER_POLL_MS = 20;
+
+// Read one line from the socket, used before the reader thread starts.
+bool readLine(TcpSocket& socket, std::string& line, int timeout_ms) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    line.clear();
+    char c;
+    while (std::chrono::steady_clock::now() < deadline) {
+        int n = socket.read(&c, 1, READER_POLL_MS);
+        if (n < 0) {
+            return false;
+        }
+        if (n == 0) {
+            continue;
+        }
+        if (c == '\n') {
+            return true;
+        }
+        line.push_back(c);
+    }
+    return false;
+}
+
+}  // namespace
+
+DashboardPipeline::~DashboardPipeline() {
+    disconnect();
+    if (reader_.joinable()) {
+        // Destroyed from a completion callback: the reader keeps the state and stops when the callback returns
+        reader_.detach();
+    }
+}
+
+bool DashboardPipeline::connect(const std::string& ip, int port, int timeout_ms) {
+    if (reader_.get_id() == std::this_thread::get_id()) {
+        // A completion callback: the reader thread cannot be joined before it returns
+        return false;
+    }
+    disconnect();
+    if (!state_->socket.connect(ip, port, timeout_ms)) {
+        return false;
+    }
+    std::string welcome;
+    if (!readLine(state_->socket, welcome, timeout_ms)) {
+        state_->socket.close();
+        return false;
+    }
+    state_->running = true;
+    reader_ = std::thread(&DashboardPipeline::readerLoop, state_);
+    return true;
+}
+
+void DashboardPipeline::disconnect() {
+    state_->running = false;
+    // Only shut the socket down while the reader may still poll it, the handle is released once it is gone
+    state_->socket.shutdown();
+    // From a completion callback, which runs on the reader thread, the join and the release are left to the next
+    // connect() or the destructor
+    if (reader_.joinable() && reader_.get_id() != std::this_thread::get_id()) {
+        reader_.join();
+    }
+    if (!reader_.joinable()) {
+        std::lock_guard<std::mutex> write_lock(state_->write_mutex);
+        state_->socket.close();
+    }
+    state_->failAll("disconnected");
+}
+
+bool DashboardPipeline::submit(const std::vector<std::string>& cmds, std::vector<Callback> callbacks) {
+    std::string payload;
+    for (const auto& cmd : cmds) {
+        payload += cmd;
+        payload += '\n';
+    }
+
+    State& state = *state_;
+    std::unique_lock<std::mutex> write_lock(state.write_mutex);
+    if (!state.running || !state.socket.isOpen()) {
+        write_lock.unlock();
+        for (auto& cb : callbacks) cb(false, "not connected");
+        return false;
+    }
+    const uint64_t batch = ++state.next_batch;
+    {
+        std::lock_guard<std::mutex> lock(state.pending_mutex);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(state.timeout_ms.load());
+        for (auto& cb : callbacks) {
+            state.pending.push_back(Pending{std::move(cb), deadline, batch});
+        }
+    }
+    if (!state.socket.writeAll(payload.data(), payload.size())) {
+        write_lock.unlock();
+        // The reader thread owns the handle, it fails the other requests when it sees the connection go down
+        state.socket.shutdown();
+        std::deque<Pending> failed;
+        {
+            std::lock_guard<std::mutex> lock(state.pending_mutex);
+            for (auto it = state.pending.begin(); it != state.pending.end();) {
+                if (it->batch == batch) {
+                    failed.push_back(std::move(*it));
+                    it = state.pending.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        for (auto& p : failed) {
+            p.callback(false, "write failed");
+        }
+        return false;
+    }
+    return true;
+}
+
+std::vector<std::string> DashboardPipeline::sendAndReceive(const std::vector<std::string>& cmds) {
+    // The callbacks may run after this function threw on an earlier failure, they share the promises
+    auto promises = std::make_shared<std::vector<std::promise<std::string>>>(cmds.size());
+    std::vector<std::future<std::string>> futures;
+    std::vector<Callback> callbacks;
+    futures.reserve(cmds.size());
+    callbacks.reserve(cmds.size());
+    for (size_t i = 0; i < cmds.size(); ++i) {
+        futures.push_back((*promises)[i].get_future());
+        callbacks.emplace_back([promises, i](bool ok, const std::string& response) {
+            auto& p = (*promises)[i];
+            if (ok) {
+                p.set_value(response);
+            } else {
+                p.set_exception(std::make_exception_ptr(std::runtime_error("Dashboard request failed: " + response)));
+            }
+        });
+    }
+    submit(cmds, std::move(callbacks));
+
+    std::vector<std::string> responses;
+    responses.reserve(cmds.size());
+    for (auto& f : futures) {
+        responses.push_back(f.get());
+    }
+    return responses;
+}
+
+void DashboardPipeline::State::failAll(const std::string& reason) {
+    std::deque<Pending> failed;
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex);
+        failed.swap(pending);
+    }
+    for (auto& p : failed) {
+        p.callback(false, reason);
+    }
+}
+
+void DashboardPipeline::readerLoop(std::shared_ptr<State> state) {
+    std::string buffer;
+    char chunk[4096];
+    while (state->running) {
+        int n = state->socket.read(chunk, sizeof(chunk), READER_POLL_MS);
+        if (n < 0) {
+            state->socket.shutdown();
+            state->failAll("disconnected");
+            break;
+        }
+        buffer.append(chunk, static_cast<size_t>(n));
+
+        size_t start = 0, end;
+        while ((end = buffer.find('\n', start)) != std::string::npos) {
+            std::string line = buffer.substr(start, end - start);
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            start = end + 1;
+
+            Pending pending;
+            {
+                std::lock_guard<std::mutex> lock(state->pending_mutex);
+                if (state->pending.empty()) {
+                    continue;  // Unsolicited line, nothing waits for it
+                }
+                pending = std::move(state->pending.front());
+                state->pending.pop_front();
+            }
+            pending.callback(true, line);
+        }
+        buffer.erase(0, start);
+
+        bool expired = false;
+        {
+            std::lock_guard<std::mutex> lock(state->pending_mutex);
+            expired = !state->pending.empty() && state->pending.front().deadline < std::chrono::steady_clock::now();
+        }
+        if (expired) {
+            // Responses can no longer be matched to requests, drop the connection
+            state->socket.shutdown();
+            state->failAll("timeout");
+            break;
+        }
+    }
+}
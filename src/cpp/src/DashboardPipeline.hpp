@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include "TcpSocket.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Dashboard connection that pipelines requests.
+ *
+ * Commands are written to the socket as soon as they are submitted, without waiting for the previous response. The
+ * dashboard server answers every command with one line, in order, so responses are matched to requests by position.
+ * A background thread reads the responses and completes the requests.
+ */
+class DashboardPipeline {
+   public:
+    /**
+     * @brief Completion callback, called on the reader thread.
+     *
+     * @param ok False if the request failed (timeout or disconnection), `response` then holds the reason.
+     * @param response The response line without the line terminator
+     */
+    using Callback = std::function<void(bool ok, const std::string& response)>;
+
+    DashboardPipeline() = default;
+    ~DashboardPipeline();
+
+    /**
+     * @brief Connect to the dashboard server and consume its welcome message.
+     *
+     * @return false if the connection failed, or if called from a completion callback
+     */
+    bool connect(const std::string& ip, int port, int timeout_ms);
+
+    /**
+     * @brief Disconnect. Pending requests fail with "disconnected".
+     *
+     * From a completion callback, the reader thread stops when the callback returns; the next connect() or the
+     * destructor joins it.
+     */
+    void disconnect();
+
+    bool isConnected() const { return state_->running && state_->socket.isOpen(); }
+
+    /**
+     * @brief Set the time after which an unanswered request fails. A timeout closes the connection, because later
+     * responses can no longer be matched.
+     */
+    void setTimeout(int timeout_ms) { state_->timeout_ms = timeout_ms; }
+
+    int getTimeout() const { return state_->timeout_ms; }
+
+    /**
+     * @brief Send several commands in one write.
+     *
+     * @param cmds Dashboard commands, without line terminator
+     * @param callbacks One callback per command
+     * @return false if not connected or the write failed. Callbacks of a failed write are called with ok = false.
+     */
+    bool submit(const std::vector<std::string>& cmds, std::vector<Callback> callbacks);
+
+    /**
+     * @brief Send several commands and wait for all responses, about one round trip in total.
+     *
+     * @param cmds Dashboard commands
+     * @return The responses, in order
+     * @throws std::runtime_error if a request fails
+     */
+    std::vector<std::string> sendAndReceive(const std::vector<std::string>& cmds);
+
+   private:
+    struct Pending {
+        Callback callback;
+        std::chrono::steady_clock::time_point deadline;
+        uint64_t batch = 0;  // submit() call that queued the request
+    };
+
+    // Everything the reader thread uses. The reader holds a reference, so a pipeline destroyed from a completion
+    // callback leaves it a valid state until the callback returns.
+    struct State {
+        TcpSocket socket;
+        std::atomic<bool> running{false};
+        std::atomic<int> timeout_ms{5000};
+
+        // write_mutex orders writes with their pending entries, pending_mutex protects the queue itself
+        std::mutex write_mutex;
+        std::mutex pending_mutex;
+        std::deque<Pending> pending;
+        uint64_t next_batch = 0;  // Guarded by write_mutex
+
+        void failAll(const std::string& reason);
+    };
+
+    static void readerLoop(std::shared_ptr<State> state);
+
+    std::shared_ptr<State> state_ = std::make_shared<State>();
+    std::thread reader_;
+};
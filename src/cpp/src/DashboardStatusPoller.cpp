@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "DashboardStatusPoller.hpp"
+#include "SamplingUtils.hpp"
+
+#include <Elite/Log.hpp>
+
+#include <chrono>
+
+using namespace ELITE;
+
+namespace {
+
+// Delay between two reconnection attempts.
+constexpr int RECONNECT_INTERVAL_MS = 1000;
+
+}  // namespace
+
+DashboardStatusPoller::DashboardStatusPoller() { enabled_.fill(true); }
+
+DashboardStatusPoller::~DashboardStatusPoller() { stop(); }
+
+bool DashboardStatusPoller::start(const std::string& ip, int port) {
+    stop();
+    ip_ = ip;
+    port_ = port;
+    client_ = std::make_unique<DashboardClient>();
+    connected_ = client_->connect(ip_, port_);
+    running_ = true;
+    thread_ = std::thread(&DashboardStatusPoller::pollLoop, this);
+    return connected_;
+}
+
+void DashboardStatusPoller::stop() {
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        running_ = false;
+    }
+    wait_cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    if (client_) {
+        client_->disconnect();
+        client_.reset();
+    }
+    connected_ = false;
+}
+
+void DashboardStatusPoller::setQueries(const std::vector<DashboardQuery>& queries) {
+    std::lock_guard<std::mutex> lock(config_mutex_);
+    enabled_.fill(false);
+    for (auto q : queries) {
+        if (q != DashboardQuery::COUNT) {
+            enabled_[static_cast<size_t>(q)] = true;
+        }
+    }
+}
+
+std::vector<DashboardQuery> DashboardStatusPoller::getQueries() const {
+    std::lock_guard<std::mutex> lock(config_mutex_);
+    std::vector<DashboardQuery> queries;
+    for (size_t i = 0; i < enabled_.size(); ++i) {
+        if (enabled_[i]) {
+            queries.push_back(static_cast<DashboardQuery>(i));
+        }
+    }
+    return queries;
+}
+
+void DashboardStatusPoller::setRate(double hz) {
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        rate_hz_ = hz > 0 ? hz : 10.0;
+        rate_changed_ = true;
+    }
+    wait_cv_.notify_all();
+}
+
+void DashboardStatusPoller::setChangeCallback(ChangeCallback cb) {
+    std::lock_guard<std::mutex> lock(config_mutex_);
+    change_cb_ = std::move(cb);
+}
+
+DashboardStatusValue DashboardStatusPoller::get(DashboardQuery query) const {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    return cache_[static_cast<size_t>(query)];
+}
+
+bool DashboardStatusPoller::refresh(DashboardQuery query, double& value) {
+    switch (query) {
+        case DashboardQuery::ROBOT_MODE:
+            value = static_cast<double>(client_->robotMode());
+            return true;
+        case DashboardQuery::SAFETY_MODE:
+            value = static_cast<double>(client_->safetyMode());
+            return true;
+        case DashboardQuery::RUNNING_STATUS:
+            value = static_cast<double>(client_->runningStatus());
+            return true;
+        case DashboardQuery::TASK_STATUS:
+            value = static_cast<double>(client_->getTaskStatus());
+            return true;
+        case DashboardQuery::TASK_IS_RUNNING:
+            value = client_->taskIsRunning() ? 1.0 : 0.0;
+            return true;
+        case DashboardQuery::SPEED_SCALING:
+            value = static_cast<double>(client_->speedScaling());
+            return true;
+        default:
+            return false;
+    }
+}
+
+void DashboardStatusPoller::store(DashboardQuery query, bool valid, double value) {
+    DashboardStatusValue snapshot;
+    bool changed;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        auto& entry = cache_[static_cast<size_t>(query)];
+        changed = entry.valid != valid || (valid && entry.value != value);
+        entry.valid = valid;
+        if (valid) {
+            entry.value = value;
+            entry.timestamp = steadyNow();
+            entry.updates++;
+        }
+        snapshot = entry;
+    }
+    if (!changed) {
+        return;
+    }
+    ChangeCallback cb;
+    {
+        std::lock_guard<std::mutex> lock(config_mutex_);
+        cb = change_cb_;
+    }
+    if (cb) {
+        cb(query, snapshot);
+    }
+}
+
+void DashboardStatusPoller::pollLoop() {
+    auto next = std::chrono::steady_clock::now();
+    while (running_) {
+        if (!connected_) {
+            connected_ = client_->connect(ip_, port_);
+            if (!connected_) {
+                std::unique_lock<std::mutex> lock(wait_mutex_);
+                wait_cv_.wait_for(lock, std::chrono::milliseconds(RECONNECT_INTERVAL_MS), [this] { return !running_; });
+                continue;
+            }
+        }
+
+        std::array<bool, static_cast<size_t>(DashboardQuery::COUNT)> enabled;
+        {
+            std::lock_guard<std::mutex> lock(config_mutex_);
+            enabled = enabled_;
+        }
+        for (size_t i = 0; i < enabled.size() && running_ && connected_; ++i) {
+            if (!enabled[i]) {
+                continue;
+            }
+            const auto query = static_cast<DashboardQuery>(i);
+            double value = 0.0;
+            try {
+                if (refresh(query, value)) {
+                    store(query, true, value);
+                }
+            } catch (const std::exception& e) {
+                ELITE::log(__FILE__, __LINE__, LogLevel::ELI_WARN, "Dashboard status poller lost the connection: %s",
+                           e.what());
+                connected_ = false;
+                client_->disconnect();
+                for (size_t k = 0; k < cache_.size(); ++k) {
+                    store(static_cast<DashboardQuery>(k), false, 0.0);
+                }
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        rate_changed_ = false;
+        const auto cycle_start = next;
+        while (running_) {
+            next = cycle_start + std::chrono::microseconds(static_cast<int64_t>(1e6 / rate_hz_.load()));
+            const auto now = std::chrono::steady_clock::now();
+            if (next < now) {
+                next = now;  // Polling takes longer than the period, do not try to catch up
+            }
+            // A new rate takes effect at once: the wait restarts with the period of the new rate
+            if (!wait_cv_.wait_until(lock, next, [this] { return !running_ || rate_changed_; })) {
+                break;
+            }
+            rate_changed_ = false;
+        }
+    }
+}
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <Elite/DashboardClient.hpp>
+#include <Elite/DataType.hpp>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Dashboard values that the poller can refresh.
+ */
+enum class DashboardQuery : int {
+    ROBOT_MODE = 0,
+    SAFETY_MODE,
+    RUNNING_STATUS,
+    TASK_STATUS,
+    TASK_IS_RUNNING,
+    SPEED_SCALING,
+    COUNT
+};
+
+/**
+ * @brief Cached result of one dashboard query.
+ */
+struct DashboardStatusValue {
+    bool valid = false;     // False until the first successful refresh, and after a connection loss
+    double value = 0.0;     // Enums and booleans are stored as their integer value
+    double timestamp = 0.0; // Steady clock time of the refresh [s], the clock of Python time.monotonic() on Linux
+    uint64_t updates = 0;   // Number of successful refreshes
+};
+
+/**
+ * @brief Refresh a set of dashboard queries from a background thread on one connection, and cache the results.
+ *
+ * Readers only touch the cache, they never wait on the network. A change callback fires when a refreshed value
+ * differs from the cached one, or when the validity of a value changes.
+ */
+class DashboardStatusPoller {
+   public:
+    using ChangeCallback = std::function<void(DashboardQuery query, const DashboardStatusValue& value)>;
+
+    DashboardStatusPoller();
+    ~DashboardStatusPoller();
+
+    /**
+     * @brief Connect the internal dashboard client and start polling. The connection is retried if it is lost.
+     *
+     * @return true if the first connection succeeded
+     */
+    bool start(const std::string& ip, int port = 29999);
+
+    /**
+     * @brief Stop polling and disconnect. Blocks until the polling thread exits.
+     */
+    void stop();
+
+    bool isRunning() const { return running_; }
+
+    bool isConnected() const { return connected_; }
+
+    /**
+     * @brief Set the queries refreshed every cycle. Default: all queries.
+     */
+    void setQueries(const std::vector<DashboardQuery>& queries);
+
+    std::vector<DashboardQuery> getQueries() const;
+
+    /**
+     * @brief Set the polling rate in Hz. Default 10 Hz.
+     */
+    void setRate(double hz);
+
+    double getRate() const { return rate_hz_; }
+
+    /**
+     * @brief Set the callback invoked on the polling thread when a value changes. Pass an empty function to remove it.
+     */
+    void setChangeCallback(ChangeCallback cb);
+
+    /**
+     * @brief Read the cached value of a query.
+     */
+    DashboardStatusValue get(DashboardQuery query) const;
+
+   private:
+    void pollLoop();
+    bool refresh(DashboardQuery query, double& value);
+    void store(DashboardQuery query, bool valid, double value);
+
+    std::unique_ptr<ELITE::DashboardClient> client_;
+    std::string ip_;
+    int port_ = 29999;
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::atomic<bool> connected_{false};
+    std::atomic<double> rate_hz_{10.0};
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+    bool rate_changed_ = false;  // Guarded by wait_mutex_
+
+    mutable std::mutex config_mutex_;
+    std::array<bool, static_cast<size_t>(DashboardQuery::COUNT)> enabled_;
+    ChangeCallback change_cb_;
+
+    mutable std::mutex cache_mutex_;
+    std::array<DashboardStatusValue, static_cast<size_t>(DashboardQuery::COUNT)> cache_;
+};
@@ -0,0 +1,76 @@
+/* SPDX-License-Identifier: MIT */
+/* Copyright (c) 2025, Elite Robots. */
+/*
+ * C ABI of the control-law plugins run by elite_cs_sdk.ControlPlugin.
+ *
+ * A plugin is a shared library exporting:
+ *
+ *   uint32_t elite_control_abi_version(void);          required, returns ELITE_CONTROL_ABI_VERSION
+ *   int elite_control_step(void* context,             required, called by the real-time thread on every RTSI sample
+ *                          const EliteControlState* state,
+ *                          const double* params, uint32_t param_count,
+ *                          EliteControlOutput* out);
+ *   void* elite_control_create(uint32_t param_count);  optional, context passed to step, NULL allowed
+ *   void elite_control_destroy(void* context);         optional
+ *   const char* elite_control_name(void);              optional
+ *
+ * step() runs on a real-time thread: it must not block, allocate or take locks shared with non real-time code. A
+ * non-zero return value stops the loop, the value is reported by ControlPlugin.getStats().
+ */
+#ifndef ELITE_CONTROL_PLUGIN_H
+#define ELITE_CONTROL_PLUGIN_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ELITE_CONTROL_ABI_VERSION 1u
+#define ELITE_CONTROL_TELEMETRY_SIZE 16
+
+/* Robot state of one RTSI sample */
+typedef struct EliteControlState {
+    double timestamp; /* Controller timestamp of the sample [s] */
+    double dt;        /* Time since the previous sample [s], 0 on the first cycle */
+    uint64_t cycle;   /* Index of the call, from 0 */
+    uint64_t params_version; /* Incremented on every parameter update from Python */
+    double actual_joint_positions[6];
+    double actual_joint_velocity[6];
+    double actual_joint_torques[6];
+    double actual_tcp_pose[6];
+    double actual_tcp_velocity[6];
+    double actual_tcp_force[6];
+    double target_joint_positions[6];
+    double target_joint_velocity[6];
+} EliteControlState;
+
+typedef enum EliteControlCommand {
+    ELITE_CONTROL_NONE = 0,            /* Send nothing this cycle */
+    ELITE_CONTROL_SERVOJ = 1,          /* writeServoj(values) with joint positions */
+    ELITE_CONTROL_SERVOJ_CARTESIAN = 2, /* writeServoj(values, cartesian=True) with a TCP pose */
+    ELITE_CONTROL_SPEEDJ = 3,          /* writeSpeedj(values) */
+    ELITE_CONTROL_SPEEDL = 4,          /* writeSpeedl(values) */
+    ELITE_CONTROL_IDLE = 5,            /* writeIdle() */
+} EliteControlCommand;
+
+/* Command of one cycle, zeroed before each call */
+typedef struct EliteControlOutput {
+    int32_t command;    /* EliteControlCommand */
+    int32_t timeout_ms; /* Read timeout of the robot side, 0 uses the runner default */
+    double values[6];
+    double telemetry[ELITE_CONTROL_TELEMETRY_SIZE]; /* Free values published to Python */
+} EliteControlOutput;
+
+typedef uint32_t (*EliteControlAbiVersionFn)(void);
+typedef void* (*EliteControlCreateFn)(uint32_t param_count);
+typedef void (*EliteControlDestroyFn)(void* context);
+typedef int (*EliteControlStepFn)(void* context, const EliteControlState* state, const double* params,
+                                  uint32_t param_count, EliteControlOutput* out);
+typedef const char* (*EliteControlNameFn)(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ELITE_CONTROL_PLUGIN_H */
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "EliteDriverCache.hpp"
+#include "Sha256.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+using namespace ELITE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Poll period of the reverse socket connection during a restart
+constexpr auto CONNECT_POLL = std::chrono::milliseconds(1);
+
+double elapsedMs(Clock::time_point begin) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+}
+
+}  // namespace
+
+EliteDriverCache& EliteDriverCache::instance() {
+    // Leaked on purpose: the Python module clears it at exit while the interpreter runs, a static destructor would
+    // join the driver threads after the interpreter is finalized
+    static auto* cache = new EliteDriverCache();
+    return *cache;
+}
+
+std::string EliteDriverCache::configKey(const EliteDriverConfig& config) {
+    std::ifstream file(config.script_file_path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot read the script template " + config.script_file_path);
+    }
+    const std::string script((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    std::ostringstream fields;
+    fields.precision(17);
+    fields << config.robot_ip << '\n'
+           << config.script_file_path << '\n'
+           << config.local_ip << '\n'
+           << config.headless_mode << '\n'
+           << config.script_sender_port << '\n'
+           << config.reverse_port << '\n'
+           << config.trajectory_port << '\n'
+           << config.script_command_port << '\n'
+           << config.servoj_time << '\n'
+           << config.servoj_lookahead_time << '\n'
+           << config.servoj_gain << '\n'
+           << config.stopj_acc << '\n';
+    const std::string text = fields.str();
+
+    Sha256 sha;
+    sha.update(script.data(), script.size());
+    sha.update(text.data(), text.size());
+    return Sha256::toHex(sha.finish());
+}
+
+std::shared_ptr<EliteDriver> EliteDriverCache::construct(const EliteDriverConfig& config, const Factory& create,
+                                                         const std::string& key, double key_ms) {
+    const auto begin = Clock::now();
+    std::shared_ptr<EliteDriver> driver = create(config);
+    DriverStartupTimings timings;
+    timings.key = key;
+    timings.key_ms = key_ms;
+    timings.construct_ms = elapsedMs(begin);
+    std::lock_guard<std::mutex> lock(mutex_);
+    dropStaleTimings();
+    timings_[driver.get()] = Startup{driver, timings};
+    return driver;
+}
+
+void EliteDriverCache::dropStaleTimings() {
+    for (auto it = timings_.begin(); it != timings_.end();) {
+        it = it->second.driver.expired() ? timings_.erase(it) : std::next(it);
+    }
+}
+
+DriverStartupTimings* EliteDriverCache::findTimings(const EliteDriver* driver) {
+    auto it = timings_.find(driver);
+    if (it == timings_.end() || it->second.driver.expired()) {
+        return nullptr;
+    }
+    return &it->second.timings;
+}
+
+std::shared_ptr<EliteDriver> EliteDriverCache::acquire(const EliteDriverConfig& config, const Factory& create) {
+    const auto begin = Clock::now();
+    const std::string key = configKey(config);
+    const double key_ms = elapsedMs(begin);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = drivers_.find(key);
+        if (it != drivers_.end()) {
+            if (DriverStartupTimings* timings = findTimings(it->second.get())) {
+                timings->reused = true;
+                timings->key_ms = key_ms;
+            }
+            return it->second;
+        }
+    }
+    // Constructed unlocked, binding the sockets takes a while. Another thread acquiring the same key meanwhile
+    // constructs its own driver, which fails to bind like any second construction would.
+    std::shared_ptr<EliteDriver> driver = construct(config, create, key, key_ms);
+    std::lock_guard<std::mutex> lock(mutex_);
+    drivers_[key] = driver;
+    return driver;
+}
+
+bool EliteDriverCache::release(const EliteDriverConfig& config) {
+    const std::string key = configKey(config);
+    std::shared_ptr<EliteDriver> driver;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = drivers_.find(key);
+        if (it == drivers_.end()) {
+            return false;
+        }
+        driver = std::move(it->second);
+        drivers_.erase(it);
+    }
+    // The last reference may be this one: the driver joins its threads outside of the lock
+    driver.reset();
+    std::lock_guard<std::mutex> lock(mutex_);
+    dropStaleTimings();
+    return true;
+}
+
+void EliteDriverCache::clear() {
+    std::map<std::string, std::shared_ptr<EliteDriver>> drivers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        drivers.swap(drivers_);
+    }
+    drivers.clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    dropStaleTimings();
+}
+
+size_t EliteDriverCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return drivers_.size();
+}
+
+bool EliteDriverCache::restartControl(EliteDriver& driver, int timeout_ms, bool send_script) {
+    double send_ms = 0.0;
+    const auto begin = Clock::now();
+    if (send_script && !driver.isRobotConnected()) {
+        if (!driver.sendExternalControlScript()) {
+            return false;
+        }
+        send_ms = elapsedMs(begin);
+    }
+    const auto connect_begin = Clock::now();
+    const auto deadline = connect_begin + std::chrono::milliseconds(std::max(timeout_ms, 0));
+    bool connected = driver.isRobotConnected();
+    while (!connected && Clock::now() < deadline) {
+        std::this_thread::sleep_for(CONNECT_POLL);
+        connected = driver.isRobotConnected();
+    }
+    const double connect_ms = elapsedMs(connect_begin);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (DriverStartupTimings* timings = findTimings(&driver)) {
+        timings->script_send_ms = send_ms;
+        timings->connect_ms = connect_ms;
+    }
+    return connected;
+}
+
+DriverStartupTimings EliteDriverCache::timings(const EliteDriver* driver) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = timings_.find(driver);
+    return it != timings_.end() && !it->second.driver.expired() ? it->second.timings : DriverStartupTimings();
+}
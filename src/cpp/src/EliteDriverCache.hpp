@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <Elite/EliteDriver.hpp>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * @brief Time spent in each phase of the start of a driver, in milliseconds.
+ *
+ * The EliteDriver constructor loads and renders the script template and binds the sockets in one call, so these
+ * phases are timed together.
+ */
+struct DriverStartupTimings {
+    std::string key;              // Hash of the script template and the configuration, empty if not computed
+    bool reused = false;          // The driver came from the cache instead of being constructed
+    double key_ms = 0.0;          // Reading and hashing the script template
+    double construct_ms = 0.0;    // EliteDriver constructor: script render and socket binding
+    double script_send_ms = 0.0;  // sendExternalControlScript() of the last restart
+    double connect_ms = 0.0;      // Until the robot connected to the reverse socket at the last restart
+};
+
+/**
+ * @brief Drivers kept alive by the hash of their script template and configuration.
+ *
+ * Stopping the external control program leaves the driver, its rendered script and its listening sockets usable: a
+ * cell that restarts control gets the same driver back and only resends the script instead of constructing a new one.
+ */
+class EliteDriverCache {
+   public:
+    using Factory = std::function<std::shared_ptr<ELITE::EliteDriver>(const ELITE::EliteDriverConfig&)>;
+
+    static EliteDriverCache& instance();
+
+    /**
+     * @brief SHA-256 of the script template file and of every field of the configuration, in hex.
+     *
+     * @throws std::runtime_error if the script template cannot be read
+     */
+    static std::string configKey(const ELITE::EliteDriverConfig& config);
+
+    /**
+     * @brief The cached driver of `config`, or a new one built by `create` and cached.
+     *
+     * A changed template file gives another key, so a stale rendered script is never reused.
+     */
+    std::shared_ptr<ELITE::EliteDriver> acquire(const ELITE::EliteDriverConfig& config, const Factory& create);
+
+    /**
+     * @brief Drop the cached driver of `config`. It is destroyed when no other reference holds it.
+     *
+     * @return false if no driver was cached for `config`
+     */
+    bool release(const ELITE::EliteDriverConfig& config);
+
+    void clear();
+
+    size_t size() const;
+
+    /**
+     * @brief Time a constructor call and record it as the startup of the new driver.
+     */
+    std::shared_ptr<ELITE::EliteDriver> construct(const ELITE::EliteDriverConfig& config, const Factory& create,
+                                                  const std::string& key = std::string(), double key_ms = 0.0);
+
+    /**
+     * @brief Re-arm external control without rebuilding the driver: resend the script unless the robot is still
+     * connected, then wait for the robot to connect to the reverse socket.
+     *
+     * @param timeout_ms Longest wait for the connection
+     * @param send_script false when the program is started on the teach pendant, which fetches the script itself
+     * @return true if the robot is connected
+     */
+    bool restartControl(ELITE::EliteDriver& driver, int timeout_ms, bool send_script = true);
+
+    DriverStartupTimings timings(const ELITE::EliteDriver* driver) const;
+
+   private:
+    EliteDriverCache() = default;
+
+    struct Startup {
+        std::weak_ptr<ELITE::EliteDriver> driver;
+        DriverStartupTimings timings;
+    };
+
+    // The timings of a live driver, nullptr if it was not constructed by construct() or is gone. Locked by the caller.
+    DriverStartupTimings* findTimings(const ELITE::EliteDriver* driver);
+    // Drop the timings of the destroyed drivers. Locked by the caller.
+    void dropStaleTimings();
+
+    mutable std::mutex mutex_;
+    std::map<std::string, std::shared_ptr<ELITE::EliteDriver>> drivers_;
+    // By address, the weak reference tells a live driver from a destroyed one whose address was reused
+    std::map<const ELITE::EliteDriver*, Startup> timings_;
+};
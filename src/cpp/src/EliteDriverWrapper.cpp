@@ -2,6 +2,11 @@
 // Copyright (c) 2025, Elite Robots.
 #include "EliteDriverWrapper.hpp"
 #include "Elite/EliteDriver.hpp"
+#include "EliteDriverCache.hpp"
+#include "GilSafeObject.hpp"
+#include "SdkThreadsWrapper.hpp"
+
+#include <memory>
 
 namespace py = pybind11;
 using namespace ELITE;
@@ -33,9 +38,38 @@ static void bindEliteDriverConfig(py::module_& m) {
         .def_readwrite("stopj_acc", &EliteDriverConfig::stopj_acc, "Acceleration [rad/s^2]. The acceleration of stopj motion.");
 }
 
+// The driver starts its socket threads in the constructor
+static std::shared_ptr<EliteDriver> makeDriver(const EliteDriverConfig& config) {
+    SdkThreadCapture capture("EliteDriver");
+    std::shared_ptr<EliteDriver> self(new EliteDriver(config), SdkThreadsDeleter<EliteDriver>());
+    capture.commit(self.get(), true);
+    return self;
+}
+
+static void bindDriverStartupTimings(py::module_& m) {
+    py::class_<DriverStartupTimings>(m, "DriverStartupTimings",
+                                     "Time spent in each phase of the start of a driver, in milliseconds.")
+        .def_readonly("key", &DriverStartupTimings::key,
+                      "Hash of the script template and the configuration, empty for a driver built without the cache")
+        .def_readonly("reused", &DriverStartupTimings::reused, "The driver came from the cache")
+        .def_readonly("key_ms", &DriverStartupTimings::key_ms, "Reading and hashing the script template")
+        .def_readonly("construct_ms", &DriverStartupTimings::construct_ms,
+                      "EliteDriver constructor: script template render and socket binding")
+        .def_readonly("script_send_ms", &DriverStartupTimings::script_send_ms,
+                      "sendExternalControlScript() of the last restartControl()")
+        .def_readonly("connect_ms", &DriverStartupTimings::connect_ms,
+                      "Until the robot connected to the reverse socket in the last restartControl()")
+        .def("__repr__", [](const DriverStartupTimings& self) {
+            return py::str("<DriverStartupTimings reused={} key={:.3f}ms construct={:.3f}ms send={:.3f}ms "
+                           "connect={:.3f}ms>")
+                .format(self.reused, self.key_ms, self.construct_ms, self.script_send_ms, self.connect_ms);
+        });
+}
+
 static void bindEliteDriverClass(py::module_& m) {
     auto trajectory_restult_cb = [](EliteDriver& self, py::function py_cb) {
-        auto py_cb_ptr = std::make_shared<py::function>(std::move(py_cb));
+        // The driver may be destroyed without the GIL (releaseCached(), clearCache(), exit)
+        auto py_cb_ptr = makeGilSafe(std::move(py_cb));
         auto cpp_cb = [py_cb_ptr](TrajectoryMotionResult result) {
             py::gil_scoped_acquire gil;
             try {
@@ -47,16 +81,82 @@ static void bindEliteDriverClass(py::module_& m) {
         self.setTrajectoryResultCallback(cpp_cb);
     };
 
-    py::class_<EliteDriver>(m, "EliteDriver",
-                            "This is the main class for interfacing the driver. It sets up all the necessary socket connections "
-                            "and handles the data exchange with the robot.")
-        .def(py::init<EliteDriverConfig>(), py::arg("config"),
+    py::class_<EliteDriver, std::shared_ptr<EliteDriver>> driver(
+        m, "EliteDriver",
+        "This is the main class for interfacing the driver. It sets up all the necessary socket "
+        "connections and handles the data exchange with the robot.");
+    driver
+        .def(py::init([](const EliteDriverConfig& config) {
+                 return EliteDriverCache::instance().construct(config, makeDriver);
+             }),
+             py::arg("config"),
              R"doc(
                 Construct a new Elite Driver object
 
                 Args:
                     config (EliteDriverConfig): Configuration class for the EliteDriver. See it's code annotation for details.
             )doc")
+        .def_static(
+            "acquire",
+            [](const EliteDriverConfig& config) { return EliteDriverCache::instance().acquire(config, makeDriver); },
+            py::arg("config"),
+            R"doc(
+                Get the cached driver of a configuration, or construct and cache it.
+
+                The cache is keyed by a hash of the script template file and of every field of the configuration, so
+                a changed template or configuration constructs a new driver. A cached driver keeps its rendered script
+                and its listening sockets after the external control program stops: re-arm it with restartControl()
+                instead of constructing a new driver.
+
+                Args:
+                    config (EliteDriverConfig): Configuration of the driver
+
+                Returns:
+                    EliteDriver: The cached driver
+            )doc")
+        .def_static(
+            "releaseCached",
+            [](const EliteDriverConfig& config) { return EliteDriverCache::instance().release(config); },
+            py::arg("config"), py::call_guard<py::gil_scoped_release>(),
+            R"doc(
+                Drop the cached driver of a configuration. It closes its sockets once no other reference holds it.
+
+                Returns:
+                    bool: False if no driver was cached for this configuration
+            )doc")
+        .def_static(
+            "clearCache", []() { EliteDriverCache::instance().clear(); }, py::call_guard<py::gil_scoped_release>(),
+            "Drop every cached driver. The cache is also cleared when the interpreter exits.")
+        .def(
+            "restartControl",
+            [](EliteDriver& self, int timeout_ms, bool send_script) {
+                SdkThreadCapture capture("EliteDriver");
+                bool connected = false;
+                {
+                    py::gil_scoped_release release;
+                    connected = EliteDriverCache::instance().restartControl(self, timeout_ms, send_script);
+                }
+                capture.commit(&self);
+                return connected;
+            },
+            py::arg("timeout_ms") = 5000, py::arg("send_script") = true,
+            R"doc(
+                Warm restart: re-arm external control after the program stopped, keeping the listening sockets and the
+                rendered script. Resends the script unless the robot is still connected, then waits for the robot to
+                connect to the reverse socket. The phases are timed in getStartupTimings().
+
+                Args:
+                    timeout_ms (int): Longest wait for the connection
+                    send_script (bool): False when the program is started on the teach pendant, which fetches the
+                        script itself
+
+                Returns:
+                    bool: True if the robot is connected
+            )doc")
+        .def(
+            "getStartupTimings",
+            [](const EliteDriver& self) { return EliteDriverCache::instance().timings(&self); },
+            "Time spent in each phase of the construction and of the last restartControl() of this driver.")
         .def("writeServoj", &EliteDriver::writeServoj, py::arg("pos"), py::arg("timeout_ms"), py::arg("cartesian") = false,
              R"doc(
                 Write servoj() points to robot
@@ -256,8 +356,15 @@ static void bindEliteDriverClass(py::module_& m) {
                 Returns:
                     bool: True if get success
             )doc")
-        .def("primaryReconnect", &EliteDriver::primaryReconnect,
-             R"doc(
+        .def(
+            "primaryReconnect",
+            [](EliteDriver& self) {
+                SdkThreadCapture capture("EliteDriver");
+                const bool ok = self.primaryReconnect();
+                capture.commit(&self);
+                return ok;
+            },
+            R"doc(
                 Reconnect robot primary interface
 
                 Returns:
@@ -296,9 +403,18 @@ static void bindEliteDriverClass(py::module_& m) {
                 Returns:
                     bool: True if success
             )doc");
+    defThreadPolicyMethods(driver);
 }
 
 void bindEliteDriver(py::module_& m) {
     bindEliteDriverConfig(m);
+    bindDriverStartupTimings(m);
     bindEliteDriverClass(m);
+
+    // The cache is never destroyed: drop the cached drivers, their threads and their Python callbacks while the
+    // interpreter is still running
+    py::module_::import("atexit").attr("register")(py::cpp_function([]() {
+        py::gil_scoped_release release;
+        EliteDriverCache::instance().clear();
+    }));
 }
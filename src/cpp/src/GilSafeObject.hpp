@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <pybind11/pybind11.h>
+
+#include <memory>
+
+/**
+ * @brief Share a Python object with native threads.
+ *
+ * The returned pointer can be copied and destroyed on any thread: the last owner acquires the GIL before the
+ * Python reference is released. Calling into the object still requires `py::gil_scoped_acquire`.
+ */
+template <typename T = pybind11::object>
+std::shared_ptr<T> makeGilSafe(T obj) {
+    return std::shared_ptr<T>(new T(std::move(obj)), [](T* p) {
+        pybind11::gil_scoped_acquire gil;
+        delete p;
+    });
+}
+
+/**
+ * @brief Deleter that releases the GIL while destroying an object whose destructor joins a native thread.
+ *
+ * Without it, a worker blocked in `py::gil_scoped_acquire` and a destructor waiting for that worker would deadlock.
+ */
+template <typename T>
+struct GilReleasingDeleter {
+    void operator()(T* p) const {
+        // Shared owners may drop the last reference on a native thread that does not hold the GIL
+        if (!PyGILState_Check()) {
+            delete p;
+            return;
+        }
+        pybind11::gil_scoped_release release;
+        delete p;
+    }
+};
+
+// pybind11 holder type for classes that own native threads calling back into Python.
+template <typename T>
+using GilReleasingPtr = std::unique_ptr<T, GilReleasingDeleter<T>>;
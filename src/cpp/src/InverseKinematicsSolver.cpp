@@ -0,0 +1,380 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "InverseKinematicsSolver.hpp"
+#include "ParallelFor.hpp"
+#include "RotationUtils.hpp"
+
+#include <cmath>
+
+using namespace ELITE;
+
+namespace {
+
+constexpr double TWO_PI = 2.0 * ROTATION_PI;
+// Tolerance used to decide whether the DH parameters match the closed-form geometry.
+constexpr double GEOMETRY_EPS = 1e-9;
+// Maximum position error accepted when checking a closed-form branch against forward kinematics.
+constexpr double BRANCH_CHECK_EPS = 1e-6;
+// Maximum joint step of one damped-least-squares iteration, in rad.
+constexpr double MAX_NUMERIC_STEP = 0.5;
+
+// 4x4 row-major homogeneous transform of one standard DH link.
+void dhTransform(double theta, double a, double d, double alpha, double* T) {
+    const double ct = std::cos(theta), st = std::sin(theta);
+    const double ca = std::cos(alpha), sa = std::sin(alpha);
+    const double M[16] = {ct, -st * ca, st * sa, a * ct, st, ct * ca, -ct * sa, a * st, 0, sa, ca, d, 0, 0, 0, 1};
+    std::copy(M, M + 16, T);
+}
+
+void mul4(const double* A, const double* B, double* C) {
+    for (int r = 0; r < 4; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            double s = 0;
+            for (int k = 0; k < 4; ++k) {
+                s += A[r * 4 + k] * B[k * 4 + c];
+            }
+            C[r * 4 + c] = s;
+        }
+    }
+}
+
+void invert4(const double* T, double* Ti) {
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            Ti[r * 4 + c] = T[c * 4 + r];
+        }
+        Ti[r * 4 + 3] = -(T[r] * T[3] + T[4 + r] * T[7] + T[8 + r] * T[11]);
+    }
+    Ti[12] = Ti[13] = Ti[14] = 0;
+    Ti[15] = 1;
+}
+
+double wrapPi(double v) { return v - TWO_PI * std::floor((v + ROTATION_PI) / TWO_PI); }
+
+// Solve A x = b for a 6x6 system with partial pivoting. A and b are overwritten. Returns the determinant of A.
+double solve6(double* A, double* b) {
+    double det = 1.0;
+    for (int c = 0; c < 6; ++c) {
+        int pivot = c;
+        for (int r = c + 1; r < 6; ++r) {
+            if (std::fabs(A[r * 6 + c]) > std::fabs(A[pivot * 6 + c])) pivot = r;
+        }
+        if (A[pivot * 6 + c] == 0.0) {
+            return 0.0;
+        }
+        if (pivot != c) {
+            for (int k = 0; k < 6; ++k) std::swap(A[c * 6 + k], A[pivot * 6 + k]);
+            std::swap(b[c], b[pivot]);
+            det = -det;
+        }
+        det *= A[c * 6 + c];
+        for (int r = c + 1; r < 6; ++r) {
+            const double f = A[r * 6 + c] / A[c * 6 + c];
+            for (int k = c; k < 6; ++k) A[r * 6 + k] -= f * A[c * 6 + k];
+            b[r] -= f * b[c];
+        }
+    }
+    for (int r = 5; r >= 0; --r) {
+        double s = b[r];
+        for (int k = r + 1; k < 6; ++k) s -= A[r * 6 + k] * b[k];
+        b[r] = s / A[r * 6 + r];
+    }
+    return det;
+}
+
+// Pose error of the current transform towards the target: position difference and rotation vector of Rt * Rc^T.
+void poseError(const double* R_target, const double* p_target, const double* R, const double* p, double* e) {
+    double Rct[9];
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) Rct[r * 3 + c] = R[c * 3 + r];
+    }
+    double dR[9];
+    matMul3(R_target, Rct, dR);
+    for (int i = 0; i < 3; ++i) e[i] = p_target[i] - p[i];
+    matrixToRotvec(dR, e + 3);
+}
+
+}  // namespace
+
+InverseKinematicsSolver::InverseKinematicsSolver(const KinematicsSolver& fk) : fk_(fk) {
+    lower_.fill(-TWO_PI);
+    upper_.fill(TWO_PI);
+
+    const auto& a = fk_.dhA();
+    const auto& d = fk_.dhD();
+    const auto& alpha = fk_.dhAlpha();
+    const double half_pi = ROTATION_PI / 2;
+    analytic_supported_ = std::fabs(alpha[0] - half_pi) < GEOMETRY_EPS && std::fabs(alpha[1]) < GEOMETRY_EPS &&
+                          std::fabs(alpha[2]) < GEOMETRY_EPS && std::fabs(alpha[3] - half_pi) < GEOMETRY_EPS &&
+                          std::fabs(alpha[4] + half_pi) < GEOMETRY_EPS && std::fabs(alpha[5]) < GEOMETRY_EPS &&
+                          std::fabs(a[0]) < GEOMETRY_EPS && std::fabs(a[3]) < GEOMETRY_EPS && std::fabs(a[4]) < GEOMETRY_EPS &&
+                          std::fabs(a[5]) < GEOMETRY_EPS && std::fabs(d[1]) < GEOMETRY_EPS && std::fabs(d[2]) < GEOMETRY_EPS &&
+                          std::fabs(a[1]) > GEOMETRY_EPS && std::fabs(a[2]) > GEOMETRY_EPS && std::fabs(d[5]) > GEOMETRY_EPS;
+}
+
+void InverseKinematicsSolver::setJointLimits(const vector6d_t& lower, const vector6d_t& upper) {
+    lower_ = lower;
+    upper_ = upper;
+}
+
+void InverseKinematicsSolver::setNumericParameters(int max_iterations, double damping, double tolerance) {
+    max_iterations_ = max_iterations;
+    damping_ = damping;
+    tolerance_ = tolerance;
+}
+
+bool InverseKinematicsSolver::solveAll(const double* pose, std::vector<vector6d_t>& solutions) const {
+    vector6d_t branches[MAX_SOLUTIONS];
+    const int count = solveBranches(pose, branches);
+    solutions.assign(branches, branches + std::max(count, 0));
+    return count >= 0;
+}
+
+int InverseKinematicsSolver::solveBranches(const double* pose, vector6d_t* solutions) const {
+    if (!analytic_supported_) {
+        return -1;
+    }
+    // Remove the TCP offset to get the flange transform
+    double Rt[9], Ro[9], R[9], p[3];
+    rotvecToMatrix(pose + 3, Rt);
+    const auto& tcp = fk_.getTcp();
+    rotvecToMatrix(&tcp[3], Ro);
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            R[r * 3 + c] = Rt[r * 3] * Ro[c * 3] + Rt[r * 3 + 1] * Ro[c * 3 + 1] + Rt[r * 3 + 2] * Ro[c * 3 + 2];
+        }
+    }
+    for (int r = 0; r < 3; ++r) {
+        p[r] = pose[r] - (R[r * 3] * tcp[0] + R[r * 3 + 1] * tcp[1] + R[r * 3 + 2] * tcp[2]);
+    }
+    return solveAnalyticFlange(R, p, solutions);
+}
+
+int InverseKinematicsSolver::solveAnalyticFlange(const double* R, const double* p, vector6d_t* solutions) const {
+    const auto& a = fk_.dhA();
+    const auto& d = fk_.dhD();
+    const auto& alpha = fk_.dhAlpha();
+    const double a2 = a[1], a3 = a[2], d4 = d[3], d6 = d[5];
+
+    double T06[16] = {R[0], R[1], R[2], p[0], R[3], R[4], R[5], p[1], R[6], R[7], R[8], p[2], 0, 0, 0, 1};
+
+    // Wrist center (origin of frame 5)
+    const double p05x = p[0] - d6 * R[2];
+    const double p05y = p[1] - d6 * R[5];
+    const double r05 = std::hypot(p05x, p05y);
+    if (r05 < std::fabs(d4)) {
+        return 0;
+    }
+    const double psi = std::atan2(p05y, p05x);
+    const double phi = std::acos(d4 / r05);
+    int count = 0;
+
+    for (int s1 = -1; s1 <= 1; s1 += 2) {
+        const double t1 = psi + s1 * phi + ROTATION_PI / 2;
+        const double c1 = std::cos(t1), sn1 = std::sin(t1);
+        double cos5 = (p[0] * sn1 - p[1] * c1 - d4) / d6;
+        if (std::fabs(cos5) > 1.0 + 1e-9) {
+            continue;
+        }
+        cos5 = std::min(1.0, std::max(-1.0, cos5));
+
+        for (int s5 = -1; s5 <= 1; s5 += 2) {
+            const double t5 = s5 * std::acos(cos5);
+            const double sn5 = std::sin(t5);
+            double t6 = 0.0;
+            if (std::fabs(sn5) > 1e-10) {
+                t6 = std::atan2((-R[1] * sn1 + R[4] * c1) / sn5, (R[0] * sn1 - R[3] * c1) / sn5);
+            }
+
+            // Reduce to the planar 3R sub-chain: T14 = T01^-1 * T06 * (T45 * T56)^-1
+            double T01[16], T01i[16], T45[16], T56[16], T46[16], T46i[16], tmp[16], T14[16];
+            dhTransform(t1, a[0], d[0], alpha[0], T01);
+            dhTransform(t5, a[4], d[4], alpha[4], T45);
+            dhTransform(t6, a[5], d[5], alpha[5], T56);
+            mul4(T45, T56, T46);
+            invert4(T01, T01i);
+            invert4(T46, T46i);
+            mul4(T01i, T06, tmp);
+            mul4(tmp, T46i, T14);
+
+            // Origin of frame 3 expressed in frame 1
+            const double p13x = T14[3] - d4 * T14[1];
+            const double p13y = T14[7] - d4 * T14[5];
+            double cos3 = (p13x * p13x + p13y * p13y - a2 * a2 - a3 * a3) / (2.0 * a2 * a3);
+            if (std::fabs(cos3) > 1.0 + 1e-9) {
+                continue;
+            }
+            cos3 = std::min(1.0, std::max(-1.0, cos3));
+
+            for (int s3 = -1; s3 <= 1; s3 += 2) {
+                const double t3 = s3 * std::acos(cos3);
+                const double t2 = std::atan2(p13y, p13x) - std::atan2(a3 * std::sin(t3), a2 + a3 * std::cos(t3));
+
+                double T12[16], T23[16], T13[16], T13i[16], T34[16];
+                dhTransform(t2, a[1], d[1], alpha[1], T12);
+                dhTransform(t3, a[2], d[2], alpha[2], T23);
+                mul4(T12, T23, T13);
+                invert4(T13, T13i);
+                mul4(T13i, T14, T34);
+                const double t4 = std::atan2(T34[4], T34[0]);
+
+                vector6d_t q{wrapPi(t1), wrapPi(t2), wrapPi(t3), wrapPi(t4), wrapPi(t5), wrapPi(t6)};
+
+                // Reject branches that do not reproduce the flange pose (numerically degenerate cases)
+                double Rc[9], pc[3], err = 0;
+                fk_.flangeTransform(q.data(), Rc, pc);
+                for (int r = 0; r < 3; ++r) {
+                    err += (pc[r] - p[r]) * (pc[r] - p[r]);
+                }
+                for (int k = 0; k < 9; ++k) {
+                    err += (Rc[k] - R[k]) * (Rc[k] - R[k]);
+                }
+                if (err < BRANCH_CHECK_EPS * BRANCH_CHECK_EPS) {
+                    solutions[count++] = q;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+bool InverseKinematicsSolver::wrapToLimits(double* q, const double* seed) const {
+    for (int j = 0; j < KinematicsSolver::JOINTS; ++j) {
+        // Pick the 2*pi equivalent inside the limits that is closest to the seed
+        const double base = q[j] + TWO_PI * std::round((seed[j] - q[j]) / TWO_PI);
+        double best = 0.0, best_dist = -1.0;
+        for (int k = -1; k <= 1; ++k) {
+            const double v = base + k * TWO_PI;
+            if (v < lower_[j] || v > upper_[j]) {
+                continue;
+            }
+            const double dist = std::fabs(v - seed[j]);
+            if (best_dist < 0 || dist < best_dist) {
+                best = v;
+                best_dist = dist;
+            }
+        }
+        if (best_dist < 0) {
+            return false;
+        }
+        q[j] = best;
+    }
+    return true;
+}
+
+IkStatus InverseKinematicsSolver::finish(double* q) const {
+    double J[36], b[6] = {0, 0, 0, 0, 0, 0};
+    fk_.jacobianBatch(q, 1, J, 1);
+    const double det = solve6(J, b);
+    return std::fabs(det) < singularity_threshold_ ? IkStatus::NEAR_SINGULAR : IkStatus::SUCCESS;
+}
+
+IkStatus InverseKinematicsSolver::solve(const double* pose, const double* seed, double* q) const {
+    IkStatus analytic_status = IkStatus::NOT_CONVERGED;
+    if (analytic_enabled_ && analytic_supported_) {
+        // Called per sample by solveBatch(): the branches stay on the stack
+        vector6d_t solutions[MAX_SOLUTIONS];
+        const int count = solveBranches(pose, solutions);
+        double best_dist = -1.0;
+        for (int i = 0; i < count; ++i) {
+            vector6d_t& s = solutions[i];
+            if (!wrapToLimits(s.data(), seed)) {
+                continue;
+            }
+            double dist = 0.0;
+            for (int j = 0; j < KinematicsSolver::JOINTS; ++j) {
+                dist += (s[j] - seed[j]) * (s[j] - seed[j]);
+            }
+            if (best_dist < 0 || dist < best_dist) {
+                best_dist = dist;
+                std::copy(s.begin(), s.end(), q);
+            }
+        }
+        if (best_dist >= 0) {
+            return finish(q);
+        }
+        analytic_status = count <= 0 ? IkStatus::UNREACHABLE : IkStatus::JOINT_LIMIT;
+    }
+
+    // Also the fallback of the closed form, which rejects degenerate branches near singularities. If the iteration
+    // fails too, the closed-form status is kept.
+    double R[9];
+    rotvecToMatrix(pose + 3, R);
+    const IkStatus status = solveNumeric(R, pose, seed, q);
+    if (status == IkStatus::NOT_CONVERGED && analytic_status != IkStatus::NOT_CONVERGED) {
+        return analytic_status;
+    }
+    return status;
+}
+
+IkStatus InverseKinematicsSolver::solveNumeric(const double* R_target, const double* p_target, const double* seed,
+                                               double* q) const {
+    double x[KinematicsSolver::JOINTS];
+    std::copy(seed, seed + KinematicsSolver::JOINTS, x);
+    const double lambda2 = damping_ * damping_;
+
+    bool converged = false;
+    for (int it = 0; it < max_iterations_; ++it) {
+        double R[9], p[3], e[6];
+        fk_.forwardTransform(x, R, p);
+        poseError(R_target, p_target, R, p, e);
+        double norm2 = 0.0;
+        for (double v : e) norm2 += v * v;
+        if (norm2 < tolerance_ * tolerance_) {
+            converged = true;
+            break;
+        }
+
+        // dq = J^T (J J^T + lambda^2 I)^-1 e
+        double J[36], A[36], y[6];
+        fk_.jacobianBatch(x, 1, J, 1);
+        for (int r = 0; r < 6; ++r) {
+            for (int c = 0; c < 6; ++c) {
+                double s = 0.0;
+                for (int k = 0; k < 6; ++k) s += J[r * 6 + k] * J[c * 6 + k];
+                A[r * 6 + c] = s + (r == c ? lambda2 : 0.0);
+            }
+            y[r] = e[r];
+        }
+        if (solve6(A, y) == 0.0) {
+            break;
+        }
+        double dq[6], step = 0.0;
+        for (int k = 0; k < 6; ++k) {
+            double s = 0.0;
+            for (int r = 0; r < 6; ++r) s += J[r * 6 + k] * y[r];
+            dq[k] = s;
+            step = std::max(step, std::fabs(s));
+        }
+        const double scale = step > MAX_NUMERIC_STEP ? MAX_NUMERIC_STEP / step : 1.0;
+        for (int k = 0; k < 6; ++k) x[k] += scale * dq[k];
+    }
+    if (!converged) {
+        return IkStatus::NOT_CONVERGED;
+    }
+    if (!wrapToLimits(x, seed)) {
+        return IkStatus::JOINT_LIMIT;
+    }
+    std::copy(x, x + KinematicsSolver::JOINTS, q);
+    return finish(q);
+}
+
+void InverseKinematicsSolver::solveBatch(const double* poses, const double* seeds, size_t trajectories, size_t samples,
+                                         double* q, IkStatus* status, int threads) const {
+    parallelFor(trajectories, 1, threads, [&](size_t begin, size_t end) {
+        for (size_t t = begin; t < end; ++t) {
+            double seed[KinematicsSolver::JOINTS];
+            std::copy(seeds + t * 6, seeds + t * 6 + 6, seed);
+            for (size_t i = 0; i < samples; ++i) {
+                const size_t idx = t * samples + i;
+                double* out = q + idx * 6;
+                status[idx] = solve(poses + idx * 6, seed, out);
+                if (status[idx] == IkStatus::SUCCESS || status[idx] == IkStatus::NEAR_SINGULAR) {
+                    std::copy(out, out + 6, seed);
+                } else {
+                    std::copy(seed, seed + 6, out);
+                }
+            }
+        }
+    });
+}
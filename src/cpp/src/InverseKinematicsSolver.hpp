@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include "KinematicsSolver.hpp"
+
+#include <Elite/DataType.hpp>
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Result of one inverse kinematics query.
+ */
+enum class IkStatus : int8_t {
+    SUCCESS = 0,        // Solution found, within joint limits
+    NEAR_SINGULAR = 1,  // Solution found, but the Jacobian is close to singular at the solution
+    JOINT_LIMIT = 2,    // The pose is reachable, but every solution violates the joint limits
+    UNREACHABLE = 3,    // The pose is outside of the workspace
+    NOT_CONVERGED = 4,  // The numeric solver did not converge
+};
+
+/**
+ * @brief Inverse kinematics for 6-axis arms described by standard DH parameters.
+ *
+ * When the DH parameters have the CS geometry (three parallel shoulder/elbow/wrist1 axes followed by a spherical-like
+ * wrist, alpha = [pi/2, 0, 0, pi/2, -pi/2, 0]), a closed-form solver returns all eight branches. Otherwise, when
+ * the closed form is disabled, or when it finds no branch within the joint limits, a damped-least-squares iteration
+ * seeded from the given joint positions is used.
+ */
+class InverseKinematicsSolver {
+   public:
+    // Closed-form branches: two shoulder, two wrist and two elbow configurations
+    static constexpr int MAX_SOLUTIONS = 8;
+
+    explicit InverseKinematicsSolver(const KinematicsSolver& fk);
+
+    /**
+     * @brief Set the TCP offset relative to the flange, forwarded to the underlying forward kinematics.
+     */
+    void setTcp(const ELITE::vector6d_t& tcp) { fk_.setTcp(tcp); }
+
+    const ELITE::vector6d_t& getTcp() const { return fk_.getTcp(); }
+
+    /**
+     * @brief Set the joint limits used to select and validate solutions. Default is [-2pi, 2pi] for every joint.
+     */
+    void setJointLimits(const ELITE::vector6d_t& lower, const ELITE::vector6d_t& upper);
+
+    /**
+     * @brief Configure the damped-least-squares fallback.
+     *
+     * @param max_iterations Iteration limit per solve
+     * @param damping Damping factor lambda
+     * @param tolerance Convergence threshold on the pose error norm (m and rad)
+     */
+    void setNumericParameters(int max_iterations, double damping, double tolerance);
+
+    /**
+     * @brief Set the threshold on |det(J)| below which a solution is reported as NEAR_SINGULAR.
+     */
+    void setSingularityThreshold(double threshold) { singularity_threshold_ = threshold; }
+
+    /**
+     * @brief Enable or disable the closed-form solver. It is only used if the DH parameters have the CS geometry.
+     */
+    void setAnalyticEnabled(bool enable) { analytic_enabled_ = enable; }
+
+    /**
+     * @brief Whether the DH parameters have the geometry required by the closed-form solver.
+     */
+    bool isAnalyticSupported() const { return analytic_supported_; }
+
+    /**
+     * @brief Compute all closed-form branches of a TCP pose, wrapped to [-pi, pi]. Joint limits are not applied.
+     *
+     * @param pose TCP pose [x, y, z, rx, ry, rz]
+     * @param solutions Output, up to MAX_SOLUTIONS solutions
+     * @return false if the closed form is not supported
+     */
+    bool solveAll(const double* pose, std::vector<ELITE::vector6d_t>& solutions) const;
+
+    /**
+     * @brief Solve the joint positions of a TCP pose, choosing the solution closest to `seed`.
+     *
+     * @param pose TCP pose [x, y, z, rx, ry, rz]
+     * @param seed Reference joint positions
+     * @param q Output joint positions, valid when the status is SUCCESS or NEAR_SINGULAR
+     * @return IkStatus
+     */
+    IkStatus solve(const double* pose, const double* seed, double* q) const;
+
+    /**
+     * @brief Solve `trajectories` cartesian paths of `samples` poses each.
+     *
+     * Each trajectory is solved sequentially, every sample is seeded by the previous solution. Trajectories are
+     * distributed over worker threads. When a sample fails its seed is kept for the next one.
+     *
+     * @param poses Input poses, trajectories x samples x 6
+     * @param seeds Initial seed of every trajectory, trajectories x 6
+     * @param trajectories Number of trajectories
+     * @param samples Number of poses per trajectory
+     * @param q Output joint positions, trajectories x samples x 6
+     * @param status Output status, trajectories x samples
+     * @param threads Number of worker threads, 0 uses all hardware threads
+     */
+    void solveBatch(const double* poses, const double* seeds, size_t trajectories, size_t samples, double* q,
+                    IkStatus* status, int threads = 0) const;
+
+   private:
+    IkStatus solveNumeric(const double* R_target, const double* p_target, const double* seed, double* q) const;
+    // Closed-form branches of a TCP pose or of a flange transform into `solutions`, which holds MAX_SOLUTIONS.
+    // Returns the number of branches, -1 if the closed form is not supported.
+    int solveBranches(const double* pose, ELITE::vector6d_t* solutions) const;
+    int solveAnalyticFlange(const double* R, const double* p, ELITE::vector6d_t* solutions) const;
+    bool wrapToLimits(double* q, const double* seed) const;
+    IkStatus finish(double* q) const;
+
+    KinematicsSolver fk_;
+    ELITE::vector6d_t lower_;
+    ELITE::vector6d_t upper_;
+    int max_iterations_ = 100;
+    double damping_ = 1e-3;
+    double tolerance_ = 1e-9;
+    double singularity_threshold_ = 1e-5;
+    bool analytic_enabled_ = true;
+    bool analytic_supported_ = false;
+};
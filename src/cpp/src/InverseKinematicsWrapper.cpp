@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "InverseKinematicsWrapper.hpp"
+#include "InverseKinematicsSolver.hpp"
+#include "NdArrayUtils.hpp"
+
+#include <Elite/RobotConfPackage.hpp>
+
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+using namespace ELITE;
+
+void bindInverseKinematics(py::module_& m) {
+    py::enum_<IkStatus>(m, "IkStatus", py::arithmetic())
+        .value("SUCCESS", IkStatus::SUCCESS, "Solution found, within joint limits")
+        .value("NEAR_SINGULAR", IkStatus::NEAR_SINGULAR, "Solution found, but the robot is close to a singularity")
+        .value("JOINT_LIMIT", IkStatus::JOINT_LIMIT, "The pose is reachable, but every solution violates the joint limits")
+        .value("UNREACHABLE", IkStatus::UNREACHABLE, "The pose is outside of the workspace")
+        .value("NOT_CONVERGED", IkStatus::NOT_CONVERGED, "The numeric solver did not converge")
+        .export_values();
+
+    py::class_<InverseKinematicsSolver, std::shared_ptr<InverseKinematicsSolver>>(
+        m, "InverseKinematics",
+        "Native inverse kinematics based on the DH parameters of the robot. "
+        "Uses the closed-form solution of the CS geometry when possible, and damped least squares otherwise or when "
+        "the closed form finds no solution within the joint limits.")
+        .def(py::init([](const KinematicsInfo& info) {
+                 return std::make_shared<InverseKinematicsSolver>(
+                     KinematicsSolver(info.dh_a_, info.dh_d_, info.dh_alpha_));
+             }),
+             py::arg("info"),
+             R"doc(
+                Construct from the kinematics configuration of the robot.
+
+                Args:
+                    info (KinematicsInfo): Kinematics package read by `getPackage()` or `getPrimaryPackage()`.
+            )doc")
+        .def(py::init<const KinematicsSolver&>(), py::arg("kinematics"),
+             R"doc(
+                Construct from a forward kinematics object. The TCP offset of `kinematics` is copied.
+
+                Args:
+                    kinematics (Kinematics): Forward kinematics
+            )doc")
+        .def("setTcp", &InverseKinematicsSolver::setTcp, py::arg("tcp"),
+             R"doc(
+                Set the TCP offset relative to the flange. The default is no offset.
+
+                Args:
+                    tcp (list): TCP pose [x, y, z, rx, ry, rz] in the flange frame.
+            )doc")
+        .def("getTcp", &InverseKinematicsSolver::getTcp, "Get the TCP offset relative to the flange.")
+        .def("setJointLimits", &InverseKinematicsSolver::setJointLimits, py::arg("lower"), py::arg("upper"),
+             R"doc(
+                Set the joint limits used to select and validate solutions. The default is [-2pi, 2pi] for every joint.
+
+                Args:
+                    lower (list): Lower limits, unit: rad
+                    upper (list): Upper limits, unit: rad
+            )doc")
+        .def("setNumericParameters", &InverseKinematicsSolver::setNumericParameters, py::arg("max_iterations") = 100,
+             py::arg("damping") = 1e-3, py::arg("tolerance") = 1e-9,
+             R"doc(
+                Configure the damped-least-squares solver.
+
+                Args:
+                    max_iterations (int): Iteration limit of one solve
+                    damping (float): Damping factor
+                    tolerance (float): Convergence threshold on the pose error norm (m and rad)
+            )doc")
+        .def("setSingularityThreshold", &InverseKinematicsSolver::setSingularityThreshold, py::arg("threshold"),
+             R"doc(
+                Set the threshold on |det(J)| below which a solution is reported as `NEAR_SINGULAR`. Default is 1e-5.
+
+                Args:
+                    threshold (float): Determinant threshold
+            )doc")
+        .def("setAnalyticEnabled", &InverseKinematicsSolver::setAnalyticEnabled, py::arg("enable"),
+             R"doc(
+                Enable or disable the closed-form solver. When disabled, every solve uses damped least squares from the seed.
+
+                Args:
+                    enable (bool): True to enable
+            )doc")
+        .def("isAnalyticSupported", &InverseKinematicsSolver::isAnalyticSupported,
+             R"doc(
+                Whether the DH parameters have the geometry required by the closed-form solver.
+
+                Returns:
+                    bool: True if supported
+            )doc")
+        .def(
+            "solveAll",
+            [](const InverseKinematicsSolver& self, const vector6d_t& pose) {
+                std::vector<vector6d_t> solutions;
+                if (!self.solveAll(pose.data(), solutions)) {
+                    throw std::runtime_error("The closed-form solver does not support these DH parameters");
+                }
+                return solutions;
+            },
+            py::arg("pose"),
+            R"doc(
+                Compute every closed-form solution of a TCP pose. Joints are wrapped to [-pi, pi], joint limits are not applied.
+
+                Args:
+                    pose (list): TCP pose [x, y, z, rx, ry, rz]
+
+                Returns:
+                    list: Up to 8 solutions. Empty if the pose is unreachable.
+            )doc")
+        .def(
+            "solve",
+            [](const InverseKinematicsSolver& self, const vector6d_t& pose, const vector6d_t& seed) {
+                vector6d_t q = seed;
+                IkStatus status = self.solve(pose.data(), seed.data(), q.data());
+                return py::make_tuple(status, q);
+            },
+            py::arg("pose"), py::arg("seed"),
+            R"doc(
+                Solve the joint positions of a TCP pose, choosing the solution closest to `seed`.
+
+                Args:
+                    pose (list): TCP pose [x, y, z, rx, ry, rz]
+                    seed (list): Reference joint positions, usually the current or previous joint positions.
+
+                Returns:
+                    tuple: (IkStatus, list). The joint positions are valid if the status is SUCCESS or NEAR_SINGULAR,
+                        otherwise they equal `seed`.
+            )doc")
+        .def(
+            "solveBatch",
+            [](const InverseKinematicsSolver& self, const DoubleArray& poses, const DoubleArray& seeds, int threads) {
+                size_t trajectories = 1, samples = 0;
+                if (poses.ndim() == 3 && poses.shape(2) == 6) {
+                    trajectories = static_cast<size_t>(poses.shape(0));
+                    samples = static_cast<size_t>(poses.shape(1));
+                } else {
+                    samples = requireRows(poses, 6, "poses");
+                }
+                if (requireRows(seeds, 6, "seeds") != trajectories || (poses.ndim() == 3) != (seeds.ndim() == 2)) {
+                    throw std::runtime_error("seeds must have one row of 6 joints per trajectory");
+                }
+
+                std::vector<py::ssize_t> shape(poses.shape(), poses.shape() + poses.ndim());
+                DoubleArray q(shape);
+                shape.pop_back();
+                py::array_t<int8_t> status(shape);
+                std::vector<IkStatus> result(trajectories * samples);
+                const double* in = poses.data();
+                const double* seed = seeds.data();
+                double* out = q.mutable_data();
+                {
+                    py::gil_scoped_release release;
+                    self.solveBatch(in, seed, trajectories, samples, out, result.data(), threads);
+                }
+                int8_t* status_out = status.mutable_data();
+                for (size_t i = 0; i < result.size(); ++i) {
+                    status_out[i] = static_cast<int8_t>(result[i]);
+                }
+                return py::make_tuple(q, status);
+            },
+            py::arg("poses"), py::arg("seeds"), py::arg("threads") = 0,
+            R"doc(
+                Solve one or several cartesian paths. Every sample is seeded with the solution of the previous sample.
+                Several trajectories are solved in parallel, one trajectory per worker at a time.
+
+                Args:
+                    poses (numpy.ndarray): TCP poses, shape (N, 6) for one trajectory or (M, N, 6) for M trajectories.
+                    seeds (numpy.ndarray): Initial joint positions, shape (6,) or (M, 6).
+                    threads (int): Number of worker threads, 0 uses all cores.
+
+                Returns:
+                    tuple: (q, status). `q` has the shape of `poses`, `status` has shape (N,) or (M, N) and holds
+                        `IkStatus` values as int8. A failed sample keeps the seed of the previous one.
+            )doc");
+}
@@ -0,0 +1,226 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "KinematicsSolver.hpp"
+#include "ParallelFor.hpp"
+#include "RotationUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace ELITE;
+
+namespace {
+
+// Minimum samples per worker thread, below this the thread start-up cost dominates.
+constexpr size_t PARALLEL_MIN_CHUNK = 2048;
+
+// SoA homogeneous transform of a block: 12 rows (r00 r01 r02 px r10 r11 r12 py r20 r21 r22 pz) x LANES.
+using BlockTransform = double[12][KinematicsSolver::LANES];
+
+inline void blockIdentity(BlockTransform t) {
+    for (int i = 0; i < 12; ++i) {
+        const double v = (i == 0 || i == 5 || i == 10) ? 1.0 : 0.0;
+        for (size_t l = 0; l < KinematicsSolver::LANES; ++l) {
+            t[i][l] = v;
+        }
+    }
+}
+
+// Right-multiply the block transform by the standard DH transform Rz(q) Tz(d) Tx(a) Rx(alpha).
+inline void blockApplyJoint(BlockTransform t, const double* ct, const double* st, double a, double d, double ca, double sa) {
+    for (int r = 0; r < 3; ++r) {
+        double* c0 = t[r * 4];
+        double* c1 = t[r * 4 + 1];
+        double* c2 = t[r * 4 + 2];
+        double* p = t[r * 4 + 3];
+        for (size_t l = 0; l < KinematicsSolver::LANES; ++l) {
+            const double n0 = ct[l] * c0[l] + st[l] * c1[l];
+            const double m = ct[l] * c1[l] - st[l] * c0[l];
+            const double n1 = ca * m + sa * c2[l];
+            const double n2 = ca * c2[l] - sa * m;
+            p[l] += a * n0 + d * c2[l];
+            c0[l] = n0;
+            c1[l] = n1;
+            c2[l] = n2;
+        }
+    }
+}
+
+// Load joint `j` of `n` samples (row stride 6) and compute its cosine and sine. Missing lanes are zero.
+inline void blockLoadJoint(const double* q, size_t n, int j, double* ct, double* st) {
+    double qj[KinematicsSolver::LANES];
+    for (size_t l = 0; l < KinematicsSolver::LANES; ++l) {
+        qj[l] = l < n ? q[l * KinematicsSolver::JOINTS + j] : 0.0;
+    }
+    for (size_t l = 0; l < KinematicsSolver::LANES; ++l) {
+        ct[l] = std::cos(qj[l]);
+        st[l] = std::sin(qj[l]);
+    }
+}
+
+}  // namespace
+
+KinematicsSolver::KinematicsSolver(const vector6d_t& dh_a, const vector6d_t& dh_d, const vector6d_t& dh_alpha)
+    : dh_a_(dh_a), dh_d_(dh_d), dh_alpha_(dh_alpha) {
+    for (int j = 0; j < JOINTS; ++j) {
+        cos_alpha_[j] = std::cos(dh_alpha_[j]);
+        sin_alpha_[j] = std::sin(dh_alpha_[j]);
+    }
+    setTcp(vector6d_t{0, 0, 0, 0, 0, 0});
+}
+
+void KinematicsSolver::setTcp(const vector6d_t& tcp) {
+    tcp_ = tcp;
+    rotvecToMatrix(&tcp_[3], tcp_rot_);
+    tcp_identity_ = true;
+    for (double v : tcp_) {
+        if (v != 0.0) {
+            tcp_identity_ = false;
+            break;
+        }
+    }
+}
+
+void KinematicsSolver::flangeTransform(const double* q, double* R, double* p) const {
+    double T[12] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0};
+    for (int j = 0; j < JOINTS; ++j) {
+        const double ct = std::cos(q[j]), st = std::sin(q[j]);
+        for (int r = 0; r < 3; ++r) {
+            double* row = T + r * 4;
+            const double n0 = ct * row[0] + st * row[1];
+            const double m = ct * row[1] - st * row[0];
+            row[3] += dh_a_[j] * n0 + dh_d_[j] * row[2];
+            row[0] = n0;
+            row[1] = cos_alpha_[j] * m + sin_alpha_[j] * row[2];
+            row[2] = cos_alpha_[j] * row[2] - sin_alpha_[j] * m;
+        }
+    }
+    for (int r = 0; r < 3; ++r) {
+        R[r * 3] = T[r * 4], R[r * 3 + 1] = T[r * 4 + 1], R[r * 3 + 2] = T[r * 4 + 2];
+        p[r] = T[r * 4 + 3];
+    }
+}
+
+void KinematicsSolver::linkFrames(const double* q, double* frames) const {
+    const double base[12] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0};
+    std::copy(base, base + 12, frames);
+    for (int j = 0; j < JOINTS; ++j) {
+        double* T = frames + (j + 1) * 12;
+        std::copy(T - 12, T, T);
+        const double ct = std::cos(q[j]), st = std::sin(q[j]);
+        for (int r = 0; r < 3; ++r) {
+            double* row = T + r * 4;
+            const double n0 = ct * row[0] + st * row[1];
+            const double m = ct * row[1] - st * row[0];
+            row[3] += dh_a_[j] * n0 + dh_d_[j] * row[2];
+            row[0] = n0;
+            row[1] = cos_alpha_[j] * m + sin_alpha_[j] * row[2];
+            row[2] = cos_alpha_[j] * row[2] - sin_alpha_[j] * m;
+        }
+    }
+}
+
+void KinematicsSolver::forwardTransform(const double* q, double* R, double* p) const {
+    double Rf[9], pf[3];
+    flangeTransform(q, Rf, pf);
+    for (int r = 0; r < 3; ++r) {
+        p[r] = pf[r] + Rf[r * 3] * tcp_[0] + Rf[r * 3 + 1] * tcp_[1] + Rf[r * 3 + 2] * tcp_[2];
+    }
+    matMul3(Rf, tcp_rot_, R);
+}
+
+vector6d_t KinematicsSolver::forward(const vector6d_t& q) const {
+    vector6d_t pose;
+    forwardBlock(q.data(), 1, pose.data());
+    return pose;
+}
+
+void KinematicsSolver::forwardBatch(const double* q, size_t count, double* pose, int threads) const {
+    parallelFor(count, PARALLEL_MIN_CHUNK, threads, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i += LANES) {
+            const size_t n = std::min(LANES, end - i);
+            forwardBlock(q + i * JOINTS, n, pose + i * 6);
+        }
+    });
+}
+
+void KinematicsSolver::jacobianBatch(const double* q, size_t count, double* jac, int threads) const {
+    parallelFor(count, PARALLEL_MIN_CHUNK, threads, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i += LANES) {
+            const size_t n = std::min(LANES, end - i);
+            jacobianBlock(q + i * JOINTS, n, jac + i * 36);
+        }
+    });
+}
+
+void KinematicsSolver::forwardBlock(const double* q, size_t n, double* pose) const {
+    alignas(64) BlockTransform t;
+    alignas(64) double ct[LANES];
+    alignas(64) double st[LANES];
+
+    blockIdentity(t);
+    for (int j = 0; j < JOINTS; ++j) {
+        blockLoadJoint(q, n, j, ct, st);
+        blockApplyJoint(t, ct, st, dh_a_[j], dh_d_[j], cos_alpha_[j], sin_alpha_[j]);
+    }
+
+    for (size_t l = 0; l < n; ++l) {
+        const double Rf[9] = {t[0][l], t[1][l], t[2][l], t[4][l], t[5][l], t[6][l], t[8][l], t[9][l], t[10][l]};
+        double* out = pose + l * 6;
+        if (tcp_identity_) {
+            out[0] = t[3][l], out[1] = t[7][l], out[2] = t[11][l];
+            matrixToRotvec(Rf, out + 3);
+            continue;
+        }
+        double R[9];
+        matMul3(Rf, tcp_rot_, R);
+        for (int r = 0; r < 3; ++r) {
+            out[r] = t[r * 4 + 3][l] + Rf[r * 3] * tcp_[0] + Rf[r * 3 + 1] * tcp_[1] + Rf[r * 3 + 2] * tcp_[2];
+        }
+        matrixToRotvec(R, out + 3);
+    }
+}
+
+void KinematicsSolver::jacobianBlock(const double* q, size_t n, double* jac) const {
+    alignas(64) BlockTransform t;
+    alignas(64) double ct[LANES];
+    alignas(64) double st[LANES];
+    // Joint axis and origin of every joint in the base frame, [joint][xyz][lane]
+    alignas(64) double axis[JOINTS][3][LANES];
+    alignas(64) double origin[JOINTS][3][LANES];
+
+    blockIdentity(t);
+    for (int j = 0; j < JOINTS; ++j) {
+        for (int r = 0; r < 3; ++r) {
+            for (size_t l = 0; l < LANES; ++l) {
+                axis[j][r][l] = t[r * 4 + 2][l];
+                origin[j][r][l] = t[r * 4 + 3][l];
+            }
+        }
+        blockLoadJoint(q, n, j, ct, st);
+        blockApplyJoint(t, ct, st, dh_a_[j], dh_d_[j], cos_alpha_[j], sin_alpha_[j]);
+    }
+
+    alignas(64) double tip[3][LANES];
+    for (int r = 0; r < 3; ++r) {
+        for (size_t l = 0; l < LANES; ++l) {
+            tip[r][l] = t[r * 4 + 3][l] + t[r * 4][l] * tcp_[0] + t[r * 4 + 1][l] * tcp_[1] + t[r * 4 + 2][l] * tcp_[2];
+        }
+    }
+
+    for (int j = 0; j < JOINTS; ++j) {
+        for (size_t l = 0; l < n; ++l) {
+            const double zx = axis[j][0][l], zy = axis[j][1][l], zz = axis[j][2][l];
+            const double dx = tip[0][l] - origin[j][0][l];
+            const double dy = tip[1][l] - origin[j][1][l];
+            const double dz = tip[2][l] - origin[j][2][l];
+            double* J = jac + l * 36;
+            J[0 * 6 + j] = zy * dz - zz * dy;
+            J[1 * 6 + j] = zz * dx - zx * dz;
+            J[2 * 6 + j] = zx * dy - zy * dx;
+            J[3 * 6 + j] = zx;
+            J[4 * 6 + j] = zy;
+            J[5 * 6 + j] = zz;
+        }
+    }
+}
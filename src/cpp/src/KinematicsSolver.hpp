@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <Elite/DataType.hpp>
+
+#include <cstddef>
+
+/**
+ * @brief Forward kinematics and geometric Jacobians of a 6-axis arm described by standard DH parameters.
+ *
+ * Batches are processed in structure-of-arrays blocks of `LANES` samples so that the inner loops vectorize,
+ * and large batches are split across worker threads. All buffers are contiguous row-major arrays of doubles.
+ * Poses use the controller's [x, y, z, rx, ry, rz] convention (rotation vector), like `getActualTCPPose()`.
+ */
+class KinematicsSolver {
+   public:
+    static constexpr int JOINTS = 6;
+    static constexpr size_t LANES = 8;
+
+    /**
+     * @brief Construct from standard DH parameters, usually read from `KinematicsInfo`.
+     */
+    KinematicsSolver(const ELITE::vector6d_t& dh_a, const ELITE::vector6d_t& dh_d, const ELITE::vector6d_t& dh_alpha);
+
+    /**
+     * @brief Set the tool center point relative to the flange. Defaults to identity.
+     *
+     * @param tcp TCP pose [x, y, z, rx, ry, rz] in the flange frame
+     */
+    void setTcp(const ELITE::vector6d_t& tcp);
+
+    const ELITE::vector6d_t& getTcp() const { return tcp_; }
+
+    const ELITE::vector6d_t& dhA() const { return dh_a_; }
+    const ELITE::vector6d_t& dhD() const { return dh_d_; }
+    const ELITE::vector6d_t& dhAlpha() const { return dh_alpha_; }
+
+    /**
+     * @brief Compute the TCP pose of one joint configuration.
+     */
+    ELITE::vector6d_t forward(const ELITE::vector6d_t& q) const;
+
+    /**
+     * @brief Compute the TCP transform of one joint configuration.
+     *
+     * @param q Joint positions
+     * @param R Output rotation, 3x3 row-major
+     * @param p Output position
+     */
+    void forwardTransform(const double* q, double* R, double* p) const;
+
+    /**
+     * @brief Same as forwardTransform(), without the TCP offset.
+     */
+    void flangeTransform(const double* q, double* R, double* p) const;
+
+    /**
+     * @brief Compute the frame of every joint of one configuration, for link geometry.
+     *
+     * @param q Joint positions
+     * @param frames Output, `JOINTS + 1` transforms 3x4 row-major [R | p]: the base, then the frame after each joint
+     *               (the last one is the flange)
+     */
+    void linkFrames(const double* q, double* frames) const;
+
+    /**
+     * @brief Compute the TCP poses of `count` joint configurations.
+     *
+     * @param q Input joints, `count` x 6
+     * @param count Number of samples
+     * @param pose Output poses, `count` x 6
+     * @param threads Number of worker threads, 0 uses all hardware threads
+     */
+    void forwardBatch(const double* q, size_t count, double* pose, int threads = 0) const;
+
+    /**
+     * @brief Compute the geometric Jacobians, in the base frame, of `count` joint configurations.
+     *
+     * Each Jacobian is 6x6 row-major. Rows 0-2 are the TCP linear velocity, rows 3-5 the angular velocity.
+     *
+     * @param q Input joints, `count` x 6
+     * @param count Number of samples
+     * @param jac Output Jacobians, `count` x 36
+     * @param threads Number of worker threads, 0 uses all hardware threads
+     */
+    void jacobianBatch(const double* q, size_t count, double* jac, int threads = 0) const;
+
+   private:
+    // Process one SoA block of at most LANES samples.
+    void forwardBlock(const double* q, size_t n, double* pose) const;
+    void jacobianBlock(const double* q, size_t n, double* jac) const;
+
+    ELITE::vector6d_t dh_a_;
+    ELITE::vector6d_t dh_d_;
+    ELITE::vector6d_t dh_alpha_;
+    double cos_alpha_[JOINTS];
+    double sin_alpha_[JOINTS];
+
+    ELITE::vector6d_t tcp_;
+    double tcp_rot_[9];
+    bool tcp_identity_;
+};
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "KinematicsWrapper.hpp"
+#include "KinematicsSolver.hpp"
+#include "NdArrayUtils.hpp"
+
+#include <Elite/RobotConfPackage.hpp>
+
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+using namespace ELITE;
+
+void bindKinematics(py::module_& m) {
+    py::class_<KinematicsSolver, std::shared_ptr<KinematicsSolver>>(
+        m, "Kinematics",
+        "Native forward kinematics and Jacobians based on the DH parameters of the robot. "
+        "Batch functions take numpy arrays and release the GIL while computing.")
+        .def(py::init([](const KinematicsInfo& info) {
+                 return std::make_shared<KinematicsSolver>(info.dh_a_, info.dh_d_, info.dh_alpha_);
+             }),
+             py::arg("info"),
+             R"doc(
+                Construct from the kinematics configuration of the robot.
+
+                Args:
+                    info (KinematicsInfo): Kinematics package read by `getPackage()` or `getPrimaryPackage()`.
+            )doc")
+        .def(py::init<const vector6d_t&, const vector6d_t&, const vector6d_t&>(), py::arg("dh_a"), py::arg("dh_d"),
+             py::arg("dh_alpha"),
+             R"doc(
+                Construct from standard DH parameters.
+
+                Args:
+                    dh_a (list): DH a, unit: m
+                    dh_d (list): DH d, unit: m
+                    dh_alpha (list): DH alpha, unit: rad
+            )doc")
+        .def("setTcp", &KinematicsSolver::setTcp, py::arg("tcp"),
+             R"doc(
+                Set the TCP offset relative to the flange. The default is no offset.
+
+                Args:
+                    tcp (list): TCP pose [x, y, z, rx, ry, rz] in the flange frame.
+            )doc")
+        .def("getTcp", &KinematicsSolver::getTcp, "Get the TCP offset relative to the flange.")
+        .def("forward", &KinematicsSolver::forward, py::arg("q"),
+             R"doc(
+                Compute the TCP pose of one joint configuration.
+
+                Args:
+                    q (list): Joint positions, unit: rad
+
+                Returns:
+                    list: TCP pose [x, y, z, rx, ry, rz], same convention as `getActualTCPPose()`.
+            )doc")
+        .def(
+            "forwardBatch",
+            [](const KinematicsSolver& self, const DoubleArray& q, int threads) {
+                const size_t count = requireRows(q, 6, "q");
+                DoubleArray pose(std::vector<py::ssize_t>(q.shape(), q.shape() + q.ndim()));
+                const double* in = q.data();
+                double* out = pose.mutable_data();
+                {
+                    py::gil_scoped_release release;
+                    self.forwardBatch(in, count, out, threads);
+                }
+                return pose;
+            },
+            py::arg("q"), py::arg("threads") = 0,
+            R"doc(
+                Compute the TCP poses of a batch of joint configurations.
+
+                Args:
+                    q (numpy.ndarray): Joint positions, shape (N, 6)
+                    threads (int): Number of worker threads, 0 uses all cores. Small batches always run on the calling thread.
+
+                Returns:
+                    numpy.ndarray: TCP poses [x, y, z, rx, ry, rz], shape (N, 6)
+            )doc")
+        .def(
+            "jacobian",
+            [](const KinematicsSolver& self, const DoubleArray& q, int threads) {
+                const size_t count = requireRows(q, 6, "q");
+                std::vector<py::ssize_t> shape{6, 6};
+                if (q.ndim() == 2) {
+                    shape.insert(shape.begin(), static_cast<py::ssize_t>(count));
+                }
+                DoubleArray jac(shape);
+                const double* in = q.data();
+                double* out = jac.mutable_data();
+                {
+                    py::gil_scoped_release release;
+                    self.jacobianBatch(in, count, out, threads);
+                }
+                return jac;
+            },
+            py::arg("q"), py::arg("threads") = 0,
+            R"doc(
+                Compute the geometric Jacobians in the base frame.
+                Rows 0-2 map joint velocities to TCP linear velocity, rows 3-5 to TCP angular velocity.
+
+                Args:
+                    q (numpy.ndarray): Joint positions, shape (6,) or (N, 6)
+                    threads (int): Number of worker threads, 0 uses all cores.
+
+                Returns:
+                    numpy.ndarray: Jacobians, shape (6, 6) or (N, 6, 6)
+            )doc")
+        .def_property_readonly("dh_a", &KinematicsSolver::dhA, "DH a")
+        .def_property_readonly("dh_d", &KinematicsSolver::dhD, "DH d")
+        .def_property_readonly("dh_alpha", &KinematicsSolver::dhAlpha, "DH alpha");
+}
@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "LogRateLimiter.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+using namespace ELITE;
+
+namespace {
+
+// Number of table slots probed before a call site is left unlimited.
+constexpr size_t MAX_PROBES = 16;
+
+constexpr uint64_t FNV_OFFSET = 1469598103934665603ULL;
+constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+uint64_t hashText(const char* text, uint64_t h = FNV_OFFSET) {
+    if (text == nullptr) {
+        return h;
+    }
+    for (; *text; ++text) {
+        h = (h ^ static_cast<unsigned char>(*text)) * FNV_PRIME;
+    }
+    return h;
+}
+
+int64_t steadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+}  // namespace
+
+LogRateLimiter::LogRateLimiter() : sites_(new Site[MAX_SITES]) {
+    for (int i = 0; i < LEVELS; ++i) {
+        interval_ns_[i] = 0;
+        tolerance_ns_[i] = 0;
+    }
+    const LogLevel limited[] = {LogLevel::ELI_DEBUG, LogLevel::ELI_INFO, LogLevel::ELI_WARN, LogLevel::ELI_ERROR};
+    for (auto level : limited) {
+        setLevelLimit(level, 20.0, 50);
+    }
+}
+
+void LogRateLimiter::setLevelLimit(LogLevel level, double rate, int burst) {
+    const int index = static_cast<int>(level);
+    if (index < 0 || index >= LEVELS) {
+        return;
+    }
+    if (rate <= 0) {
+        interval_ns_[index] = 0;
+        return;
+    }
+    const auto interval = static_cast<int64_t>(1e9 / rate);
+    tolerance_ns_[index] = interval * std::max(burst - 1, 0);
+    interval_ns_[index] = std::max<int64_t>(interval, 1);
+}
+
+LogRateLimiter::Site* LogRateLimiter::findSite(const char* file, int line, LogLevel level) {
+    uint64_t key = hashText(file) ^ (static_cast<uint64_t>(line) * 0x9E3779B97F4A7C15ULL);
+    if (key == 0) {
+        key = 1;
+    }
+    for (size_t probe = 0; probe < MAX_PROBES; ++probe) {
+        Site& site = sites_[(key + probe) & (MAX_SITES - 1)];
+        uint64_t current = site.key.load(std::memory_order_acquire);
+        if (current == 0) {
+            if (site.key.compare_exchange_strong(current, key, std::memory_order_acq_rel)) {
+                // Describe the call site for the summaries
+                const char* src = file ? file : "";
+                const size_t len = std::strlen(src);
+                const size_t keep = std::min(len, sizeof(site.file) - 1);
+                std::memcpy(site.file, src + (len - keep), keep);
+                site.file[keep] = '\0';
+                site.line = line;
+                site.level = level;
+                site.ready.store(true, std::memory_order_release);
+                return &site;
+            }
+        }
+        if (current == key) {
+            return &site;
+        }
+    }
+    return nullptr;
+}
+
+bool LogRateLimiter::allow(Site& site, int level, int64_t now) {
+    if (level < 0 || level >= LEVELS) {
+        return true;
+    }
+    const int64_t interval = interval_ns_[level].load(std::memory_order_relaxed);
+    if (interval == 0) {
+        return true;
+    }
+    const int64_t tolerance = tolerance_ns_[level].load(std::memory_order_relaxed);
+    int64_t tat = site.tat_ns.load(std::memory_order_relaxed);
+    for (;;) {
+        const int64_t base = std::max(tat, now);
+        if (base - now > tolerance) {
+            return false;
+        }
+        if (site.tat_ns.compare_exchange_weak(tat, base + interval, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+}
+
+void LogRateLimiter::emitSummary(LogHandler& downstream, Site& site) {
+    if (!site.ready.load(std::memory_order_acquire)) {
+        return;
+    }
+    char text[128];
+    const uint32_t repeated = site.repeated.exchange(0, std::memory_order_relaxed);
+    if (repeated > 0) {
+        std::snprintf(text, sizeof(text), "Previous message repeated %u times", repeated);
+        downstream.log(site.file, site.line, site.level, text);
+    }
+    const uint32_t dropped = site.dropped.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0) {
+        std::snprintf(text, sizeof(text), "%u messages suppressed by the rate limit", dropped);
+        downstream.log(site.file, site.line, site.level, text);
+    }
+}
+
+void LogRateLimiter::sweep(LogHandler& downstream, int64_t now) {
+    int64_t last = last_sweep_ns_.load(std::memory_order_relaxed);
+    if (now - last < summary_interval_ns_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    // Only the thread that moves the sweep time forward runs the sweep
+    if (!last_sweep_ns_.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+        return;
+    }
+    flush(downstream);
+}
+
+void LogRateLimiter::flush(LogHandler& downstream) {
+    for (size_t i = 0; i < MAX_SITES; ++i) {
+        Site& site = sites_[i];
+        if (site.repeated.load(std::memory_order_relaxed) != 0 || site.dropped.load(std::memory_order_relaxed) != 0) {
+            emitSummary(downstream, site);
+        }
+    }
+}
+
+bool LogRateLimiter::log(LogHandler& downstream, const char* file, int line, LogLevel level, const char* message) {
+    const int64_t now = steadyNowNs();
+    sweep(downstream, now);
+
+    Site* site = findSite(file, line, level);
+    if (site == nullptr) {
+        forwarded_.fetch_add(1, std::memory_order_relaxed);
+        downstream.log(file, line, level, message);
+        return true;
+    }
+
+    if (deduplicate_.load(std::memory_order_relaxed)) {
+        uint64_t h = hashText(message);
+        if (h == 0) {
+            h = 1;
+        }
+        if (site->last_hash.exchange(h, std::memory_order_relaxed) == h) {
+            site->repeated.fetch_add(1, std::memory_order_relaxed);
+            collapsed_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    if (!allow(*site, static_cast<int>(level), now)) {
+        site->dropped.fetch_add(1, std::memory_order_relaxed);
+        suppressed_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    emitSummary(downstream, *site);
+    forwarded_.fetch_add(1, std::memory_order_relaxed);
+    downstream.log(file, line, level, message);
+    return true;
+}
+
+RateLimitedLogHandler::RateLimitedLogHandler(std::shared_ptr<LogRateLimiter> limiter,
+                                             std::unique_ptr<LogHandler> downstream)
+    : state_(std::make_shared<State>()) {
+    state_->limiter = std::move(limiter);
+    state_->downstream = std::move(downstream);
+    thread_ = std::thread(&RateLimitedLogHandler::flushLoop, state_);
+}
+
+RateLimitedLogHandler::~RateLimitedLogHandler() {
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->stopped = true;
+    }
+    state_->cv.notify_all();
+    if (thread_.get_id() == std::this_thread::get_id()) {
+        // Destroyed by the wrapped handler while it receives a summary: the thread keeps the state alive and ends
+        // when the summary returns
+        thread_.detach();
+    } else {
+        thread_.join();
+    }
+    state_->limiter->flush(*state_->downstream);
+}
+
+void RateLimitedLogHandler::flushLoop(std::shared_ptr<State> state) {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    while (!state->stopped) {
+        const auto interval = std::chrono::milliseconds(std::max(state->limiter->getSummaryInterval(), 1));
+        if (state->cv.wait_for(lock, interval, [&state] { return state->stopped; })) {
+            break;
+        }
+        lock.unlock();
+        state->limiter->flush(*state->downstream);
+        lock.lock();
+    }
+}
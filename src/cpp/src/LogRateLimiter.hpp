@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <Elite/Log.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief Rate limiting and deduplication of log messages, keyed by call site (file and line).
+ *
+ * Identical consecutive messages of a call site are collapsed and reported as "Previous message repeated N times".
+ * Every call site has a token bucket whose rate and burst are configured per LogLevel; messages over the limit are
+ * suppressed and counted. Pending summaries are emitted before the next message of the call site, or by the sweep
+ * that the first message after each summary interval runs over all call sites. RateLimitedLogHandler also flushes
+ * them every summary interval and when it is uninstalled, for call sites that went quiet.
+ *
+ * The accept path only uses atomics, it never takes a lock or allocates. Call sites beyond the table capacity are
+ * not limited.
+ */
+class LogRateLimiter {
+   public:
+    static constexpr size_t MAX_SITES = 1024;
+    static constexpr int LEVELS = 6;
+
+    LogRateLimiter();
+
+    LogRateLimiter(const LogRateLimiter&) = delete;
+    LogRateLimiter& operator=(const LogRateLimiter&) = delete;
+
+    /**
+     * @brief Limit the messages of every call site of a level. Default: 20 messages/s with a burst of 50, except
+     * ELI_FATAL which is not limited.
+     *
+     * @param rate Sustained messages per second, <= 0 disables the limit
+     * @param burst Messages accepted at once after a quiet period
+     */
+    void setLevelLimit(ELITE::LogLevel level, double rate, int burst);
+
+    /**
+     * @brief Enable the collapsing of identical consecutive messages. Default true.
+     */
+    void setDeduplicate(bool enable) { deduplicate_ = enable; }
+    bool getDeduplicate() const { return deduplicate_; }
+
+    /**
+     * @brief Set the period of the summaries of collapsed and suppressed messages. Default 1000 ms.
+     */
+    void setSummaryInterval(int interval_ms) { summary_interval_ns_ = static_cast<int64_t>(interval_ms) * 1000000; }
+    int getSummaryInterval() const { return static_cast<int>(summary_interval_ns_ / 1000000); }
+
+    /**
+     * @brief Filter one message, and forward it with any pending summary to `downstream`.
+     *
+     * @return true if the message was forwarded
+     */
+    bool log(ELITE::LogHandler& downstream, const char* file, int line, ELITE::LogLevel level, const char* message);
+
+    /**
+     * @brief Emit the pending summaries of all call sites to `downstream`.
+     */
+    void flush(ELITE::LogHandler& downstream);
+
+    uint64_t forwarded() const { return forwarded_; }
+    uint64_t collapsed() const { return collapsed_; }
+    uint64_t suppressed() const { return suppressed_; }
+
+   private:
+    struct Site {
+        std::atomic<uint64_t> key{0};
+        std::atomic<bool> ready{false};
+        char file[96];
+        int line;
+        ELITE::LogLevel level;
+        std::atomic<int64_t> tat_ns{0};  // Theoretical arrival time of the token bucket (GCRA)
+        std::atomic<uint64_t> last_hash{0};
+        std::atomic<uint32_t> repeated{0};
+        std::atomic<uint32_t> dropped{0};
+    };
+
+    Site* findSite(const char* file, int line, ELITE::LogLevel level);
+    bool allow(Site& site, int level, int64_t now);
+    void emitSummary(ELITE::LogHandler& downstream, Site& site);
+    void sweep(ELITE::LogHandler& downstream, int64_t now);
+
+    std::unique_ptr<Site[]> sites_;
+    std::atomic<int64_t> interval_ns_[LEVELS];
+    std::atomic<int64_t> tolerance_ns_[LEVELS];
+    std::atomic<bool> deduplicate_{true};
+    std::atomic<int64_t> summary_interval_ns_{1000000000};
+    std::atomic<int64_t> last_sweep_ns_{0};
+
+    std::atomic<uint64_t> forwarded_{0};
+    std::atomic<uint64_t> collapsed_{0};
+    std::atomic<uint64_t> suppressed_{0};
+};
+
+/**
+ * @brief SDK log handler that passes every message through a LogRateLimiter before the wrapped handler.
+ *
+ * A timer thread flushes the pending summaries every summary interval, so that a call site that went quiet is still
+ * reported when no other message is logged. The destructor stops and joins the timer thread, then flushes the
+ * remaining summaries. The timer thread may be delivering a summary to a handler that needs a lock (the GIL): destroy
+ * the handler without holding it.
+ */
+class RateLimitedLogHandler : public ELITE::LogHandler {
+   public:
+    RateLimitedLogHandler(std::shared_ptr<LogRateLimiter> limiter, std::unique_ptr<ELITE::LogHandler> downstream);
+    ~RateLimitedLogHandler() override;
+
+    RateLimitedLogHandler(const RateLimitedLogHandler&) = delete;
+    RateLimitedLogHandler& operator=(const RateLimitedLogHandler&) = delete;
+
+    void log(const char* file, int line, ELITE::LogLevel loglevel, const char* log) override {
+        state_->limiter->log(*state_->downstream, file, line, loglevel, log);
+    }
+
+   private:
+    struct State {
+        std::shared_ptr<LogRateLimiter> limiter;
+        std::unique_ptr<ELITE::LogHandler> downstream;
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool stopped = false;
+    };
+
+    static void flushLoop(std::shared_ptr<State> state);
+
+    std::shared_ptr<State> state_;
+    std::thread thread_;
+};
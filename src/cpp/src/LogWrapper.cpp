@@ -1,9 +1,15 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2025, Elite Robots.
 #include "LogWrapper.hpp"
+#include "AsyncLogSink.hpp"
+#include "BinaryLog.hpp"
+#include "GilSafeObject.hpp"
+#include "LogRateLimiter.hpp"
 #include <Elite/Log.hpp>
+#include <cstring>
 #include <memory>
 #include <string>
+#include <thread>
 
 namespace py = pybind11;
 using namespace ELITE;
@@ -18,11 +24,18 @@ class PyLogHandler : public LogHandler {
     }
 };
 
+// Replacing the SDK handler may destroy a RateLimitedLogHandler, which joins its timer thread: the thread may be
+// waiting for the GIL to deliver a summary to a Python handler
+static void replaceLogHandler(std::unique_ptr<LogHandler> handler) {
+    py::gil_scoped_release release;
+    registerLogHandler(std::move(handler));
+}
+
 void registerLogHandlerRaw(LogHandler* handler) {
     static std::unique_ptr<LogHandler> current_handler;
     current_handler.reset();
     current_handler.reset(handler);
-    registerLogHandler(std::unique_ptr<LogHandler>(current_handler.get()));
+    replaceLogHandler(std::unique_ptr<LogHandler>(current_handler.get()));
 }
 
 void logDebugMessage(const std::string& file, int line, const std::string& msg) {
@@ -49,6 +62,295 @@ void logNoneMessage(const std::string& file, int line, const std::string& msg) {
     ELITE::log(file.c_str(), line, LogLevel::ELI_NONE, "%s", msg.c_str());
 }
 
+// Decode a possibly truncated UTF-8 buffer, a split multi-byte character is replaced instead of raising
+static py::str decodeLogText(const char* text, size_t len) {
+    return py::reinterpret_steal<py::str>(PyUnicode_DecodeUTF8(text, static_cast<Py_ssize_t>(len), "replace"));
+}
+
+static void bindAsyncLogSink(pybind11::module_& m) {
+    py::class_<AsyncLogSink, std::shared_ptr<AsyncLogSink>>(
+        m, "AsyncLogSink",
+        "Asynchronous log sink. SDK threads copy messages into a lock-free ring buffer and never wait for Python, "
+        "a drain thread delivers them in batches to a Python handler or writes them to a file descriptor.")
+        .def(py::init([](size_t capacity, int flush_interval_ms) {
+                 return std::shared_ptr<AsyncLogSink>(new AsyncLogSink(capacity, flush_interval_ms), [](AsyncLogSink* p) {
+                     // The handler may drop the last reference (e.g. unregisterLogHandler()) on the drain thread,
+                     // which the destructor joins: the sink is deleted on a thread of its own instead
+                     if (p->isDrainThread()) {
+                         std::thread([p] { delete p; }).detach();
+                         return;
+                     }
+                     GilReleasingDeleter<AsyncLogSink>()(p);
+                 });
+             }),
+             py::arg("capacity") = 4096, py::arg("flush_interval_ms") = 10,
+             R"doc(
+                Args:
+                    capacity (int): Number of messages the ring buffer holds, rounded up to a power of two
+                    flush_interval_ms (int): Maximum time a message waits in the ring buffer before it is delivered
+            )doc")
+        .def(
+            "setHandler",
+            [](AsyncLogSink& self, py::object handler) {
+                if (handler.is_none()) {
+                    self.setBatchCallback(nullptr);
+                    return;
+                }
+                const bool per_record = py::isinstance<LogHandler>(handler);
+                auto handler_ptr = makeGilSafe(std::move(handler));
+                self.setBatchCallback([handler_ptr, per_record](const LogRecord* records, size_t count) {
+                    py::gil_scoped_acquire gil;
+                    try {
+                        if (per_record) {
+                            py::object log = handler_ptr->attr("log");
+                            for (size_t i = 0; i < count; ++i) {
+                                const LogRecord& r = records[i];
+                                log(decodeLogText(r.file, std::strlen(r.file)), r.line, r.level,
+                                    decodeLogText(r.message, r.message_len));
+                            }
+                            return;
+                        }
+                        py::list batch(count);
+                        for (size_t i = 0; i < count; ++i) {
+                            const LogRecord& r = records[i];
+                            batch[i] = py::make_tuple(decodeLogText(r.file, std::strlen(r.file)), r.line, r.level,
+                                                      decodeLogText(r.message, r.message_len), r.timestamp);
+                        }
+                        (*handler_ptr)(batch);
+                    } catch (const py::error_already_set& e) {
+                        py::print("Python log handler raised exception:", e.what());
+                    }
+                });
+            },
+            py::arg("handler"),
+            R"doc(
+                Set the Python consumer, called on the drain thread with the GIL acquired once per batch.
+
+                Args:
+                    handler: A LogHandler, whose log() is called for every message of the batch, or a callable
+                        receiving a list of (file, line, level, msg, timestamp) tuples. None restores the file
+                        descriptor output.
+            )doc")
+        .def("setFileDescriptor", &AsyncLogSink::setFileDescriptor, py::arg("fd"),
+             R"doc(
+                Write formatted messages to a file descriptor when no handler is set, without taking the GIL.
+
+                Args:
+                    fd (int): File descriptor, e.g. `f.fileno()`. Default is standard error, -1 discards messages.
+            )doc")
+        .def("start", &AsyncLogSink::start, "Start the drain thread.")
+        .def("stop", &AsyncLogSink::stop, py::call_guard<py::gil_scoped_release>(),
+             "Deliver the remaining messages and stop the drain thread.")
+        .def("isRunning", &AsyncLogSink::isRunning, "Check whether the drain thread is running.")
+        .def("flush", &AsyncLogSink::flush, py::arg("timeout_ms") = 1000, py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+                Wait until every message logged before the call is delivered.
+
+                Args:
+                    timeout_ms (int): Maximum waiting time
+                Returns:
+                    bool: False on timeout or if the drain thread is not running
+            )doc")
+        .def("install", &AsyncLogSink::install, py::call_guard<py::gil_scoped_release>(),
+             "Register the sink as the SDK log handler. unregisterLogHandler() restores the default handler.")
+        .def("capacity", &AsyncLogSink::capacity, "Number of messages the ring buffer holds.")
+        .def("accepted", &AsyncLogSink::accepted, "Number of messages written to the ring buffer.")
+        .def("delivered", &AsyncLogSink::delivered, "Number of messages delivered by the drain thread.")
+        .def("dropped", &AsyncLogSink::dropped, "Number of messages dropped because the ring buffer was full.");
+}
+
+static void bindBinaryLog(pybind11::module_& m) {
+    py::class_<BinaryLogWriter, std::shared_ptr<BinaryLogWriter>>(
+        m, "BinaryLogWriter",
+        "Structured binary logger. Call sites register a printf-style format once and log its ID with raw arguments; "
+        "formatting is deferred to decodeBinaryLog(). A writer thread writes the records to rotating files.")
+        .def(py::init<const std::string&, size_t, int, size_t, int>(), py::arg("path"),
+             py::arg("max_file_bytes") = 16 << 20, py::arg("max_files") = 4, py::arg("capacity") = 8192,
+             py::arg("flush_interval_ms") = 100,
+             R"doc(
+                Args:
+                    path (str): Path of the current log file. Rotated files are named path.1, path.2, ... (oldest last)
+                    max_file_bytes (int): File size that triggers a rotation
+                    max_files (int): Number of files kept, including the current one
+                    capacity (int): Number of records the ring buffer holds, rounded up to a power of two
+                    flush_interval_ms (int): Maximum time between two writes to the file
+            )doc")
+        .def("registerFormat", &BinaryLogWriter::registerFormat, py::arg("level"), py::arg("file"), py::arg("line"),
+             py::arg("format"),
+             R"doc(
+                Register a printf-style format. Call it once per call site and keep the returned ID.
+
+                Args:
+                    level (LogLevel): Level of the records of this format
+                    file (str): Source file of the call site
+                    line (int): Source line of the call site
+                    format (str): printf-style format, e.g. "joint %d position %.3f"
+                Returns:
+                    int: Format ID
+            )doc")
+        .def(
+            "log",
+            [](BinaryLogWriter& self, uint32_t id, py::args args) {
+                if (!self.isEnabled(id)) {
+                    return false;
+                }
+                BinaryLogArgs encoded;
+                for (const auto& arg : args) {
+                    if (py::isinstance<py::bool_>(arg) || py::isinstance<py::int_>(arg)) {
+                        encoded.addInt(PyLong_AsLongLong(arg.ptr()));
+                        if (PyErr_Occurred()) {
+                            PyErr_Clear();
+                            encoded.add(std::string(py::str(arg)));
+                        }
+                    } else if (py::isinstance<py::float_>(arg)) {
+                        encoded.addDouble(arg.cast<double>());
+                    } else {
+                        encoded.add(std::string(py::str(arg)));
+                    }
+                }
+                return self.logArgs(id, encoded);
+            },
+            py::arg("id"),
+            R"doc(
+                Log a record of a registered format with its raw arguments.
+
+                Args:
+                    id (int): Format ID
+                    *args: int, float or str arguments, other objects are stored as str(obj)
+                Returns:
+                    bool: False if the level is filtered or the ring buffer is full
+            )doc")
+        .def("setLevel", &BinaryLogWriter::setLevel, py::arg("level"),
+             "Discard records of formats below this level. Default ELI_INFO.")
+        .def("getLevel", &BinaryLogWriter::getLevel, "Get the minimum level.")
+        .def("start", &BinaryLogWriter::start,
+             "Open the log file and start the writer thread. A file left at path is rotated, not truncated.")
+        .def("stop", &BinaryLogWriter::stop, py::call_guard<py::gil_scoped_release>(),
+             "Write the remaining records, close the file and stop the writer thread.")
+        .def("isRunning", &BinaryLogWriter::isRunning, "Check whether the writer thread is running.")
+        .def("flush", &BinaryLogWriter::flush, py::arg("timeout_ms") = 1000, py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+                Wait until every record logged before the call is written to the file.
+
+                Args:
+                    timeout_ms (int): Maximum waiting time
+                Returns:
+                    bool: False on timeout or if the writer thread is not running
+            )doc")
+        .def("install", &BinaryLogWriter::install, py::call_guard<py::gil_scoped_release>(),
+             "Register the writer as the SDK log handler. unregisterLogHandler() restores the default handler.")
+        .def("accepted", &BinaryLogWriter::accepted, "Number of records written to the ring buffer.")
+        .def("written", &BinaryLogWriter::written, "Number of records written to the file.")
+        .def("dropped", &BinaryLogWriter::dropped, "Number of records dropped because the ring buffer was full.")
+        .def("lost", &BinaryLogWriter::lost,
+             "Number of records lost because a rotation could not open a new file. The writer keeps retrying.");
+
+    m.def(
+        "decodeBinaryLog",
+        [](const std::string& path) {
+            std::vector<DecodedLogRecord> records;
+            {
+                py::gil_scoped_release release;
+                records = BinaryLogWriter::decode(path);
+            }
+            py::list out;
+            for (const auto& r : records) {
+                out.append(py::make_tuple(r.timestamp, r.level, decodeLogText(r.file.data(), r.file.size()), r.line,
+                                          decodeLogText(r.text.data(), r.text.size())));
+            }
+            return out;
+        },
+        py::arg("path"),
+        R"doc(
+            Read a file written by BinaryLogWriter and format its records.
+
+            Args:
+                path (str): Log file
+            Returns:
+                list[tuple[float, LogLevel, str, int, str]]: (timestamp, level, file, line, message) of every record
+        )doc");
+}
+
+// Forward to a Python LogHandler owned by a native handler
+class PyObjectLogHandler : public LogHandler {
+   public:
+    explicit PyObjectLogHandler(py::object handler) : handler_(makeGilSafe(std::move(handler))) {}
+
+    void log(const char* file, int line, LogLevel loglevel, const char* log) override {
+        py::gil_scoped_acquire gil;
+        try {
+            handler_->attr("log")(decodeLogText(file, std::strlen(file)), line, loglevel,
+                                  decodeLogText(log, std::strlen(log)));
+        } catch (const py::error_already_set& e) {
+            py::print("Python log handler raised exception:", e.what());
+        }
+    }
+
+   private:
+    std::shared_ptr<py::object> handler_;
+};
+
+static void bindLogRateLimiter(pybind11::module_& m) {
+    const char install_doc[] = R"doc(
+            Register a log handler that filters the SDK messages through this limiter before `handler`. A timer
+            thread of the handler emits the pending summaries every summary interval. unregisterLogHandler()
+            emits the remaining summaries and restores the default handler.
+
+            Args:
+                handler: LogHandler, AsyncLogSink or BinaryLogWriter receiving the accepted messages
+        )doc";
+
+    py::class_<LogRateLimiter, std::shared_ptr<LogRateLimiter>>(
+        m, "LogRateLimiter",
+        "Rate limiting and deduplication of log messages per call site. Identical consecutive messages are collapsed "
+        "into a \"Previous message repeated N times\" summary, and every call site has a token bucket configured "
+        "per LogLevel.")
+        .def(py::init<>())
+        .def("setLevelLimit", &LogRateLimiter::setLevelLimit, py::arg("level"), py::arg("rate"), py::arg("burst"),
+             R"doc(
+                Limit the messages of every call site of a level. Default: 20 messages/s with a burst of 50,
+                except ELI_FATAL which is not limited.
+
+                Args:
+                    level (LogLevel): Log level
+                    rate (float): Sustained messages per second, <= 0 disables the limit
+                    burst (int): Messages accepted at once after a quiet period
+            )doc")
+        .def("setDeduplicate", &LogRateLimiter::setDeduplicate, py::arg("enable"),
+             "Enable the collapsing of identical consecutive messages. Default True.")
+        .def("getDeduplicate", &LogRateLimiter::getDeduplicate, "Check whether deduplication is enabled.")
+        .def("setSummaryInterval", &LogRateLimiter::setSummaryInterval, py::arg("interval_ms"),
+             "Set the period of the summaries of collapsed and suppressed messages. Default 1000 ms.")
+        .def("getSummaryInterval", &LogRateLimiter::getSummaryInterval, "Get the summary period in ms.")
+        .def(
+            "install",
+            [](std::shared_ptr<LogRateLimiter> self, std::shared_ptr<AsyncLogSink> sink) {
+                replaceLogHandler(
+                    std::make_unique<RateLimitedLogHandler>(self, std::make_unique<AsyncLogHandler>(sink)));
+            },
+            py::arg("handler"), install_doc)
+        .def(
+            "install",
+            [](std::shared_ptr<LogRateLimiter> self, std::shared_ptr<BinaryLogWriter> writer) {
+                replaceLogHandler(
+                    std::make_unique<RateLimitedLogHandler>(self, std::make_unique<BinaryLogHandler>(writer)));
+            },
+            py::arg("handler"), install_doc)
+        .def(
+            "install",
+            [](std::shared_ptr<LogRateLimiter> self, py::object handler) {
+                if (!py::isinstance<LogHandler>(handler)) {
+                    throw py::type_error("handler must be a LogHandler, AsyncLogSink or BinaryLogWriter");
+                }
+                replaceLogHandler(
+                    std::make_unique<RateLimitedLogHandler>(self, std::make_unique<PyObjectLogHandler>(handler)));
+            },
+            py::arg("handler"), install_doc)
+        .def("forwarded", &LogRateLimiter::forwarded, "Number of messages forwarded to the handler.")
+        .def("collapsed", &LogRateLimiter::collapsed, "Number of identical consecutive messages collapsed.")
+        .def("suppressed", &LogRateLimiter::suppressed, "Number of messages suppressed by the rate limit.");
+}
+
 void bindLog(pybind11::module_& m) {
     py::enum_<LogLevel>(m, "LogLevel")
         .value("ELI_DEBUG", LogLevel::ELI_DEBUG)
@@ -74,7 +376,9 @@ void bindLog(pybind11::module_& m) {
                 Args:
                     hanlder: The new log handler object
             )doc");
-    m.def("unregisterLogHandler", &unregisterLogHandler, "Unregister current log handler, this will enable default log handler.");
+    // Releases the GIL: see replaceLogHandler()
+    m.def("unregisterLogHandler", &unregisterLogHandler, py::call_guard<py::gil_scoped_release>(),
+          "Unregister current log handler, this will enable default log handler.");
     m.def("setLogLevel", &setLogLevel, py::arg("level"),
           R"doc(
             Set log level this will disable messages with lower log level.
@@ -99,4 +403,8 @@ void bindLog(pybind11::module_& m) {
     m.def("logErrorMessage", &logErrorMessage, py::arg("file"), py::arg("line"), py::arg("msg"), log_doc);
     m.def("logFatalMessage", &logFatalMessage, py::arg("file"), py::arg("line"), py::arg("msg"), log_doc);
     m.def("logNoneMessage", &logNoneMessage, py::arg("file"), py::arg("line"), py::arg("msg"), log_doc);
+
+    bindAsyncLogSink(m);
+    bindBinaryLog(m);
+    bindLogRateLimiter(m);
 }
\ No newline at end of file
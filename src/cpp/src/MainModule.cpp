@@ -1,10 +1,19 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2025, Elite Robots.
+#include "ClockSyncWrapper.hpp"
+#include "ConnectionHealthWrapper.hpp"
+#include "ControlPluginWrapper.hpp"
 #include "ControllerLogWrapper.hpp"
 #include "DashboardClientWrapper.hpp"
 #include "DataTypeWrapper.hpp"
 #include "EliteDriverWrapper.hpp"
+#include "InverseKinematicsWrapper.hpp"
+#include "KinematicsWrapper.hpp"
 #include "LogWrapper.hpp"
+#include "ModbusWrapper.hpp"
+#include "OnlineTrajectoryWrapper.hpp"
+#include "PathParameterizationWrapper.hpp"
+#include "PoseMathWrapper.hpp"
 #include "PrimaryPackageWrapper.hpp"
 #include "PrimaryPortInterfaceWrapper.hpp"
 #include "RemoteUpgradeWrapper.hpp"
@@ -14,10 +23,20 @@
 #include "RtsiClientInterfaceWrapper.hpp"
 #include "RtsiIOInterfaceWrapper.hpp"
 #include "RtsiRecipeWrapper.hpp"
+#include "SdkThreadsWrapper.hpp"
+#include "ServoLatencyTracerWrapper.hpp"
+#include "TrajectoryValidatorWrapper.hpp"
 #include "VersionInfoWrapper.hpp"
 #include "SerialCommunicationWrapper.hpp"
 
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
 
 namespace py = pybind11;
 
@@ -70,26 +89,176 @@ void translateException(std::exception_ptr p) {
 
 #endif
 
+namespace {
+
+// Bindings registered on first use, so that an import only pays for the parts a program uses. A group is bound into
+// the submodule of the same name after its dependencies, whose classes it uses as base classes, default arguments or
+// return types. `exports` lists the public names of the group: the package re-exports them, and an attribute of
+// this module is only looked up in the group that declares it.
+struct BindingGroup {
+    const char* name;
+    const char* doc;
+    std::vector<const char*> dependencies;
+    std::vector<void (*)(py::module_&)> binders;
+    std::vector<const char*> exports;
+};
+
+const std::vector<BindingGroup>& bindingGroups() {
+    static const std::vector<BindingGroup> groups = {
+        {"primary", "Primary port interface, packages and robot exceptions", {},
+         {bindRobotException, bindPrimaryPortInterface, bindPrimaryPackage, bindRobotConfPackage},
+         {"PrimaryClientInterface", "PrimaryPackage", "KinematicsInfo", "RobotException", "RobotError",
+          "RobotRuntimeException", "RobotErrorType", "RobotErrorDataType", "RobotErrorLevel", "RobotExceptionType"}},
+        {"serial", "Serial communication, stream reader and Modbus RTU client", {},
+         {bindSerialConfig, bindSerialCommunication, bindModbus},
+         {"SerialConfig", "SerialCommunication", "SerialFraming", "SerialStreamReader", "ModbusStatus", "ModbusTable",
+          "ModbusPollResult", "ModbusRtuClient"}},
+        {"driver", "EliteDriver and connection health", {"primary", "serial"},
+         {bindEliteDriver, bindConnectionHealth},
+         {"EliteDriver", "EliteDriverConfig", "DriverStartupTimings", "ConnectionHealth", "ConnectionIssue",
+          "ConnectionHealthStats", "ConnectionHealthEvent", "ConnectionHealthMonitor"}},
+        {"dashboard", "Dashboard clients", {},
+         {bindDashboardClient},
+         {"DashboardClientInterface", "DashboardAsyncClient", "DashboardQuery", "DashboardStatusPoller"}},
+        {"rtsi", "RTSI interfaces and clock synchronization", {},
+         {bindRtsiClientInterface, bindRtsiIOInterface, bindRtsiRecipe, bindClockSync},
+         {"RtsiClientInterface", "RtsiIOInterface", "RtsiRecipe", "ClockSync", "ClockSyncState", "RtsiClockSync"}},
+        {"upgrade", "Remote upgrade", {},
+         {bindRemoteUpgrade},
+         {"upgradeControlSoftware", "UpgradeState", "UpgradeOrchestrator", "sha256File"}},
+        {"controller_log", "Controller log download", {},
+         {bindControllerLog},
+         {"ControllerLog", "ControllerLogFleet"}},
+        {"rt", "Real-time utilities", {},
+         {bindRtUtils},
+         {"setCurrentThreadFiFoScheduling", "getThreadFiFoMaxPriority", "bindCurrentThreadToCpus", "lockMemory",
+          "getLockedMemory", "setCpuAffinity", "getCpuAffinity", "setCurrentThreadDeadlineScheduling", "CpuDmaLatency",
+          "LatencyProbeResult", "runLatencyProbe"}},
+        {"kinematics", "Forward and inverse kinematics, trajectory validation", {"primary"},
+         {bindKinematics, bindInverseKinematics, bindTrajectoryValidator},
+         {"Kinematics", "IkStatus", "InverseKinematics", "TrajectoryValidator", "TrajectoryValidation",
+          "TrajectoryViolation"}},
+        {"control", "Native control laws, online trajectory generation and servo latency tracing", {"driver", "rtsi"},
+         {bindControlPlugin, bindOnlineTrajectory, bindServoLatencyTracer},
+         {"ControlPlugin", "ControlPluginStats", "AdmittanceController", "TrajectoryServo", "OnlineTrajectoryGenerator",
+          "ServoLatency", "LatencyDistribution", "ServoLatencyTracer"}},
+        {"planning", "Trajectory planning", {},
+         {bindPathParameterization},
+         {"PathParameterization", "TimedPath"}},
+        {"pose", "Batched pose math and cartesian interpolation", {},
+         {bindPoseMath},
+         {"PoseInterpolation", "rotvecToQuat", "quatToRotvec", "rotvecToMatrix", "matrixToRotvec", "quatToMatrix",
+          "matrixToQuat", "poseToMatrix", "matrixToPose", "poseTrans", "poseInv", "transformPoints", "unwrapRotvecs",
+          "interpolatePoses"}},
+    };
+    return groups;
+}
+
+// Called with the GIL held, which serializes the loads
+py::module_ loadSubmodule(py::module_ m, const std::string& name) {
+    // Leaked on purpose: releasing the modules after the interpreter is finalized would crash
+    static auto* loaded = new std::map<std::string, py::module_>();
+    // Error of each group whose binding failed. Its types may be partly registered, so it is not bound again
+    static auto* failed = new std::map<std::string, std::string>();
+    auto it = loaded->find(name);
+    if (it != loaded->end()) {
+        return it->second;
+    }
+    auto error = failed->find(name);
+    if (error != failed->end()) {
+        throw py::import_error("Binding of submodule " + name + " failed: " + error->second);
+    }
+    const auto& groups = bindingGroups();
+    auto group = std::find_if(groups.begin(), groups.end(), [&](const BindingGroup& g) { return name == g.name; });
+    if (group == groups.end()) {
+        throw py::value_error("Unknown submodule " + name);
+    }
+    for (const char* dependency : group->dependencies) {
+        loadSubmodule(m, dependency);
+    }
+    py::module_ sub = m.def_submodule(group->name, group->doc);
+    try {
+        for (auto bind : group->binders) {
+            bind(sub);
+        }
+        for (const char* export_name : group->exports) {
+            if (!py::hasattr(sub, export_name)) {
+                throw py::import_error("Submodule " + name + " does not bind " + export_name);
+            }
+        }
+    } catch (const std::exception& e) {
+        failed->emplace(name, e.what());
+        py::delattr(m, group->name);
+        throw;
+    }
+    // Makes the `__module__` of the bound classes importable, for pickle and for `import ... .rtsi`
+    py::module_::import("sys").attr("modules")[sub.attr("__name__")] = sub;
+    return loaded->emplace(name, sub).first->second;
+}
+
+}  // namespace
+
 PYBIND11_MODULE(elite_cs_sdk_python, m) {
     m.doc() = "Elite Robots CS SDK Python interface";
 #ifdef _WIN32
     py::register_exception_translator(translateException);
 #endif
+    // Small and used by every group
     bindDataTypes(m);
-    bindDashboardClient(m);
-    bindRobotException(m);
-    bindPrimaryPortInterface(m);
-    bindEliteDriver(m);
-    bindPrimaryPackage(m);
-    bindRtsiClientInterface(m);
-    bindRtsiIOInterface(m);
     bindVersionInfo(m);
-    bindRtsiRecipe(m);
     bindLog(m);
-    bindRemoteUpgrade(m);
-    bindRobotConfPackage(m);
-    bindControllerLog(m);
-    bindRtUtils(m);
-    bindSerialConfig(m);
-    bindSerialCommunication(m);
+    bindSdkThreads(m);
+
+    m.def(
+        "loadSubmodule", [m](const std::string& name) { return loadSubmodule(m, name); }, py::arg("name"),
+        R"doc(
+            Bind a group of interfaces on first use and return its submodule.
+
+            Args:
+                name (str): One of submoduleNames()
+
+            Returns:
+                module: The submodule, bound once per process
+        )doc");
+    m.def(
+        "submoduleNames",
+        []() {
+            std::vector<std::string> names;
+            for (const auto& g : bindingGroups()) {
+                names.emplace_back(g.name);
+            }
+            return names;
+        },
+        "Names of the lazily bound submodules.");
+    m.def(
+        "submoduleExports",
+        []() {
+            std::map<std::string, std::vector<std::string>> exports;
+            for (const auto& g : bindingGroups()) {
+                exports[g.name].assign(g.exports.begin(), g.exports.end());
+            }
+            return exports;
+        },
+        "Public names of each lazily bound submodule.");
+    // Attributes of the lazy submodules stay reachable from this module, e.g. elite_cs_sdk_python.EliteDriver
+    m.def("__getattr__", [m](const std::string& attr) -> py::object {
+        // Only the group that exports the name is bound, an unknown name (or a probe of the import machinery such
+        // as __path__) binds nothing
+        for (const auto& g : bindingGroups()) {
+            for (const char* export_name : g.exports) {
+                if (attr == export_name) {
+                    return loadSubmodule(m, g.name).attr(export_name);
+                }
+            }
+        }
+        throw py::attribute_error("module 'elite_cs_sdk_python' has no attribute '" + attr + "'");
+    });
+
+    // Eager mode binds everything at import, for stub generation or to keep the import cost out of a real-time loop
+    const char* eager = std::getenv("ELITE_CS_SDK_EAGER");
+    if (eager != nullptr && eager[0] != '\0' && eager[0] != '0') {
+        for (const auto& g : bindingGroups()) {
+            loadSubmodule(m, g.name);
+        }
+    }
 }
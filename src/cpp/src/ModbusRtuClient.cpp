@@ -0,0 +1,378 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "ModbusRtuClient.hpp"
+#include "SamplingUtils.hpp"
+
+#include <Elite/Log.hpp>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string>
+
+using namespace ELITE;
+
+namespace {
+
+// Reflected CRC-16/MODBUS table, polynomial 0xA001
+struct CrcTable {
+    std::array<uint16_t, 256> values{};
+    constexpr CrcTable() {
+        for (int i = 0; i < 256; ++i) {
+            uint16_t crc = static_cast<uint16_t>(i);
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc & 1) ? static_cast<uint16_t>((crc >> 1) ^ 0xA001) : static_cast<uint16_t>(crc >> 1);
+            }
+            values[i] = crc;
+        }
+    }
+};
+
+constexpr CrcTable CRC_TABLE;
+
+// Upper bound of the reads used to empty the input after a failed transaction
+constexpr int MAX_DISCARD_READS = 64;
+
+thread_local int last_exception_code = 0;
+
+bool isRegisterTable(ModbusTable table) {
+    return table == ModbusTable::HOLDING_REGISTERS || table == ModbusTable::INPUT_REGISTERS;
+}
+
+// Expected frame length from the first 3 bytes of a response
+size_t readResponseLength(const uint8_t* head) { return (head[1] & 0x80) ? 5 : 5 + static_cast<size_t>(head[2]); }
+size_t writeResponseLength(const uint8_t* head) { return (head[1] & 0x80) ? 5 : 8; }
+
+void checkRange(int slave, int address, int count) {
+    if (slave < 0 || slave > 247) {
+        throw std::invalid_argument("Modbus slave address must be in [0, 247]");
+    }
+    if (address < 0 || count <= 0 || address + count > 65536) {
+        throw std::invalid_argument("Modbus address range out of [0, 65535]");
+    }
+}
+
+void putU16(std::vector<uint8_t>& out, int v) {
+    out.push_back(static_cast<uint8_t>((v >> 8) & 0xFF));
+    out.push_back(static_cast<uint8_t>(v & 0xFF));
+}
+
+}  // namespace
+
+ModbusRtuClient::ModbusRtuClient(std::shared_ptr<SerialCommunication> serial) : serial_(std::move(serial)) {
+    if (!serial_) {
+        throw std::invalid_argument("ModbusRtuClient requires a SerialCommunication");
+    }
+}
+
+ModbusRtuClient::~ModbusRtuClient() { stopPolling(); }
+
+uint16_t ModbusRtuClient::crc16(const uint8_t* data, size_t size) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < size; ++i) {
+        crc = static_cast<uint16_t>((crc >> 8) ^ CRC_TABLE.values[(crc ^ data[i]) & 0xFF]);
+    }
+    return crc;
+}
+
+int ModbusRtuClient::lastExceptionCode() { return last_exception_code; }
+
+bool ModbusRtuClient::readExact(uint8_t* data, size_t size, std::chrono::steady_clock::time_point deadline) {
+    size_t have = 0;
+    while (have < size) {
+        const auto remaining =
+            std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+        if (remaining <= 0) {
+            return false;
+        }
+        // SerialCommunication::read() waits forever for timeouts <= 0, so never pass 0
+        const int n = serial_->read(data + have, size - have, static_cast<int>(remaining));
+        if (n > 0) {
+            have += static_cast<size_t>(n);
+        } else if (n < 0 && !serial_->isConnected()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ModbusRtuClient::discardInput() {
+    uint8_t scratch[256];
+    for (int i = 0; i < MAX_DISCARD_READS; ++i) {
+        if (serial_->read(scratch, sizeof(scratch), 1) <= 0) {
+            break;
+        }
+    }
+}
+
+ModbusStatus ModbusRtuClient::exchangeOnce(const std::vector<uint8_t>& request, size_t (*expected)(const uint8_t*),
+                                           std::vector<uint8_t>& response) {
+    if (input_dirty_) {
+        // A late response or line noise of a failed transaction would shift the next frame
+        discardInput();
+        input_dirty_ = false;
+    }
+    if (serial_->write(request.data(), request.size()) != static_cast<int>(request.size())) {
+        return ModbusStatus::IO_ERROR;
+    }
+    if (request[0] == 0) {
+        // Broadcast, slaves do not answer
+        return ModbusStatus::OK;
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms_.load());
+    response.resize(3);
+    if (!readExact(response.data(), 3, deadline)) {
+        return serial_->isConnected() ? ModbusStatus::TIMEOUT : ModbusStatus::IO_ERROR;
+    }
+    if (response[0] != request[0] || (response[1] & 0x7F) != request[1]) {
+        return ModbusStatus::INVALID_RESPONSE;
+    }
+    const size_t total = expected(response.data());
+    response.resize(total);
+    if (!readExact(response.data() + 3, total - 3, deadline)) {
+        return serial_->isConnected() ? ModbusStatus::TIMEOUT : ModbusStatus::IO_ERROR;
+    }
+    const uint16_t crc = crc16(response.data(), total - 2);
+    if (response[total - 2] != (crc & 0xFF) || response[total - 1] != (crc >> 8)) {
+        return ModbusStatus::CRC_ERROR;
+    }
+    if (response[1] & 0x80) {
+        last_exception_code = response[2];
+        return ModbusStatus::EXCEPTION;
+    }
+    return ModbusStatus::OK;
+}
+
+ModbusStatus ModbusRtuClient::transact(const uint8_t* pdu, size_t pdu_size, size_t (*expected)(const uint8_t*),
+                                       std::vector<uint8_t>& response) {
+    std::lock_guard<std::mutex> lock(bus_mutex_);
+    request_.assign(pdu, pdu + pdu_size);
+    const uint16_t crc = crc16(request_.data(), request_.size());
+    request_.push_back(static_cast<uint8_t>(crc & 0xFF));
+    request_.push_back(static_cast<uint8_t>(crc >> 8));
+
+    ModbusStatus status = ModbusStatus::TIMEOUT;
+    const int attempts = 1 + retries_.load();
+    for (int attempt = 0; attempt < attempts; ++attempt) {
+        status = exchangeOnce(request_, expected, response);
+        if (status == ModbusStatus::OK || status == ModbusStatus::EXCEPTION) {
+            return status;
+        }
+        input_dirty_ = true;
+        if (status == ModbusStatus::IO_ERROR) {
+            break;
+        }
+    }
+    return status;
+}
+
+ModbusStatus ModbusRtuClient::readBlock(int slave, ModbusTable table, int address, int count, uint16_t* out) {
+    std::vector<uint8_t> pdu;
+    pdu.reserve(6);
+    pdu.push_back(static_cast<uint8_t>(slave));
+    pdu.push_back(static_cast<uint8_t>(table));
+    putU16(pdu, address);
+    putU16(pdu, count);
+
+    std::vector<uint8_t> response;
+    const ModbusStatus status = transact(pdu.data(), pdu.size(), readResponseLength, response);
+    if (status != ModbusStatus::OK) {
+        return status;
+    }
+    const bool registers = isRegisterTable(table);
+    const size_t bytes = registers ? static_cast<size_t>(count) * 2 : static_cast<size_t>(count + 7) / 8;
+    if (response[2] != bytes) {
+        return ModbusStatus::INVALID_RESPONSE;
+    }
+    const uint8_t* data = response.data() + 3;
+    for (int i = 0; i < count; ++i) {
+        out[i] = registers ? static_cast<uint16_t>((data[2 * i] << 8) | data[2 * i + 1])
+                           : static_cast<uint16_t>((data[i / 8] >> (i % 8)) & 1);
+    }
+    return ModbusStatus::OK;
+}
+
+ModbusStatus ModbusRtuClient::read(int slave, ModbusTable table, int address, int count, uint16_t* out) {
+    checkRange(slave, address, count);
+    if (slave == 0) {
+        throw std::invalid_argument("Modbus reads cannot be broadcast");
+    }
+    const int chunk = isRegisterTable(table) ? MAX_READ_REGISTERS : MAX_READ_BITS;
+    for (int done = 0; done < count; done += chunk) {
+        const int n = std::min(chunk, count - done);
+        const ModbusStatus status = readBlock(slave, table, address + done, n, out + done);
+        if (status != ModbusStatus::OK) {
+            return status;
+        }
+    }
+    return ModbusStatus::OK;
+}
+
+ModbusStatus ModbusRtuClient::writeRegister(int slave, int address, uint16_t value) {
+    checkRange(slave, address, 1);
+    std::vector<uint8_t> pdu;
+    pdu.push_back(static_cast<uint8_t>(slave));
+    pdu.push_back(0x06);
+    putU16(pdu, address);
+    putU16(pdu, value);
+    std::vector<uint8_t> response;
+    const ModbusStatus status = transact(pdu.data(), pdu.size(), writeResponseLength, response);
+    if (status == ModbusStatus::OK && slave != 0 && !std::equal(pdu.begin(), pdu.end(), response.begin())) {
+        return ModbusStatus::INVALID_RESPONSE;
+    }
+    return status;
+}
+
+ModbusStatus ModbusRtuClient::writeCoil(int slave, int address, bool value) {
+    checkRange(slave, address, 1);
+    std::vector<uint8_t> pdu;
+    pdu.push_back(static_cast<uint8_t>(slave));
+    pdu.push_back(0x05);
+    putU16(pdu, address);
+    putU16(pdu, value ? 0xFF00 : 0x0000);
+    std::vector<uint8_t> response;
+    const ModbusStatus status = transact(pdu.data(), pdu.size(), writeResponseLength, response);
+    if (status == ModbusStatus::OK && slave != 0 && !std::equal(pdu.begin(), pdu.end(), response.begin())) {
+        return ModbusStatus::INVALID_RESPONSE;
+    }
+    return status;
+}
+
+ModbusStatus ModbusRtuClient::writeRegisters(int slave, int address, const uint16_t* values, int count) {
+    checkRange(slave, address, count);
+    std::vector<uint8_t> pdu;
+    std::vector<uint8_t> response;
+    for (int done = 0; done < count; done += MAX_WRITE_REGISTERS) {
+        const int n = std::min(MAX_WRITE_REGISTERS, count - done);
+        pdu.clear();
+        pdu.push_back(static_cast<uint8_t>(slave));
+        pdu.push_back(0x10);
+        putU16(pdu, address + done);
+        putU16(pdu, n);
+        pdu.push_back(static_cast<uint8_t>(n * 2));
+        for (int i = 0; i < n; ++i) {
+            putU16(pdu, values[done + i]);
+        }
+        const ModbusStatus status = transact(pdu.data(), pdu.size(), writeResponseLength, response);
+        if (status != ModbusStatus::OK) {
+            return status;
+        }
+        // The response echoes the address and the quantity
+        if (slave != 0 && !std::equal(pdu.begin(), pdu.begin() + 6, response.begin())) {
+            return ModbusStatus::INVALID_RESPONSE;
+        }
+    }
+    return ModbusStatus::OK;
+}
+
+int ModbusRtuClient::addPoll(int slave, ModbusTable table, int address, int count) {
+    checkRange(slave, address, count);
+    if (slave == 0) {
+        throw std::invalid_argument("Modbus reads cannot be broadcast");
+    }
+    std::lock_guard<std::mutex> lock(poll_mutex_);
+    Poll poll{slave, table, address, count, PollResult()};
+    // Empty until the first successful read, the capacity spares the poller an allocation then
+    poll.result.values.reserve(static_cast<size_t>(count));
+    polls_.push_back(std::move(poll));
+    return static_cast<int>(polls_.size() - 1);
+}
+
+void ModbusRtuClient::clearPolls() {
+    std::lock_guard<std::mutex> lock(poll_mutex_);
+    polls_.clear();
+    ++poll_generation_;
+}
+
+bool ModbusRtuClient::getPoll(int id, PollResult& result) const {
+    std::lock_guard<std::mutex> lock(poll_mutex_);
+    if (id < 0 || static_cast<size_t>(id) >= polls_.size()) {
+        return false;
+    }
+    result = polls_[static_cast<size_t>(id)].result;
+    return true;
+}
+
+void ModbusRtuClient::startPolling(int period_ms) {
+    stopPolling();
+    {
+        std::lock_guard<std::mutex> lock(poll_mutex_);
+        period_ms_ = period_ms > 0 ? period_ms : 1;
+    }
+    polling_ = true;
+    poll_thread_ = std::thread(&ModbusRtuClient::pollLoop, this);
+}
+
+void ModbusRtuClient::stopPolling() {
+    {
+        std::lock_guard<std::mutex> lock(poll_mutex_);
+        polling_ = false;
+    }
+    poll_cv_.notify_all();
+    if (poll_thread_.joinable()) {
+        poll_thread_.join();
+    }
+}
+
+void ModbusRtuClient::pollLoop() {
+    std::vector<uint16_t> values;
+    auto next = std::chrono::steady_clock::now();
+    while (polling_) {
+        size_t count;
+        uint64_t generation;
+        int period_ms;
+        {
+            std::lock_guard<std::mutex> lock(poll_mutex_);
+            count = polls_.size();
+            generation = poll_generation_;
+            period_ms = period_ms_;
+        }
+        for (size_t i = 0; i < count && polling_; ++i) {
+            Poll request;
+            {
+                std::lock_guard<std::mutex> lock(poll_mutex_);
+                if (generation != poll_generation_) {
+                    break;
+                }
+                const Poll& p = polls_[i];
+                request = Poll{p.slave, p.table, p.address, p.count, PollResult()};
+            }
+            values.resize(static_cast<size_t>(request.count));
+            ModbusStatus status;
+            try {
+                status = read(request.slave, request.table, request.address, request.count, values.data());
+            } catch (const std::exception& e) {
+                // A failing serial port must not end the poller: the block reports the error and is tried again
+                ELITE::log(__FILE__, __LINE__, LogLevel::ELI_WARN, "Modbus poll of slave %d failed: %s", request.slave,
+                           e.what());
+                status = ModbusStatus::IO_ERROR;
+            }
+
+            std::lock_guard<std::mutex> lock(poll_mutex_);
+            if (generation != poll_generation_) {
+                break;
+            }
+            PollResult& result = polls_[i].result;
+            result.status = status;
+            if (status == ModbusStatus::OK) {
+                result.values = values;
+                result.exception_code = 0;
+                result.timestamp = steadyNow();
+                ++result.updates;
+            } else {
+                result.exception_code = status == ModbusStatus::EXCEPTION ? last_exception_code : 0;
+                ++result.errors;
+            }
+        }
+
+        next += std::chrono::milliseconds(period_ms);
+        const auto now = std::chrono::steady_clock::now();
+        if (next < now) {
+            // Overrun: the bus is slower than the period, restart the schedule from now
+            next = now;
+        }
+        std::unique_lock<std::mutex> lock(poll_mutex_);
+        poll_cv_.wait_until(lock, next, [this] { return !polling_; });
+    }
+}
@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <Elite/SerialCommunication.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Result of a Modbus transaction.
+ */
+enum class ModbusStatus : int {
+    OK = 0,
+    TIMEOUT,           // No complete response before the timeout
+    CRC_ERROR,         // The response CRC does not match
+    INVALID_RESPONSE,  // Wrong slave address, function code or length
+    EXCEPTION,         // The slave answered with an exception response
+    IO_ERROR,          // The serial connection failed
+};
+
+/**
+ * @brief Modbus data tables.
+ */
+enum class ModbusTable : int {
+    COILS = 1,              // Function 0x01
+    DISCRETE_INPUTS = 2,    // Function 0x02
+    HOLDING_REGISTERS = 3,  // Function 0x03
+    INPUT_REGISTERS = 4,    // Function 0x04
+};
+
+/**
+ * @brief Modbus RTU master over a SerialCommunication, typically the tool RS485 port.
+ *
+ * Frames are built and checked natively (table-driven CRC16, reassembly of partial reads, timeouts). Reads and writes
+ * longer than one Modbus PDU are split into several transactions. Transactions are serialized, so the client can be
+ * shared between threads and with the cyclic poller, which refreshes a latest-value cache from a background thread.
+ */
+class ModbusRtuClient {
+   public:
+    // Largest block per transaction allowed by the protocol
+    static constexpr int MAX_READ_REGISTERS = 125;
+    static constexpr int MAX_WRITE_REGISTERS = 123;
+    static constexpr int MAX_READ_BITS = 2000;
+
+    /**
+     * @brief Latest values of one polled block.
+     */
+    struct PollResult {
+        std::vector<uint16_t> values;  // Registers, or one 0/1 value per coil or discrete input. Empty before a success
+        ModbusStatus status = ModbusStatus::TIMEOUT;  // Result of the last attempt, IO_ERROR if the port threw
+        int exception_code = 0;                        // Exception code of the slave when `status` is EXCEPTION
+        double timestamp = 0.0;  // Steady clock time of the last successful refresh (Python time.monotonic())
+        uint64_t updates = 0;    // Successful refreshes
+        uint64_t errors = 0;     // Failed attempts
+    };
+
+    explicit ModbusRtuClient(std::shared_ptr<ELITE::SerialCommunication> serial);
+    ~ModbusRtuClient();
+
+    ModbusRtuClient(const ModbusRtuClient&) = delete;
+    ModbusRtuClient& operator=(const ModbusRtuClient&) = delete;
+
+    /**
+     * @brief Set the response timeout of one transaction. Default 100 ms.
+     */
+    void setTimeout(int timeout_ms) { timeout_ms_ = timeout_ms > 0 ? timeout_ms : 1; }
+    int getTimeout() const { return timeout_ms_; }
+
+    /**
+     * @brief Set how many times a transaction is retried after a timeout or CRC error. Default 1.
+     */
+    void setRetries(int retries) { retries_ = retries > 0 ? retries : 0; }
+    int getRetries() const { return retries_; }
+
+    /**
+     * @brief Read `count` values of a table starting at `address`.
+     *
+     * @param out Output, `count` values. Coils and discrete inputs are stored as 0/1.
+     */
+    ModbusStatus read(int slave, ModbusTable table, int address, int count, uint16_t* out);
+
+    /**
+     * @brief Write one holding register (function 0x06).
+     */
+    ModbusStatus writeRegister(int slave, int address, uint16_t value);
+
+    /**
+     * @brief Write `count` holding registers (function 0x10).
+     */
+    ModbusStatus writeRegisters(int slave, int address, const uint16_t* values, int count);
+
+    /**
+     * @brief Write one coil (function 0x05).
+     */
+    ModbusStatus writeCoil(int slave, int address, bool value);
+
+    /**
+     * @brief Exception code of the last EXCEPTION status returned to the calling thread.
+     */
+    static int lastExceptionCode();
+
+    /**
+     * @brief Add a block to the cyclic poll list.
+     *
+     * @return Poll ID
+     */
+    int addPoll(int slave, ModbusTable table, int address, int count);
+
+    void clearPolls();
+
+    /**
+     * @brief Start refreshing every polled block each `period_ms`.
+     */
+    void startPolling(int period_ms);
+
+    void stopPolling();
+
+    bool isPolling() const { return polling_; }
+
+    /**
+     * @brief Copy the latest values of a polled block.
+     *
+     * @return false if the poll ID does not exist
+     */
+    bool getPoll(int id, PollResult& result) const;
+
+    /**
+     * @brief Compute the Modbus CRC16 of a buffer.
+     */
+    static uint16_t crc16(const uint8_t* data, size_t size);
+
+   private:
+    struct Poll {
+        int slave;
+        ModbusTable table;
+        int address;
+        int count;
+        PollResult result;
+    };
+
+    // One request/response exchange, with retries. `response` receives the whole frame.
+    ModbusStatus transact(const uint8_t* pdu, size_t pdu_size, size_t (*expected)(const uint8_t* head),
+                          std::vector<uint8_t>& response);
+    ModbusStatus exchangeOnce(const std::vector<uint8_t>& request, size_t (*expected)(const uint8_t* head),
+                              std::vector<uint8_t>& response);
+    bool readExact(uint8_t* data, size_t size, std::chrono::steady_clock::time_point deadline);
+    void discardInput();
+    ModbusStatus readBlock(int slave, ModbusTable table, int address, int count, uint16_t* out);
+    void pollLoop();
+
+    std::shared_ptr<ELITE::SerialCommunication> serial_;
+    std::atomic<int> timeout_ms_{100};
+    std::atomic<int> retries_{1};
+
+    std::mutex bus_mutex_;
+    std::vector<uint8_t> request_;
+    bool input_dirty_ = false;
+
+    mutable std::mutex poll_mutex_;
+    std::vector<Poll> polls_;
+    uint64_t poll_generation_ = 0;
+    std::condition_variable poll_cv_;
+    std::atomic<bool> polling_{false};
+    int period_ms_ = 100;
+    std::thread poll_thread_;
+};
@@ -0,0 +1,266 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "ModbusWrapper.hpp"
+#include "GilSafeObject.hpp"
+#include "ModbusRtuClient.hpp"
+#include "PyBufferView.hpp"
+
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+#include <stdexcept>
+#include <string>
+
+namespace py = pybind11;
+using namespace ELITE;
+
+using RegisterArray = py::array_t<uint16_t, py::array::c_style | py::array::forcecast>;
+
+static const char* statusText(ModbusStatus status) {
+    switch (status) {
+        case ModbusStatus::OK:
+            return "ok";
+        case ModbusStatus::TIMEOUT:
+            return "timeout";
+        case ModbusStatus::CRC_ERROR:
+            return "CRC error";
+        case ModbusStatus::INVALID_RESPONSE:
+            return "invalid response";
+        case ModbusStatus::EXCEPTION:
+            return "exception response";
+        default:
+            return "serial I/O error";
+    }
+}
+
+static void checkStatus(ModbusStatus status) {
+    if (status == ModbusStatus::OK) {
+        return;
+    }
+    std::string msg = std::string("Modbus request failed: ") + statusText(status);
+    if (status == ModbusStatus::EXCEPTION) {
+        msg += " (code " + std::to_string(ModbusRtuClient::lastExceptionCode()) + ")";
+    }
+    throw std::runtime_error(msg);
+}
+
+// Read `count` values of a table into a new array, with the GIL released during the transactions
+static py::array readTable(ModbusRtuClient& self, int slave, ModbusTable table, int address, int count) {
+    py::array_t<uint16_t> out(count > 0 ? count : 0);
+    uint16_t* data = out.mutable_data();
+    ModbusStatus status;
+    {
+        py::gil_scoped_release release;
+        status = self.read(slave, table, address, count, data);
+    }
+    checkStatus(status);
+    if (table == ModbusTable::COILS || table == ModbusTable::DISCRETE_INPUTS) {
+        return out.attr("astype")("bool");
+    }
+    return std::move(out);
+}
+
+void bindModbus(py::module_& m) {
+    py::enum_<ModbusStatus>(m, "ModbusStatus", py::arithmetic())
+        .value("OK", ModbusStatus::OK)
+        .value("TIMEOUT", ModbusStatus::TIMEOUT)
+        .value("CRC_ERROR", ModbusStatus::CRC_ERROR)
+        .value("INVALID_RESPONSE", ModbusStatus::INVALID_RESPONSE)
+        .value("EXCEPTION", ModbusStatus::EXCEPTION)
+        .value("IO_ERROR", ModbusStatus::IO_ERROR)
+        .export_values();
+
+    py::enum_<ModbusTable>(m, "ModbusTable", py::arithmetic())
+        .value("COILS", ModbusTable::COILS)
+        .value("DISCRETE_INPUTS", ModbusTable::DISCRETE_INPUTS)
+        .value("HOLDING_REGISTERS", ModbusTable::HOLDING_REGISTERS)
+        .value("INPUT_REGISTERS", ModbusTable::INPUT_REGISTERS)
+        .export_values();
+
+    using PollResult = ModbusRtuClient::PollResult;
+    py::class_<PollResult>(m, "ModbusPollResult", "Latest values and status of a polled block.")
+        .def_property_readonly(
+            "values",
+            [](const PollResult& self) {
+                return py::array_t<uint16_t>(static_cast<py::ssize_t>(self.values.size()), self.values.data());
+            },
+            "uint16 array of the last successful read, empty before the first one")
+        .def_readonly("status", &PollResult::status, "ModbusStatus of the last attempt, IO_ERROR if the port failed")
+        .def_readonly("exception_code", &PollResult::exception_code,
+                      "Exception code of the slave when status is EXCEPTION, 0 otherwise")
+        .def_readonly("timestamp", &PollResult::timestamp,
+                      "Time of the last successful read on the time.monotonic() clock")
+        .def_readonly("updates", &PollResult::updates, "Successful reads since the block was added")
+        .def_readonly("errors", &PollResult::errors, "Failed attempts since the block was added")
+        .def("__repr__", [](const PollResult& self) {
+            return py::str("<ModbusPollResult status={} exception_code={} updates={} errors={}>")
+                .format(statusText(self.status), self.exception_code, self.updates, self.errors);
+        });
+
+    py::class_<ModbusRtuClient, GilReleasingPtr<ModbusRtuClient>>(
+        m, "ModbusRtuClient",
+        "Native Modbus RTU master over a SerialCommunication, e.g. the one returned by EliteDriver.startToolRs485(). "
+        "Framing, CRC and response matching run in C++ with the GIL released.")
+        .def(py::init<std::shared_ptr<SerialCommunication>>(), py::arg("serial"),
+             R"doc(
+                Args:
+                    serial (SerialCommunication): Connected serial port
+            )doc")
+        .def("setTimeout", &ModbusRtuClient::setTimeout, py::arg("timeout_ms"),
+             "Set the response timeout of one transaction. Default 100 ms.")
+        .def("getTimeout", &ModbusRtuClient::getTimeout, "Get the response timeout in ms.")
+        .def("setRetries", &ModbusRtuClient::setRetries, py::arg("retries"),
+             "Set how many times a transaction is retried after a timeout or CRC error. Default 1.")
+        .def("getRetries", &ModbusRtuClient::getRetries, "Get the number of retries.")
+        .def(
+            "readHoldingRegisters",
+            [](ModbusRtuClient& self, int slave, int address, int count) {
+                return readTable(self, slave, ModbusTable::HOLDING_REGISTERS, address, count);
+            },
+            py::arg("slave"), py::arg("address"), py::arg("count"),
+            R"doc(
+                Read holding registers (function 0x03). Blocks longer than 125 registers are split.
+
+                Args:
+                    slave (int): Slave address
+                    address (int): First register
+                    count (int): Number of registers
+                Returns:
+                    numpy.ndarray: uint16 array of `count` registers
+                Raises:
+                    RuntimeError: On timeout, CRC error, invalid or exception response
+            )doc")
+        .def(
+            "readInputRegisters",
+            [](ModbusRtuClient& self, int slave, int address, int count) {
+                return readTable(self, slave, ModbusTable::INPUT_REGISTERS, address, count);
+            },
+            py::arg("slave"), py::arg("address"), py::arg("count"),
+            "Read input registers (function 0x04). Same as readHoldingRegisters().")
+        .def(
+            "readCoils",
+            [](ModbusRtuClient& self, int slave, int address, int count) {
+                return readTable(self, slave, ModbusTable::COILS, address, count);
+            },
+            py::arg("slave"), py::arg("address"), py::arg("count"),
+            "Read coils (function 0x01), returned as a bool array.")
+        .def(
+            "readDiscreteInputs",
+            [](ModbusRtuClient& self, int slave, int address, int count) {
+                return readTable(self, slave, ModbusTable::DISCRETE_INPUTS, address, count);
+            },
+            py::arg("slave"), py::arg("address"), py::arg("count"),
+            "Read discrete inputs (function 0x02), returned as a bool array.")
+        .def(
+            "readInto",
+            [](ModbusRtuClient& self, int slave, ModbusTable table, int address, py::array out) {
+                // No implicit conversion: the values must land in the caller's array
+                if (!out.dtype().equal(py::dtype::of<uint16_t>()) || !(out.flags() & py::array::c_style) ||
+                    !out.writeable()) {
+                    throw py::type_error("out must be a writable, C-contiguous uint16 array");
+                }
+                const int count = static_cast<int>(out.size());
+                uint16_t* data = static_cast<uint16_t*>(out.mutable_data());
+                ModbusStatus status;
+                {
+                    py::gil_scoped_release release;
+                    status = self.read(slave, table, address, count, data);
+                }
+                checkStatus(status);
+            },
+            py::arg("slave"), py::arg("table"), py::arg("address"), py::arg("out"),
+            R"doc(
+                Read `out.size` values of a table into an existing array, without allocating.
+
+                Args:
+                    slave (int): Slave address
+                    table (ModbusTable): Table to read
+                    address (int): First address
+                    out (numpy.ndarray): Writable, C-contiguous uint16 array. Coils and inputs are stored as 0/1.
+            )doc")
+        .def(
+            "writeRegister",
+            [](ModbusRtuClient& self, int slave, int address, uint16_t value) {
+                ModbusStatus status;
+                {
+                    py::gil_scoped_release release;
+                    status = self.writeRegister(slave, address, value);
+                }
+                checkStatus(status);
+            },
+            py::arg("slave"), py::arg("address"), py::arg("value"), "Write one holding register (function 0x06).")
+        .def(
+            "writeRegisters",
+            [](ModbusRtuClient& self, int slave, int address, const RegisterArray& values) {
+                const int count = static_cast<int>(values.size());
+                const uint16_t* data = values.data();
+                ModbusStatus status;
+                {
+                    py::gil_scoped_release release;
+                    status = self.writeRegisters(slave, address, data, count);
+                }
+                checkStatus(status);
+            },
+            py::arg("slave"), py::arg("address"), py::arg("values"),
+            R"doc(
+                Write holding registers (function 0x10). Blocks longer than 123 registers are split.
+
+                Args:
+                    slave (int): Slave address, 0 broadcasts
+                    address (int): First register
+                    values (array-like): Register values, converted to uint16
+            )doc")
+        .def(
+            "writeCoil",
+            [](ModbusRtuClient& self, int slave, int address, bool value) {
+                ModbusStatus status;
+                {
+                    py::gil_scoped_release release;
+                    status = self.writeCoil(slave, address, value);
+                }
+                checkStatus(status);
+            },
+            py::arg("slave"), py::arg("address"), py::arg("value"), "Write one coil (function 0x05).")
+        .def("addPoll", &ModbusRtuClient::addPoll, py::arg("slave"), py::arg("table"), py::arg("address"),
+             py::arg("count"),
+             R"doc(
+                Add a block to the cyclic poll list.
+
+                Returns:
+                    int: Poll ID, used with getPoll()
+            )doc")
+        .def("clearPolls", &ModbusRtuClient::clearPolls, "Remove every block from the poll list.")
+        .def("startPolling", &ModbusRtuClient::startPolling, py::arg("period_ms"),
+             py::call_guard<py::gil_scoped_release>(),
+             "Refresh every polled block each `period_ms` from a background thread.")
+        .def("stopPolling", &ModbusRtuClient::stopPolling, py::call_guard<py::gil_scoped_release>(),
+             "Stop the polling thread.")
+        .def("isPolling", &ModbusRtuClient::isPolling, "Check whether the polling thread is running.")
+        .def(
+            "getPoll",
+            [](const ModbusRtuClient& self, int id) {
+                ModbusRtuClient::PollResult result;
+                if (!self.getPoll(id, result)) {
+                    throw py::index_error("Unknown poll ID");
+                }
+                return result;
+            },
+            py::arg("id"),
+            R"doc(
+                Get the latest values of a polled block, without any bus traffic.
+
+                Args:
+                    id (int): Poll ID
+                Returns:
+                    ModbusPollResult: `values` of the last successful read, `status` and `exception_code` of the last
+                        attempt, `timestamp` of the last success on the time.monotonic() clock, and the `updates` and
+                        `errors` counters
+            )doc")
+        .def_static(
+            "crc16",
+            [](py::object data) {
+                PyBufferView view(data, false);
+                return ModbusRtuClient::crc16(view.data(), view.size());
+            },
+            py::arg("data"), "Compute the Modbus CRC16 of a frame.");
+}
@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <stdexcept>
+#include <string>
+
+// Contiguous, C-ordered double array. Inputs of another dtype or layout are converted once by pybind11.
+using DoubleArray = pybind11::array_t<double, pybind11::array::c_style | pybind11::array::forcecast>;
+
+/**
+ * @brief Check that `arr` is a (N, cols) array, or a single (cols,) row, and return N.
+ *
+ * @param arr The input array
+ * @param cols Required number of columns
+ * @param name Argument name used in the error message
+ */
+inline size_t requireRows(const DoubleArray& arr, pybind11::ssize_t cols, const char* name) {
+    if (arr.ndim() == 1 && arr.shape(0) == cols) {
+        return 1;
+    }
+    if (arr.ndim() != 2 || arr.shape(1) != cols) {
+        throw std::runtime_error(std::string(name) + " must be an array of shape (N, " + std::to_string(cols) + ")");
+    }
+    return static_cast<size_t>(arr.shape(0));
+}
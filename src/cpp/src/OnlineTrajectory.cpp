@@ -0,0 +1,239 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "OnlineTrajectory.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+// Bisections stop well below the resolution of a servo command
+constexpr int BISECTION_STEPS = 60;
+constexpr double EPSILON = 1e-12;
+
+void advance(double& p, double& v, double& a, double jerk, double t) {
+    p += t * (v + t * (a / 2.0 + t * jerk / 6.0));
+    v += t * (a + t * jerk / 2.0);
+    a += t * jerk;
+}
+
+}  // namespace
+
+size_t JerkLimitedProfile::velocityChange(double v0, double a0, double v1, Segment* out) const {
+    const double j = limits_.max_jerk;
+    // Velocity reached by bringing the acceleration to zero right away decides the direction of the jerk
+    const double v_stop = v0 + a0 * std::fabs(a0) / (2.0 * j);
+    const double s = v1 >= v_stop ? 1.0 : -1.0;
+    const double a_start = s * a0;
+    const double dv = s * (v1 - v0);
+
+    double a_peak = std::sqrt(std::max(0.0, j * dv + a_start * a_start / 2.0));
+    double hold = 0.0;
+    if (a_peak > limits_.max_acceleration) {
+        a_peak = limits_.max_acceleration;
+        const double ramp_dv = (a_start + a_peak) / 2.0 * std::fabs(a_peak - a_start) / j;
+        hold = std::max(0.0, (dv - ramp_dv - a_peak * a_peak / (2.0 * j)) / a_peak);
+    }
+    out[0] = {std::fabs(a_peak - a_start) / j, a_peak >= a_start ? s * j : -s * j};
+    out[1] = {hold, 0.0};
+    out[2] = {a_peak / j, -s * j};
+    return 3;
+}
+
+double JerkLimitedProfile::build(double peak) {
+    count_ = velocityChange(v0_, a0_, peak, segments_.data());
+    cruise_index_ = count_;
+    segments_[count_++] = {0.0, 0.0};
+    count_ += velocityChange(peak, 0.0, 0.0, segments_.data() + count_);
+
+    double p = 0.0, v = v0_, a = a0_;
+    for (size_t i = 0; i < count_; ++i) {
+        advance(p, v, a, segments_[i].jerk, segments_[i].duration);
+    }
+    return p;
+}
+
+void JerkLimitedProfile::finish(double peak, double cruise) {
+    peak_ = peak;
+    segments_[cruise_index_].duration = std::max(cruise, 0.0);
+    duration_ = 0.0;
+    for (size_t i = 0; i < count_; ++i) {
+        duration_ += segments_[i].duration;
+    }
+}
+
+double JerkLimitedProfile::plan(double position, double velocity, double acceleration, double target,
+                                const Limits& limits) {
+    p0_ = position;
+    v0_ = velocity;
+    a0_ = acceleration;
+    target_ = target;
+    limits_ = limits;
+    const double delta = target - position;
+    if (std::fabs(delta) < EPSILON && std::fabs(velocity) < EPSILON && std::fabs(acceleration) < EPSILON) {
+        count_ = 0;
+        peak_ = 0.0;
+        duration_ = 0.0;
+        return duration_;
+    }
+
+    // The displacement grows with the peak velocity: cruise at the limit when the target is far, bisect otherwise
+    const double v_max = limits.max_velocity;
+    const double d_high = build(v_max);
+    if (delta >= d_high) {
+        finish(v_max, (delta - d_high) / v_max);
+        return duration_;
+    }
+    const double d_low = build(-v_max);
+    if (delta <= d_low) {
+        finish(-v_max, (d_low - delta) / v_max);
+        return duration_;
+    }
+    double low = -v_max, high = v_max;
+    for (int i = 0; i < BISECTION_STEPS; ++i) {
+        const double mid = (low + high) / 2.0;
+        if (build(mid) < delta) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    const double peak = (low + high) / 2.0;
+    build(peak);
+    finish(peak, 0.0);
+    return duration_;
+}
+
+bool JerkLimitedProfile::stretch(double duration) {
+    if (duration <= duration_ + EPSILON || count_ == 0) {
+        return duration <= duration_ + EPSILON;
+    }
+    const double original_peak = peak_;
+    const double original_cruise = segments_[cruise_index_].duration;
+    const double delta = target_ - p0_;
+
+    // Lowering the peak lengthens the cruise; without distance left to cruise the profile cannot be slowed
+    if ((delta - build(0.0)) * original_peak <= EPSILON) {
+        build(original_peak);
+        finish(original_peak, original_cruise);
+        return false;
+    }
+    auto total = [&](double peak, double& cruise) {
+        cruise = std::max(0.0, (delta - build(peak)) / peak);
+        double t = cruise;
+        for (size_t i = 0; i < count_; ++i) {
+            t += segments_[i].duration;
+        }
+        return t;
+    };
+    double slow = 0.0, fast = original_peak, cruise = 0.0;
+    for (int i = 0; i < BISECTION_STEPS; ++i) {
+        const double mid = (slow + fast) / 2.0;
+        if (total(mid, cruise) > duration) {
+            slow = mid;
+        } else {
+            fast = mid;
+        }
+    }
+    total(fast, cruise);
+    finish(fast, cruise);
+    return true;
+}
+
+void JerkLimitedProfile::sample(double t, double& position, double& velocity, double& acceleration) const {
+    double p = p0_, v = v0_, a = a0_;
+    for (size_t i = 0; i < count_; ++i) {
+        const Segment& segment = segments_[i];
+        if (t <= segment.duration) {
+            advance(p, v, a, segment.jerk, t);
+            position = p, velocity = v, acceleration = a;
+            return;
+        }
+        advance(p, v, a, segment.jerk, segment.duration);
+        t -= segment.duration;
+    }
+    position = target_, velocity = 0.0, acceleration = 0.0;
+}
+
+OnlineTrajectoryGenerator::OnlineTrajectoryGenerator(size_t dof, double cycle_time)
+    : dof_(dof),
+      cycle_time_(cycle_time),
+      limits_(dof, JerkLimitedProfile::Limits{1.0, 1.0, 10.0}),
+      profiles_(dof),
+      position_(dof, 0.0),
+      velocity_(dof, 0.0),
+      acceleration_(dof, 0.0),
+      target_(dof, 0.0) {
+    if (dof == 0) {
+        throw std::invalid_argument("The generator needs at least one axis");
+    }
+    if (!(cycle_time > 0.0)) {
+        throw std::invalid_argument("Cycle time must be positive");
+    }
+}
+
+void OnlineTrajectoryGenerator::setLimits(const double* max_velocity, const double* max_acceleration,
+                                          const double* max_jerk) {
+    for (size_t i = 0; i < dof_; ++i) {
+        if (!(max_velocity[i] > 0.0) || !(max_acceleration[i] > 0.0) || !(max_jerk[i] > 0.0)) {
+            throw std::invalid_argument("Velocity, acceleration and jerk limits must be positive");
+        }
+    }
+    for (size_t i = 0; i < dof_; ++i) {
+        limits_[i] = {max_velocity[i], max_acceleration[i], max_jerk[i]};
+    }
+    replan_ = true;
+}
+
+void OnlineTrajectoryGenerator::setSynchronized(bool synchronized) {
+    synchronized_ = synchronized;
+    replan_ = true;
+}
+
+void OnlineTrajectoryGenerator::reset(const double* position, const double* velocity, const double* acceleration) {
+    for (size_t i = 0; i < dof_; ++i) {
+        position_[i] = position[i];
+        velocity_[i] = velocity != nullptr ? velocity[i] : 0.0;
+        acceleration_[i] = acceleration != nullptr ? acceleration[i] : 0.0;
+    }
+    target_ = position_;
+    replan_ = true;
+}
+
+void OnlineTrajectoryGenerator::setTarget(const double* target) {
+    std::copy(target, target + dof_, target_.begin());
+    replan_ = true;
+}
+
+void OnlineTrajectoryGenerator::plan() {
+    const auto begin = std::chrono::steady_clock::now();
+    duration_ = 0.0;
+    for (size_t i = 0; i < dof_; ++i) {
+        duration_ = std::max(
+            duration_, profiles_[i].plan(position_[i], velocity_[i], acceleration_[i], target_[i], limits_[i]));
+    }
+    // The slowest axis sets the pace, the others lower their peak velocity to arrive with it
+    if (synchronized_) {
+        for (auto& profile : profiles_) {
+            profile.stretch(duration_);
+        }
+    }
+    time_ = 0.0;
+    replan_ = false;
+    plan_time_us_ = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+}
+
+bool OnlineTrajectoryGenerator::update(double dt) {
+    if (replan_) {
+        plan();
+    }
+    time_ += dt > 0.0 ? dt : cycle_time_;
+    for (size_t i = 0; i < dof_; ++i) {
+        profiles_[i].sample(time_, position_[i], velocity_[i], acceleration_[i]);
+    }
+    return finished();
+}
+
+double OnlineTrajectoryGenerator::timeLeft() const { return std::max(0.0, duration_ - time_); }
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Jerk-limited motion of one axis from any state (position, velocity, acceleration) to rest at a target.
+ *
+ * The profile changes the velocity to a peak, cruises, then brakes to rest, each velocity change with a trapezoidal
+ * acceleration. The peak is the fastest one reaching the target, or a slower one to end at a given time.
+ */
+class JerkLimitedProfile {
+   public:
+    struct Limits {
+        double max_velocity;
+        double max_acceleration;
+        double max_jerk;
+    };
+
+    /**
+     * @brief Plan the fastest profile. Limits must be positive.
+     *
+     * @return Duration of the profile [s]
+     */
+    double plan(double position, double velocity, double acceleration, double target, const Limits& limits);
+
+    /**
+     * @brief Slow the planned profile down to end at `duration`. Called after plan().
+     *
+     * @return false if the profile cannot be stretched (it then ends earlier and holds the target)
+     */
+    bool stretch(double duration);
+
+    double duration() const { return duration_; }
+
+    /**
+     * @brief State at time `t` from the start of the profile. Past the end the axis rests at the target.
+     */
+    void sample(double t, double& position, double& velocity, double& acceleration) const;
+
+   private:
+    struct Segment {
+        double duration;
+        double jerk;
+    };
+
+    // Segments bringing the velocity from (v0, a0) to v1 with a zero acceleration, at most 3
+    size_t velocityChange(double v0, double a0, double v1, Segment* out) const;
+    // Build the profile through peak velocity `peak` and return the displacement without cruise
+    double build(double peak);
+    void finish(double peak, double cruise);
+
+    double p0_ = 0.0;
+    double v0_ = 0.0;
+    double a0_ = 0.0;
+    double target_ = 0.0;
+    double peak_ = 0.0;
+    Limits limits_{1.0, 1.0, 1.0};
+    std::array<Segment, 7> segments_{};
+    size_t count_ = 0;
+    size_t cruise_index_ = 0;
+    double duration_ = 0.0;
+};
+
+/**
+ * @brief Online trajectory generator: jerk-limited, time-synchronized motion of several axes toward a target that may
+ * change at any cycle.
+ *
+ * Every call of update() advances the setpoint by one cycle. A new target or new limits are planned from the current
+ * setpoint, so position, velocity and acceleration stay continuous. Nothing is allocated after construction, the
+ * generator can run inside a real-time loop.
+ */
+class OnlineTrajectoryGenerator {
+   public:
+    /**
+     * @param dof Number of axes
+     * @param cycle_time Default time step of update() [s]
+     * @throws std::invalid_argument if dof is 0 or cycle_time is not positive
+     */
+    OnlineTrajectoryGenerator(size_t dof, double cycle_time);
+
+    size_t dof() const { return dof_; }
+    double cycleTime() const { return cycle_time_; }
+
+    /**
+     * @brief Set the limits of every axis, `dof` values each.
+     *
+     * @throws std::invalid_argument if a limit is not positive
+     */
+    void setLimits(const double* max_velocity, const double* max_acceleration, const double* max_jerk);
+
+    /**
+     * @brief All axes reach the target together (default), or each one as fast as it can.
+     */
+    void setSynchronized(bool synchronized);
+
+    /**
+     * @brief Restart from a measured state and hold it. Null velocity or acceleration means zero.
+     */
+    void reset(const double* position, const double* velocity = nullptr, const double* acceleration = nullptr);
+
+    void setTarget(const double* target);
+
+    /**
+     * @brief Advance the setpoint by `dt`, the cycle time when `dt` <= 0.
+     *
+     * @return true once the target is reached
+     */
+    bool update(double dt = 0.0);
+
+    const std::vector<double>& position() const { return position_; }
+    const std::vector<double>& velocity() const { return velocity_; }
+    const std::vector<double>& acceleration() const { return acceleration_; }
+    const std::vector<double>& target() const { return target_; }
+
+    // Duration of the current plan, from the last replanning
+    double duration() const { return duration_; }
+    double timeLeft() const;
+    bool finished() const { return !replan_ && time_ >= duration_; }
+
+    // Time spent in the last planning [us]
+    double lastPlanTimeUs() const { return plan_time_us_; }
+
+   private:
+    void plan();
+
+    size_t dof_;
+    double cycle_time_;
+    bool synchronized_ = true;
+    bool replan_ = false;
+    std::vector<JerkLimitedProfile::Limits> limits_;
+    std::vector<JerkLimitedProfile> profiles_;
+    std::vector<double> position_;
+    std::vector<double> velocity_;
+    std::vector<double> acceleration_;
+    std::vector<double> target_;
+    double time_ = 0.0;
+    double duration_ = 0.0;
+    double plan_time_us_ = 0.0;
+};
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "OnlineTrajectoryWrapper.hpp"
+#include "NdArrayUtils.hpp"
+#include "OnlineTrajectory.hpp"
+
+#include <pybind11/numpy.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace py = pybind11;
+
+static const double* axisValues(const OnlineTrajectoryGenerator& self, const DoubleArray& values, const char* name) {
+    if (values.ndim() != 1 || static_cast<size_t>(values.shape(0)) != self.dof()) {
+        throw std::runtime_error(std::string(name) + " must have " + std::to_string(self.dof()) + " values");
+    }
+    return values.data();
+}
+
+static py::array_t<double> toArray(const std::vector<double>& values) {
+    return py::array_t<double>(static_cast<py::ssize_t>(values.size()), values.data());
+}
+
+void bindOnlineTrajectory(py::module_& m) {
+    py::class_<OnlineTrajectoryGenerator>(
+        m, "OnlineTrajectoryGenerator",
+        "Jerk-limited, time-synchronized setpoints toward a target that may change at any cycle.")
+        .def(py::init<size_t, double>(), py::arg("dof") = 6, py::arg("cycle_time") = 0.002,
+             R"doc(
+                Create a generator holding every axis at 0. Call reset() with the measured state before the first
+                target.
+
+                Args:
+                    dof (int): Number of axes
+                    cycle_time (float): Default time step of update() [s]
+            )doc")
+        .def("dof", &OnlineTrajectoryGenerator::dof)
+        .def("cycleTime", &OnlineTrajectoryGenerator::cycleTime)
+        .def(
+            "setLimits",
+            [](OnlineTrajectoryGenerator& self, const DoubleArray& max_velocity, const DoubleArray& max_acceleration,
+               const DoubleArray& max_jerk) {
+                self.setLimits(axisValues(self, max_velocity, "max_velocity"),
+                               axisValues(self, max_acceleration, "max_acceleration"),
+                               axisValues(self, max_jerk, "max_jerk"));
+            },
+            py::arg("max_velocity"), py::arg("max_acceleration"), py::arg("max_jerk"),
+            R"doc(
+                Limits of every axis. The motion is replanned from the current setpoint on the next update().
+
+                Raises:
+                    ValueError: A limit is not positive
+            )doc")
+        .def("setSynchronized", &OnlineTrajectoryGenerator::setSynchronized, py::arg("synchronized"),
+             "All axes reach the target together (default), or each one as fast as it can.")
+        .def(
+            "reset",
+            [](OnlineTrajectoryGenerator& self, const DoubleArray& position, py::object velocity,
+               py::object acceleration) {
+                DoubleArray v = velocity.is_none() ? DoubleArray() : velocity.cast<DoubleArray>();
+                DoubleArray a = acceleration.is_none() ? DoubleArray() : acceleration.cast<DoubleArray>();
+                self.reset(axisValues(self, position, "position"),
+                           velocity.is_none() ? nullptr : axisValues(self, v, "velocity"),
+                           acceleration.is_none() ? nullptr : axisValues(self, a, "acceleration"));
+            },
+            py::arg("position"), py::arg("velocity") = py::none(), py::arg("acceleration") = py::none(),
+            R"doc(
+                Restart from a measured state, e.g. the RTSI joint positions, and hold it.
+
+                Args:
+                    position (numpy.ndarray): Position of every axis
+                    velocity (numpy.ndarray | None): Velocity of every axis, zero when None
+                    acceleration (numpy.ndarray | None): Acceleration of every axis, zero when None
+            )doc")
+        .def(
+            "setTarget",
+            [](OnlineTrajectoryGenerator& self, const DoubleArray& target) {
+                self.setTarget(axisValues(self, target, "target"));
+            },
+            py::arg("target"),
+            "New target, planned from the current setpoint on the next update(): position, velocity and acceleration "
+            "stay continuous.")
+        .def("update", &OnlineTrajectoryGenerator::update, py::arg("dt") = 0.0,
+             R"doc(
+                Advance the setpoint by one cycle.
+
+                Args:
+                    dt (float): Time step [s], the cycle time when <= 0
+
+                Returns:
+                    bool: True once the target is reached
+            )doc")
+        .def("getPosition", [](const OnlineTrajectoryGenerator& self) { return toArray(self.position()); })
+        .def("getVelocity", [](const OnlineTrajectoryGenerator& self) { return toArray(self.velocity()); })
+        .def("getAcceleration", [](const OnlineTrajectoryGenerator& self) { return toArray(self.acceleration()); })
+        .def("getTarget", [](const OnlineTrajectoryGenerator& self) { return toArray(self.target()); })
+        .def("duration", &OnlineTrajectoryGenerator::duration,
+             "Duration of the motion planned at the last target change.")
+        .def("timeLeft", &OnlineTrajectoryGenerator::timeLeft, "Time to the target [s].")
+        .def("isFinished", &OnlineTrajectoryGenerator::finished)
+        .def("lastPlanTimeUs", &OnlineTrajectoryGenerator::lastPlanTimeUs, "Time spent in the last planning [us].");
+}
@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Split the range [0, count) into contiguous chunks and run `func(begin, end)` on each chunk.
+ *
+ * @param count Number of items
+ * @param min_chunk Minimum number of items per worker. Ranges smaller than this run on the calling thread.
+ * @param threads Number of worker threads. 0 or negative uses all hardware threads.
+ * @param func Callable with the signature `void(size_t begin, size_t end)`. It must not throw.
+ */
+template <typename Func>
+void parallelFor(size_t count, size_t min_chunk, int threads, Func&& func) {
+    if (count == 0) {
+        return;
+    }
+    min_chunk = std::max<size_t>(min_chunk, 1);
+    size_t workers = threads > 0 ? static_cast<size_t>(threads) : std::max(1u, std::thread::hardware_concurrency());
+    workers = std::min(workers, (count + min_chunk - 1) / min_chunk);
+    if (workers <= 1) {
+        func(size_t(0), count);
+        return;
+    }
+
+    const size_t chunk = (count + workers - 1) / workers;
+    std::vector<std::thread> pool;
+    pool.reserve(workers - 1);
+    for (size_t w = 1; w < workers; ++w) {
+        size_t begin = w * chunk;
+        size_t end = std::min(count, begin + chunk);
+        if (begin >= end) {
+            break;
+        }
+        pool.emplace_back([&func, begin, end]() { func(begin, end); });
+    }
+    func(size_t(0), std::min(chunk, count));
+    for (auto& t : pool) {
+        t.join();
+    }
+}
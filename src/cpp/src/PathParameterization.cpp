@@ -0,0 +1,331 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "PathParameterization.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+constexpr double TINY = 1e-12;
+constexpr size_t MIN_GRID_POINTS = 100;
+// Default grid spacing in chord length: the acceleration bound between two grid points is conservative, more so on
+// a coarser grid
+constexpr double DEFAULT_GRID_STEP = 0.01;
+
+// Largest x in [0, x_max] from which some x' in [0, next] lies in every band slope * x +- width. The lowest x' is a
+// convex function of x and the highest one a concave function, both piecewise linear: Newton steps on their gap, from
+// an upper bound of the answer, reach the crossing in a few iterations.
+double largestControllable(const double* slope, const double* width, size_t count, double next, double x_max) {
+    double x = x_max;
+    for (size_t k = 0; k < count; ++k) {
+        if (slope[k] > TINY) {
+            x = std::min(x, (next + width[k]) / slope[k]);
+        } else if (slope[k] < -TINY) {
+            x = std::min(x, width[k] / -slope[k]);
+        }
+    }
+    if (!std::isfinite(x)) {
+        return x;
+    }
+    for (size_t iteration = 0; iteration < 2 * count + 2; ++iteration) {
+        double low = 0.0, low_slope = 0.0, low_offset = 0.0;
+        double high = next, high_slope = 0.0, high_offset = next;
+        for (size_t k = 0; k < count; ++k) {
+            if (slope[k] * x - width[k] > low) {
+                low = slope[k] * x - width[k];
+                low_slope = slope[k];
+                low_offset = -width[k];
+            }
+            if (slope[k] * x + width[k] < high) {
+                high = slope[k] * x + width[k];
+                high_slope = slope[k];
+                high_offset = width[k];
+            }
+        }
+        if (low <= high) {
+            break;
+        }
+        // The gap is convex and not positive at 0, so it rises where it is positive
+        const double rate = low_slope - high_slope;
+        const double crossing = rate > TINY ? std::max((high_offset - low_offset) / rate, 0.0) : 0.0;
+        if (!(crossing < x)) {
+            break;
+        }
+        x = crossing;
+    }
+    return x;
+}
+
+// Natural cubic spline through the waypoints, parameterized by chord length
+class ChordSpline {
+   public:
+    ChordSpline(const double* path, size_t count, size_t dof) : dof_(dof) {
+        knots_.reserve(count);
+        values_.reserve(count * dof);
+        for (size_t i = 0; i < count; ++i) {
+            const double* point = path + i * dof;
+            double length = 0.0;
+            if (!knots_.empty()) {
+                const double* last = values_.data() + values_.size() - dof;
+                for (size_t j = 0; j < dof; ++j) {
+                    length += (point[j] - last[j]) * (point[j] - last[j]);
+                }
+                length = std::sqrt(length);
+                if (length < TINY) {
+                    continue;
+                }
+            }
+            knots_.push_back(knots_.empty() ? 0.0 : knots_.back() + length);
+            values_.insert(values_.end(), point, point + dof);
+        }
+        solveSecondDerivatives();
+    }
+
+    size_t size() const { return knots_.size(); }
+    double length() const { return knots_.back(); }
+    double knot(size_t k) const { return knots_[k]; }
+
+    // `segment` is a search hint: increasing values of s find their segment in constant time
+    void evaluate(double s, size_t& segment, double* q, double* dq, double* ddq) const {
+        const size_t n = knots_.size();
+        if (n == 1) {
+            std::copy(values_.begin(), values_.end(), q);
+            std::fill(dq, dq + dof_, 0.0);
+            std::fill(ddq, ddq + dof_, 0.0);
+            return;
+        }
+        if (segment + 1 >= n || s < knots_[segment]) {
+            segment = 0;
+        }
+        while (segment + 2 < n && s > knots_[segment + 1]) {
+            ++segment;
+        }
+        const size_t k = segment;
+        const double h = knots_[k + 1] - knots_[k];
+        const double a = (knots_[k + 1] - s) / h;
+        const double b = 1.0 - a;
+        const double* y0 = values_.data() + k * dof_;
+        const double* y1 = y0 + dof_;
+        const double* m0 = second_.data() + k * dof_;
+        const double* m1 = m0 + dof_;
+        for (size_t j = 0; j < dof_; ++j) {
+            q[j] = a * y0[j] + b * y1[j] + ((a * a * a - a) * m0[j] + (b * b * b - b) * m1[j]) * h * h / 6.0;
+            dq[j] = (y1[j] - y0[j]) / h - (3.0 * a * a - 1.0) / 6.0 * h * m0[j] + (3.0 * b * b - 1.0) / 6.0 * h * m1[j];
+            ddq[j] = a * m0[j] + b * m1[j];
+        }
+    }
+
+   private:
+    // Tridiagonal system of the natural spline, one elimination shared by all joints
+    void solveSecondDerivatives() {
+        const size_t n = knots_.size();
+        second_.assign(n * dof_, 0.0);
+        if (n < 3) {
+            return;
+        }
+        std::vector<double> upper(n, 0.0);
+        for (size_t k = 1; k + 1 < n; ++k) {
+            const double h0 = knots_[k] - knots_[k - 1];
+            const double h1 = knots_[k + 1] - knots_[k];
+            const double pivot = 2.0 * (h0 + h1) - h0 * upper[k - 1];
+            upper[k] = h1 / pivot;
+            for (size_t j = 0; j < dof_; ++j) {
+                const double rhs = 6.0 * ((values_[(k + 1) * dof_ + j] - values_[k * dof_ + j]) / h1 -
+                                          (values_[k * dof_ + j] - values_[(k - 1) * dof_ + j]) / h0);
+                second_[k * dof_ + j] = (rhs - h0 * second_[(k - 1) * dof_ + j]) / pivot;
+            }
+        }
+        for (size_t k = n - 2; k >= 1; --k) {
+            for (size_t j = 0; j < dof_; ++j) {
+                second_[k * dof_ + j] -= upper[k] * second_[(k + 1) * dof_ + j];
+            }
+        }
+    }
+
+    size_t dof_;
+    std::vector<double> knots_;
+    std::vector<double> values_;
+    std::vector<double> second_;
+};
+
+}  // namespace
+
+PathParameterization::PathParameterization(size_t dof)
+    : dof_(dof), max_velocity_(dof, 1.0), max_acceleration_(dof, 1.0) {
+    if (dof == 0) {
+        throw std::invalid_argument("The path needs at least one joint");
+    }
+}
+
+void PathParameterization::setLimits(const double* max_velocity, const double* max_acceleration) {
+    for (size_t j = 0; j < dof_; ++j) {
+        if (!(max_velocity[j] > 0.0) || !(max_acceleration[j] > 0.0)) {
+            throw std::invalid_argument("Velocity and acceleration limits must be positive");
+        }
+    }
+    max_velocity_.assign(max_velocity, max_velocity + dof_);
+    max_acceleration_.assign(max_acceleration, max_acceleration + dof_);
+}
+
+PathParameterization::Result PathParameterization::solve(const double* path, size_t count, size_t grid_points,
+                                                         double dt) const {
+    if (count < 2) {
+        throw std::invalid_argument("The path needs at least 2 waypoints");
+    }
+    const ChordSpline spline(path, count, dof_);
+    Result result;
+    if (spline.size() < 2) {
+        // Every waypoint is the same: nothing to move
+        result.time.assign(1, 0.0);
+        result.positions.assign(path, path + dof_);
+        result.velocities.assign(dof_, 0.0);
+        result.accelerations.assign(dof_, 0.0);
+        return result;
+    }
+
+    // Every knot is a grid point, so the third derivative of the spline is constant in every grid interval. Each knot
+    // interval is split evenly at the requested spacing.
+    const double step =
+        grid_points > 0 ? spline.length() / static_cast<double>(std::max<size_t>(grid_points, 2) - 1)
+                        : std::min(DEFAULT_GRID_STEP, spline.length() / static_cast<double>(MIN_GRID_POINTS - 1));
+    std::vector<double> grid;
+    for (size_t k = 0; k + 1 < spline.size(); ++k) {
+        const double start = spline.knot(k);
+        const double length = spline.knot(k + 1) - start;
+        const size_t pieces = std::max<size_t>(1, static_cast<size_t>(std::ceil(length / step - 1e-9)));
+        for (size_t p = 0; p < pieces; ++p) {
+            grid.push_back(start + length * static_cast<double>(p) / static_cast<double>(pieces));
+        }
+    }
+    grid.push_back(spline.length());
+    const size_t m = grid.size();
+    std::vector<double> q(m * dof_), dq(m * dof_), ddq(m * dof_);
+    size_t segment = 0;
+    for (size_t i = 0; i < m; ++i) {
+        spline.evaluate(grid[i], segment, &q[i * dof_], &dq[i * dof_], &ddq[i * dof_]);
+    }
+
+    // With x = (ds/dt)^2, x' its value at the next point, h the length of the interval and u = (x' - x) / 2h the
+    // constant path acceleration of the interval, x is linear in s and the acceleration of a joint is
+    // a = dq * u + ddq * x: a0 at the start of the interval, a1 at its end. The third derivative of the spline is
+    // constant in the interval, so a'' = 5 * dddq * u and, at a fraction t of the interval,
+    // a = (1 - t) * a0 + t * a1 - 5/16 * (ddq1 - ddq0) * (x' - x) * 4t(1 - t).
+    // Bounding a0 and a1 plus or minus the last term keeps the whole interval within the limit, so each joint bounds
+    // x' to four bands slope * x +- width. The velocity bounds x and x' by the peak of dq in the interval, a last band
+    // of slope 0. They are computed once for both passes; an inactive band (x' does not change the acceleration) has
+    // an infinite width and bounds x alone.
+    const size_t band_count = 4 * dof_ + 1;
+    std::vector<double> slope((m - 1) * band_count, 0.0);
+    std::vector<double> width((m - 1) * band_count, std::numeric_limits<double>::infinity());
+    std::vector<double> x_max(m - 1, std::numeric_limits<double>::infinity());
+    for (size_t i = 0; i + 1 < m; ++i) {
+        const double h = grid[i + 1] - grid[i];
+        double* slope_i = &slope[i * band_count];
+        double* width_i = &width[i * band_count];
+        for (size_t j = 0; j < dof_; ++j) {
+            const double d1 = dq[i * dof_ + j];
+            double peak = std::max(std::fabs(d1), std::fabs(dq[(i + 1) * dof_ + j]));
+            const double dd0 = ddq[i * dof_ + j], dd1 = ddq[(i + 1) * dof_ + j];
+            if (dd0 * dd1 < 0.0) {
+                // dq is a quadratic of s, with its vertex where ddq crosses 0
+                const double t = dd0 / (dd0 - dd1);
+                peak = std::max(peak, std::fabs(d1 + h * t * (dd0 + (dd1 - dd0) * t / 2.0)));
+            }
+            if (peak > TINY) {
+                const double v = max_velocity_[j] / peak;
+                x_max[i] = std::min(x_max[i], v * v);
+            }
+            const double a = d1 / (2.0 * h);
+            const double a_next = dq[(i + 1) * dof_ + j] / (2.0 * h);
+            const double bulge = 5.0 / 16.0 * (ddq[(i + 1) * dof_ + j] - ddq[i * dof_ + j]);
+            // coef_next * x' + coef_now * x in [-limit, limit]
+            const double coef_next[4] = {a + bulge, a - bulge, a_next + ddq[(i + 1) * dof_ + j] + bulge,
+                                         a_next + ddq[(i + 1) * dof_ + j] - bulge};
+            const double coef_now[4] = {ddq[i * dof_ + j] - a - bulge, ddq[i * dof_ + j] - a + bulge,
+                                        -a_next - bulge, -a_next + bulge};
+            for (size_t b = 0; b < 4; ++b) {
+                if (std::fabs(coef_next[b]) > TINY) {
+                    slope_i[4 * j + b] = -coef_now[b] / coef_next[b];
+                    width_i[4 * j + b] = max_acceleration_[j] / std::fabs(coef_next[b]);
+                } else if (std::fabs(coef_now[b]) > TINY) {
+                    x_max[i] = std::min(x_max[i], max_acceleration_[j] / std::fabs(coef_now[b]));
+                }
+            }
+        }
+        width_i[band_count - 1] = x_max[i];
+    }
+
+    // Backward pass: largest x of each point from which the end is still reached at rest
+    std::vector<double> controllable(m, 0.0);
+    for (size_t i = m - 1; i-- > 0;) {
+        controllable[i] = largestControllable(&slope[i * band_count], &width[i * band_count], band_count,
+                                              controllable[i + 1], x_max[i]);
+    }
+
+    // Forward pass: fastest next x reachable from the current one that stays controllable
+    std::vector<double> x(m, 0.0);
+    for (size_t i = 0; i + 1 < m; ++i) {
+        double low = 0.0, high = controllable[i + 1];
+        for (size_t k = i * band_count; k < (i + 1) * band_count; ++k) {
+            low = std::max(low, slope[k] * x[i] - width[k]);
+            high = std::min(high, slope[k] * x[i] + width[k]);
+        }
+        // Rounding only: the backward pass guarantees a non-empty band
+        x[i + 1] = high >= low ? high : low;
+    }
+
+    std::vector<double> time(m, 0.0), u(m, 0.0);
+    for (size_t i = 0; i + 1 < m; ++i) {
+        const double h = grid[i + 1] - grid[i];
+        u[i] = (x[i + 1] - x[i]) / (2.0 * h);
+        time[i + 1] = time[i] + 2.0 * h / std::max(std::sqrt(x[i]) + std::sqrt(x[i + 1]), TINY);
+    }
+    u[m - 1] = u[m - 2];
+    result.duration = time[m - 1];
+    if (!(dt > 0.0)) {
+        result.time = time;
+        result.positions = q;
+        result.velocities.resize(m * dof_);
+        result.accelerations.resize(m * dof_);
+        for (size_t i = 0; i < m; ++i) {
+            const double speed = std::sqrt(x[i]);
+            for (size_t j = 0; j < dof_; ++j) {
+                result.velocities[i * dof_ + j] = dq[i * dof_ + j] * speed;
+                result.accelerations[i * dof_ + j] = dq[i * dof_ + j] * u[i] + ddq[i * dof_ + j] * x[i];
+            }
+        }
+        return result;
+    }
+
+    // Resampling: within an interval the path acceleration u is constant
+    const size_t samples = static_cast<size_t>(std::ceil(result.duration / dt - 1e-9)) + 1;
+    result.time.resize(samples);
+    result.positions.resize(samples * dof_);
+    result.velocities.resize(samples * dof_);
+    result.accelerations.resize(samples * dof_);
+    std::vector<double> d1(dof_), d2(dof_);
+    size_t interval = 0;
+    segment = 0;
+    for (size_t k = 0; k < samples; ++k) {
+        const double t = k + 1 == samples ? result.duration : dt * static_cast<double>(k);
+        while (interval + 2 < m && t > time[interval + 1]) {
+            ++interval;
+        }
+        const double tau = t - time[interval];
+        const double speed0 = std::sqrt(x[interval]);
+        const double speed = std::max(speed0 + u[interval] * tau, 0.0);
+        const double s0 = grid[interval];
+        const double s = std::min(std::max(s0 + speed0 * tau + u[interval] * tau * tau / 2.0, s0), grid[interval + 1]);
+        double* position = &result.positions[k * dof_];
+        spline.evaluate(s, segment, position, d1.data(), d2.data());
+        result.time[k] = t;
+        for (size_t j = 0; j < dof_; ++j) {
+            result.velocities[k * dof_ + j] = d1[j] * speed;
+            result.accelerations[k * dof_ + j] = d1[j] * u[interval] + d2[j] * speed * speed;
+        }
+    }
+    return result;
+}
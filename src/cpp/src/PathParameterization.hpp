@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Time-optimal parameterization of a joint path under joint velocity and acceleration limits (TOPP-RA).
+ *
+ * The waypoints are joined by a cubic spline parameterized by chord length s. On a grid of s, a backward pass computes
+ * the largest controllable squared path speed of every point, then a forward pass takes the fastest speed that stays
+ * controllable. Each pass solves a two-variable linear program per grid point in closed form, so the cost grows
+ * linearly with the grid. The limits hold between the grid points too. The motion starts and ends at rest.
+ */
+class PathParameterization {
+   public:
+    struct Result {
+        std::vector<double> time;           // (M,)
+        std::vector<double> positions;      // (M, dof) row-major
+        std::vector<double> velocities;     // (M, dof)
+        std::vector<double> accelerations;  // (M, dof)
+        double duration = 0.0;
+    };
+
+    /**
+     * @throws std::invalid_argument if dof is 0
+     */
+    explicit PathParameterization(size_t dof);
+
+    size_t dof() const { return dof_; }
+
+    /**
+     * @brief Limits of every joint, `dof` values each.
+     *
+     * @throws std::invalid_argument if a limit is not positive
+     */
+    void setLimits(const double* max_velocity, const double* max_acceleration);
+
+    const std::vector<double>& maxVelocity() const { return max_velocity_; }
+    const std::vector<double>& maxAcceleration() const { return max_acceleration_; }
+
+    /**
+     * @brief Parameterize a path.
+     *
+     * @param path Waypoints, (count, dof) row-major. Consecutive duplicates are dropped.
+     * @param grid_points Approximate points of the s grid, 0 for a spacing of 0.01 in chord length. Every waypoint is a
+     * grid point, each interval between two waypoints is split evenly at the spacing.
+     * @param dt > 0 resamples the result every `dt` seconds, otherwise the result holds the grid points
+     * @throws std::invalid_argument if the path has less than 2 waypoints
+     */
+    Result solve(const double* path, size_t count, size_t grid_points = 0, double dt = 0.0) const;
+
+   private:
+    size_t dof_;
+    std::vector<double> max_velocity_;
+    std::vector<double> max_acceleration_;
+};
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "PathParameterizationWrapper.hpp"
+#include "NdArrayUtils.hpp"
+#include "PathParameterization.hpp"
+
+#include <pybind11/numpy.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace py = pybind11;
+
+static py::array_t<double> rowsArray(const std::vector<double>& values, size_t cols) {
+    const py::ssize_t rows = cols == 0 ? 0 : static_cast<py::ssize_t>(values.size() / cols);
+    return py::array_t<double>({rows, static_cast<py::ssize_t>(cols)}, values.data());
+}
+
+static const double* jointValues(const PathParameterization& self, const DoubleArray& values, const char* name) {
+    if (values.ndim() != 1 || static_cast<size_t>(values.shape(0)) != self.dof()) {
+        throw std::runtime_error(std::string(name) + " must have " + std::to_string(self.dof()) + " values");
+    }
+    return values.data();
+}
+
+void bindPathParameterization(py::module_& m) {
+    using Result = PathParameterization::Result;
+    py::class_<Result>(m, "TimedPath", "Path with the timestamps of a time-optimal parameterization.")
+        .def_property_readonly(
+            "time",
+            [](const Result& self) {
+                return py::array_t<double>(static_cast<py::ssize_t>(self.time.size()), self.time.data());
+            },
+            "Timestamps from the start [s], shape (M,).")
+        .def_property_readonly(
+            "positions",
+            [](const Result& self) { return rowsArray(self.positions, self.positions.size() / self.time.size()); },
+            "Joint positions, shape (M, dof).")
+        .def_property_readonly(
+            "velocities",
+            [](const Result& self) { return rowsArray(self.velocities, self.velocities.size() / self.time.size()); },
+            "Joint velocities, shape (M, dof).")
+        .def_property_readonly(
+            "accelerations",
+            [](const Result& self) {
+                return rowsArray(self.accelerations, self.accelerations.size() / self.time.size());
+            },
+            "Joint accelerations, shape (M, dof).")
+        .def_readonly("duration", &Result::duration, "Duration of the motion [s].")
+        .def(
+            "pointDurations",
+            [](const Result& self) {
+                py::array_t<double> durations(static_cast<py::ssize_t>(self.time.size()));
+                auto out = durations.mutable_unchecked<1>();
+                for (size_t i = 0; i < self.time.size(); ++i) {
+                    out(i) = i == 0 ? 0.0 : self.time[i] - self.time[i - 1];
+                }
+                return durations;
+            },
+            R"doc(
+                Time between each point and the previous one, the `time` argument of writeTrajectoryPoint(). The first
+                point is the start of the path and takes 0.
+            )doc")
+        .def("__len__", [](const Result& self) { return self.time.size(); })
+        .def("__repr__", [](const Result& self) {
+            return py::str("<TimedPath points={} duration={:.3f}s>").format(self.time.size(), self.duration);
+        });
+
+    py::class_<PathParameterization>(m, "PathParameterization",
+                                     "Time-optimal parameterization of a joint path under joint velocity and "
+                                     "acceleration limits (TOPP-RA).")
+        .def(py::init([](const DoubleArray& max_velocity, const DoubleArray& max_acceleration) {
+                 if (max_velocity.ndim() != 1 || max_velocity.shape(0) == 0) {
+                     throw std::runtime_error("max_velocity must be a non-empty 1-D array");
+                 }
+                 auto solver = std::make_unique<PathParameterization>(static_cast<size_t>(max_velocity.shape(0)));
+                 solver->setLimits(max_velocity.data(), jointValues(*solver, max_acceleration, "max_acceleration"));
+                 return solver;
+             }),
+             py::arg("max_velocity"), py::arg("max_acceleration"),
+             R"doc(
+                Args:
+                    max_velocity (numpy.ndarray): Velocity limit of every joint [rad/s], its length sets the number of
+                        joints
+                    max_acceleration (numpy.ndarray): Acceleration limit of every joint [rad/s^2]
+
+                Raises:
+                    ValueError: A limit is not positive
+            )doc")
+        .def("dof", &PathParameterization::dof)
+        .def(
+            "setLimits",
+            [](PathParameterization& self, const DoubleArray& max_velocity, const DoubleArray& max_acceleration) {
+                self.setLimits(jointValues(self, max_velocity, "max_velocity"),
+                               jointValues(self, max_acceleration, "max_acceleration"));
+            },
+            py::arg("max_velocity"), py::arg("max_acceleration"))
+        .def(
+            "getLimits",
+            [](const PathParameterization& self) {
+                return py::make_tuple(
+                    py::array_t<double>(static_cast<py::ssize_t>(self.dof()), self.maxVelocity().data()),
+                    py::array_t<double>(static_cast<py::ssize_t>(self.dof()), self.maxAcceleration().data()));
+            },
+            "Velocity and acceleration limits.")
+        .def(
+            "compute",
+            [](const PathParameterization& self, const DoubleArray& path, double dt, size_t grid_points) {
+                const size_t count = requireRows(path, static_cast<py::ssize_t>(self.dof()), "path");
+                const double* data = path.data();
+                py::gil_scoped_release release;
+                return self.solve(data, count, grid_points, dt);
+            },
+            py::arg("path"), py::arg("dt") = 0.0, py::arg("grid_points") = 0,
+            R"doc(
+                Time-parameterize a joint path, starting and ending at rest.
+
+                The waypoints are joined by a cubic spline parameterized by chord length, so the path passes through
+                every waypoint. The limits hold along the whole motion, between the grid points too. The cost grows
+                linearly with the grid size.
+
+                Args:
+                    path (numpy.ndarray): Waypoints, shape (N, dof), N >= 2
+                    dt (float): > 0 resamples the result every dt seconds (e.g. the servo period); 0 returns the grid
+                        points
+                    grid_points (int): Approximate size of the grid, 0 for a spacing of 0.01 in chord length (the
+                        Euclidean distance in joint space). Every waypoint is a grid point, so the grid may be
+                        larger.
+
+                Returns:
+                    TimedPath: Timestamps, positions, velocities and accelerations
+            )doc");
+}
@@ -0,0 +1,312 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "PoseMath.hpp"
+#include "RotationUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+void rotate(const double* R, const double* v, double* out) {
+    const double x = R[0] * v[0] + R[1] * v[1] + R[2] * v[2];
+    const double y = R[3] * v[0] + R[4] * v[1] + R[5] * v[2];
+    const double z = R[6] * v[0] + R[7] * v[1] + R[8] * v[2];
+    out[0] = x, out[1] = y, out[2] = z;
+}
+
+// log(q) = rotvec / 2 and exp(v) = quaternion of rotvec 2 v, for unit quaternions
+void quatLog(const double* q, double* v) {
+    quatToRotvec(q, v);
+    v[0] *= 0.5, v[1] *= 0.5, v[2] *= 0.5;
+}
+
+void quatExp(const double* v, double* q) {
+    const double rv[3] = {2.0 * v[0], 2.0 * v[1], 2.0 * v[2]};
+    rotvecToQuat(rv, q);
+}
+
+void quatConjugate(const double* q, double* out) { out[0] = q[0], out[1] = -q[1], out[2] = -q[2], out[3] = -q[3]; }
+
+}  // namespace
+
+void rotvecToQuatBatch(const double* rotvec, size_t count, double* quat) {
+    for (size_t i = 0; i < count; ++i) {
+        double q[4];
+        rotvecToQuat(rotvec + i * 3, q);
+        std::copy(q, q + 4, quat + i * 4);
+    }
+}
+
+void quatToRotvecBatch(const double* quat, size_t count, double* rotvec) {
+    for (size_t i = 0; i < count; ++i) {
+        double rv[3];
+        quatToRotvec(quat + i * 4, rv);
+        std::copy(rv, rv + 3, rotvec + i * 3);
+    }
+}
+
+void rotvecToMatrixBatch(const double* rotvec, size_t count, double* matrix) {
+    for (size_t i = 0; i < count; ++i) {
+        double R[9];
+        rotvecToMatrix(rotvec + i * 3, R);
+        std::copy(R, R + 9, matrix + i * 9);
+    }
+}
+
+// Through Shepperd's quaternion, which keeps full precision up to an angle of pi
+void matrixToRotvecBatch(const double* matrix, size_t count, double* rotvec) {
+    for (size_t i = 0; i < count; ++i) {
+        double q[4], rv[3];
+        matrixToQuat(matrix + i * 9, q);
+        quatToRotvec(q, rv);
+        std::copy(rv, rv + 3, rotvec + i * 3);
+    }
+}
+
+void quatToMatrixBatch(const double* quat, size_t count, double* matrix) {
+    for (size_t i = 0; i < count; ++i) {
+        const double* in = quat + i * 4;
+        const double norm = 1.0 / std::sqrt(in[0] * in[0] + in[1] * in[1] + in[2] * in[2] + in[3] * in[3]);
+        const double q[4] = {in[0] * norm, in[1] * norm, in[2] * norm, in[3] * norm};
+        double R[9];
+        quatToMatrix(q, R);
+        std::copy(R, R + 9, matrix + i * 9);
+    }
+}
+
+void matrixToQuatBatch(const double* matrix, size_t count, double* quat) {
+    for (size_t i = 0; i < count; ++i) {
+        double q[4];
+        matrixToQuat(matrix + i * 9, q);
+        std::copy(q, q + 4, quat + i * 4);
+    }
+}
+
+void poseToMatrixBatch(const double* pose, size_t count, double* matrix) {
+    for (size_t i = 0; i < count; ++i) {
+        const double* p = pose + i * 6;
+        double R[9];
+        rotvecToMatrix(p + 3, R);
+        const double T[16] = {R[0], R[1], R[2], p[0], R[3], R[4], R[5], p[1],
+                              R[6], R[7], R[8], p[2], 0.0,  0.0,  0.0,  1.0};
+        std::copy(T, T + 16, matrix + i * 16);
+    }
+}
+
+void matrixToPoseBatch(const double* matrix, size_t count, double* pose) {
+    for (size_t i = 0; i < count; ++i) {
+        const double* T = matrix + i * 16;
+        const double R[9] = {T[0], T[1], T[2], T[4], T[5], T[6], T[8], T[9], T[10]};
+        double q[4], p[6] = {T[3], T[7], T[11]};
+        matrixToQuat(R, q);
+        quatToRotvec(q, p + 3);
+        std::copy(p, p + 6, pose + i * 6);
+    }
+}
+
+void poseTransBatch(const double* a, size_t a_count, const double* b, size_t b_count, double* out) {
+    const size_t count = std::max(a_count, b_count);
+    const size_t a_step = a_count == 1 ? 0 : 6;
+    const size_t b_step = b_count == 1 ? 0 : 6;
+    // Quaternions compose with fewer operations than matrices and stay accurate near pi
+    double qa[4] = {1.0, 0.0, 0.0, 0.0}, Ra[9] = {};
+    if (a_step == 0) {
+        rotvecToQuat(a + 3, qa);
+        quatToMatrix(qa, Ra);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        const double* pa = a + i * a_step;
+        const double* pb = b + i * b_step;
+        if (a_step != 0) {
+            rotvecToQuat(pa + 3, qa);
+            quatToMatrix(qa, Ra);
+        }
+        double qb[4], q[4], p[6];
+        rotvecToQuat(pb + 3, qb);
+        quatMul(qa, qb, q);
+        rotate(Ra, pb, p);
+        p[0] += pa[0], p[1] += pa[1], p[2] += pa[2];
+        quatToRotvec(q, p + 3);
+        std::copy(p, p + 6, out + i * 6);
+    }
+}
+
+void poseInvBatch(const double* pose, size_t count, double* out) {
+    for (size_t i = 0; i < count; ++i) {
+        const double* p = pose + i * 6;
+        double R[9];
+        rotvecToMatrix(p + 3, R);
+        // t' = -R^T t, and the inverse rotation is the opposite rotation vector
+        const double inv[6] = {-(R[0] * p[0] + R[3] * p[1] + R[6] * p[2]), -(R[1] * p[0] + R[4] * p[1] + R[7] * p[2]),
+                               -(R[2] * p[0] + R[5] * p[1] + R[8] * p[2]), -p[3], -p[4], -p[5]};
+        std::copy(inv, inv + 6, out + i * 6);
+    }
+}
+
+void transformPointsBatch(const double* pose, size_t pose_count, const double* points, size_t count, double* out,
+                          bool rotate_only) {
+    const size_t pose_step = pose_count == 1 ? 0 : 6;
+    double R[9];
+    if (pose_step == 0) {
+        rotvecToMatrix(pose + 3, R);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        const double* p = pose + i * pose_step;
+        if (pose_step != 0) {
+            rotvecToMatrix(p + 3, R);
+        }
+        double v[3];
+        rotate(R, points + i * 3, v);
+        if (!rotate_only) {
+            v[0] += p[0], v[1] += p[1], v[2] += p[2];
+        }
+        std::copy(v, v + 3, out + i * 3);
+    }
+}
+
+void unwrapRotvecs(double* rotvec, size_t count, size_t stride) {
+    for (size_t i = 1; i < count; ++i) {
+        const double* prev = rotvec + (i - 1) * stride;
+        double* rv = rotvec + i * stride;
+        const double angle = std::sqrt(rv[0] * rv[0] + rv[1] * rv[1] + rv[2] * rv[2]);
+        double axis[3];
+        if (angle > 1e-12) {
+            axis[0] = rv[0] / angle, axis[1] = rv[1] / angle, axis[2] = rv[2] / angle;
+        } else {
+            // Identity: any multiple of 2 pi along any axis, the axis of the previous vector is the closest
+            const double prev_angle = std::sqrt(prev[0] * prev[0] + prev[1] * prev[1] + prev[2] * prev[2]);
+            if (prev_angle < 1e-12) {
+                continue;
+            }
+            axis[0] = prev[0] / prev_angle, axis[1] = prev[1] / prev_angle, axis[2] = prev[2] / prev_angle;
+        }
+        // Equivalent vectors are axis * (angle + 2 k pi); the closest to prev has the closest projection on the axis
+        const double along = prev[0] * axis[0] + prev[1] * axis[1] + prev[2] * axis[2];
+        const double k = std::round((along - angle) / (2.0 * ROTATION_PI));
+        if (k != 0.0) {
+            const double unwrapped = angle + 2.0 * ROTATION_PI * k;
+            rv[0] = axis[0] * unwrapped, rv[1] = axis[1] * unwrapped, rv[2] = axis[2] * unwrapped;
+        }
+    }
+}
+
+std::vector<double> interpolatePoses(const double* poses, const double* times, size_t count, double dt,
+                                     PoseInterpolation method) {
+    if (count == 0) {
+        throw std::invalid_argument("At least one waypoint is needed");
+    }
+    if (!(dt > 0.0)) {
+        throw std::invalid_argument("dt must be positive");
+    }
+    for (size_t i = 1; i < count; ++i) {
+        if (!(times[i] > times[i - 1])) {
+            throw std::invalid_argument("Waypoint times must increase strictly");
+        }
+    }
+
+    // Quaternions on one hemisphere, so that every segment takes the shorter arc
+    std::vector<double> quats(count * 4);
+    for (size_t i = 0; i < count; ++i) {
+        double* q = &quats[i * 4];
+        rotvecToQuat(poses + i * 6 + 3, q);
+        if (i > 0) {
+            const double* prev = q - 4;
+            if (prev[0] * q[0] + prev[1] * q[1] + prev[2] * q[2] + prev[3] * q[3] < 0.0) {
+                q[0] = -q[0], q[1] = -q[1], q[2] = -q[2], q[3] = -q[3];
+            }
+        }
+    }
+
+    // SQUAD control quaternions and Hermite tangents of the position. Each waypoint gets the average of the rates of
+    // its two segments, zero at both ends so that the motion starts and stops at rest. The control quaternions of a
+    // waypoint are scaled by the duration of each segment: with uneven times the segments before and after it need
+    // different ones for the angular velocity to stay continuous.
+    std::vector<double> inner_in, inner_out, tangents;
+    if (method == PoseInterpolation::SQUAD) {
+        inner_in = quats;
+        inner_out = quats;
+        tangents.assign(count * 3, 0.0);
+        for (size_t i = 0; i < count && count > 1; ++i) {
+            const double* q = &quats[i * 4];
+            const double span_prev = i > 0 ? times[i] - times[i - 1] : 0.0;
+            const double span_next = i + 1 < count ? times[i + 1] - times[i] : 0.0;
+            double conj[4], rel[4], log_next[3] = {0.0, 0.0, 0.0}, log_prev[3] = {0.0, 0.0, 0.0};
+            quatConjugate(q, conj);
+            if (i + 1 < count) {
+                quatMul(conj, q + 4, rel);
+                quatLog(rel, log_next);
+            }
+            if (i > 0) {
+                quatMul(conj, q - 4, rel);
+                quatLog(rel, log_prev);
+            }
+            const bool end = i == 0 || i + 1 == count;
+            double v_in[3], v_out[3];
+            for (size_t j = 0; j < 3; ++j) {
+                // Rate of log(q) at the waypoint, in the frame of the waypoint
+                const double rate = end ? 0.0 : (log_next[j] / span_next - log_prev[j] / span_prev) / 2.0;
+                v_in[j] = -(log_prev[j] + rate * span_prev) / 2.0;
+                v_out[j] = (rate * span_next - log_next[j]) / 2.0;
+                if (!end) {
+                    const double next = (poses[(i + 1) * 6 + j] - poses[i * 6 + j]) / span_next;
+                    const double prev = (poses[i * 6 + j] - poses[(i - 1) * 6 + j]) / span_prev;
+                    tangents[i * 3 + j] = (next + prev) / 2.0;
+                }
+            }
+            double e[4];
+            quatExp(v_in, e);
+            quatMul(q, e, &inner_in[i * 4]);
+            quatExp(v_out, e);
+            quatMul(q, e, &inner_out[i * 4]);
+        }
+    }
+
+    const double total = times[count - 1] - times[0];
+    const size_t samples = static_cast<size_t>(std::ceil(total / dt - 1e-9)) + 1;
+    std::vector<double> out(samples * 6);
+    size_t segment = 0;
+    for (size_t k = 0; k < samples; ++k) {
+        double* p = &out[k * 6];
+        const double t = k + 1 == samples ? times[count - 1] : times[0] + dt * static_cast<double>(k);
+        if (count == 1) {
+            std::copy(poses, poses + 6, p);
+            continue;
+        }
+        while (segment + 2 < count && t > times[segment + 1]) {
+            ++segment;
+        }
+        const size_t i = segment;
+        const double span = times[i + 1] - times[i];
+        const double h = std::min(std::max((t - times[i]) / span, 0.0), 1.0);
+        const double* p0 = poses + i * 6;
+        const double* p1 = p0 + 6;
+        const double* q0 = &quats[i * 4];
+        double q[4];
+        if (method == PoseInterpolation::SQUAD) {
+            // Cubic Hermite position, SQUAD rotation
+            const double h2 = h * h, h3 = h2 * h;
+            const double c00 = 2.0 * h3 - 3.0 * h2 + 1.0, c10 = h3 - 2.0 * h2 + h;
+            const double c01 = -2.0 * h3 + 3.0 * h2, c11 = h3 - h2;
+            for (size_t j = 0; j < 3; ++j) {
+                p[j] = c00 * p0[j] + c10 * span * tangents[i * 3 + j] + c01 * p1[j] +
+                       c11 * span * tangents[(i + 1) * 3 + j];
+            }
+            double outer[4], mid[4];
+            quatSlerp(q0, q0 + 4, h, outer);
+            quatSlerp(&inner_out[i * 4], &inner_in[(i + 1) * 4], h, mid);
+            quatSlerp(outer, mid, 2.0 * h * (1.0 - h), q);
+        } else {
+            for (size_t j = 0; j < 3; ++j) {
+                p[j] = p0[j] + h * (p1[j] - p0[j]);
+            }
+            quatSlerp(q0, q0 + 4, h, q);
+        }
+        quatToRotvec(q, p + 3);
+    }
+    // The stream starts from the rotation vector of the first waypoint as given and stays continuous from there
+    std::copy(poses + 3, poses + 6, out.begin() + 3);
+    unwrapRotvecs(out.data() + 3, samples, 6);
+    return out;
+}
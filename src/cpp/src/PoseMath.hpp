@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// Batched pose math on contiguous row-major arrays. Poses are [x, y, z, rx, ry, rz] with the controller's rotation
+// vector convention, quaternions [w, x, y, z], rotation matrices 3x3 and homogeneous matrices 4x4.
+//
+// Every kernel reads a row completely before writing it, so an output may alias an input of the same row size: the
+// operation then runs in place.
+
+enum class PoseInterpolation {
+    SLERP = 0,  // Linear position, SLERP rotation: continuous pose, velocity steps at waypoints
+    SQUAD = 1   // Cubic position, SQUAD rotation: continuous velocity through waypoints
+};
+
+void rotvecToQuatBatch(const double* rotvec, size_t count, double* quat);
+void quatToRotvecBatch(const double* quat, size_t count, double* rotvec);
+void rotvecToMatrixBatch(const double* rotvec, size_t count, double* matrix);
+void matrixToRotvecBatch(const double* matrix, size_t count, double* rotvec);
+void quatToMatrixBatch(const double* quat, size_t count, double* matrix);
+void matrixToQuatBatch(const double* matrix, size_t count, double* quat);
+void poseToMatrixBatch(const double* pose, size_t count, double* matrix);
+void matrixToPoseBatch(const double* matrix, size_t count, double* pose);
+
+/**
+ * @brief out = a * b, the pose b given in the frame a expressed in the base frame (pose_trans of the controller).
+ *
+ * `a_count` and `b_count` are equal, or one of them is 1 and that pose is applied to every row of the other.
+ */
+void poseTransBatch(const double* a, size_t a_count, const double* b, size_t b_count, double* out);
+
+/**
+ * @brief Inverse of each pose (pose_inv of the controller).
+ */
+void poseInvBatch(const double* pose, size_t count, double* out);
+
+/**
+ * @brief Express points given in the frame of `pose` in the base frame: R * p + t, or R * p when `rotate_only` is set
+ * (directions, velocities, forces).
+ *
+ * `pose_count` is 1 or `count`.
+ */
+void transformPointsBatch(const double* pose, size_t pose_count, const double* points, size_t count, double* out,
+                          bool rotate_only);
+
+/**
+ * @brief Make a sequence of rotation vectors continuous in place: each one is replaced by the equivalent rotation
+ * vector (angle + 2 k pi along the same axis) closest to the previous one.
+ *
+ * @param stride Distance between two rotation vectors, 3 for rotation vectors and 6 for poses
+ */
+void unwrapRotvecs(double* rotvec, size_t count, size_t stride);
+
+/**
+ * @brief Sample the motion through timed waypoint poses every `dt`, from the first to the last time included.
+ *
+ * The rotation vectors of the result are unwrapped from the first waypoint, so the stream has no jump near pi. With
+ * SQUAD the linear and the angular velocity are continuous, also with uneven times, and zero at both ends.
+ *
+ * @param times Strictly increasing times of the waypoints
+ * @return Samples, (M, 6) row-major
+ * @throws std::invalid_argument if there is no waypoint, dt is not positive or the times do not increase
+ */
+std::vector<double> interpolatePoses(const double* poses, const double* times, size_t count, double dt,
+                                     PoseInterpolation method);
@@ -0,0 +1,251 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "PoseMathWrapper.hpp"
+#include "NdArrayUtils.hpp"
+#include "PoseMath.hpp"
+
+#include <pybind11/numpy.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace py = pybind11;
+
+using OutArray = py::array_t<double, py::array::c_style>;
+
+static std::string shapeText(const std::vector<py::ssize_t>& dims) {
+    std::string text = "(N";
+    for (py::ssize_t dim : dims) {
+        text += ", " + std::to_string(dim);
+    }
+    return text + ")";
+}
+
+// Number of items of shape `dims` in `arr`, which holds one item or a batch (N, *dims)
+static size_t requireItems(const DoubleArray& arr, const std::vector<py::ssize_t>& dims, const char* name,
+                           bool& batch) {
+    const auto rank = static_cast<py::ssize_t>(dims.size());
+    batch = arr.ndim() == rank + 1;
+    if (arr.ndim() == rank || batch) {
+        bool match = true;
+        for (py::ssize_t i = 0; i < rank; ++i) {
+            match = match && arr.shape(i + (batch ? 1 : 0)) == dims[i];
+        }
+        if (match) {
+            return batch ? static_cast<size_t>(arr.shape(0)) : 1;
+        }
+    }
+    throw std::runtime_error(std::string(name) + " must be an array of shape " + shapeText(dims));
+}
+
+/**
+ * @brief The array receiving a result: a new one, or `out` when given. `out` is written without conversion, so it must
+ * be a writable C-contiguous float64 array of the exact shape. It may be an input of the same shape (in place).
+ */
+static OutArray outputArray(const py::object& out, size_t count, bool batch, std::vector<py::ssize_t> dims) {
+    if (batch) {
+        dims.insert(dims.begin(), static_cast<py::ssize_t>(count));
+    }
+    if (out.is_none()) {
+        return OutArray(dims);
+    }
+    if (!py::isinstance<OutArray>(out)) {
+        throw std::runtime_error("out must be a C-contiguous float64 numpy array");
+    }
+    auto array = py::reinterpret_borrow<OutArray>(out);
+    if (!array.writeable() || array.ndim() != static_cast<py::ssize_t>(dims.size()) ||
+        !std::equal(dims.begin(), dims.end(), array.shape())) {
+        throw std::runtime_error("out must be a writable array of the result shape");
+    }
+    return array;
+}
+
+using ConvertKernel = void (*)(const double*, size_t, double*);
+
+// Element-wise conversion between two representations
+static void defConversion(py::module_& m, const char* name, ConvertKernel kernel, std::vector<py::ssize_t> in_dims,
+                          std::vector<py::ssize_t> out_dims, const char* arg, const char* doc) {
+    m.def(
+        name,
+        [kernel, in_dims, out_dims, arg](const DoubleArray& values, const py::object& out) {
+            bool batch = false;
+            const size_t count = requireItems(values, in_dims, arg, batch);
+            OutArray result = outputArray(out, count, batch, out_dims);
+            const double* in = values.data();
+            double* data = result.mutable_data();
+            {
+                py::gil_scoped_release release;
+                kernel(in, count, data);
+            }
+            return result;
+        },
+        py::arg(arg), py::arg("out") = py::none(), doc);
+}
+
+void bindPoseMath(py::module_& m) {
+    py::enum_<PoseInterpolation>(m, "PoseInterpolation", py::arithmetic())
+        .value("SLERP", PoseInterpolation::SLERP, "Linear position, SLERP rotation")
+        .value("SQUAD", PoseInterpolation::SQUAD, "Cubic position, SQUAD rotation, continuous velocity")
+        .export_values();
+
+    defConversion(m, "rotvecToQuat", rotvecToQuatBatch, {3}, {4}, "rotvec",
+                  "Rotation vectors (N, 3) to unit quaternions [w, x, y, z] (N, 4), w >= 0.");
+    defConversion(m, "quatToRotvec", quatToRotvecBatch, {4}, {3}, "quat",
+                  "Quaternions [w, x, y, z] (N, 4) to rotation vectors (N, 3) with an angle in [0, pi].");
+    defConversion(m, "rotvecToMatrix", rotvecToMatrixBatch, {3}, {3, 3}, "rotvec",
+                  "Rotation vectors (N, 3) to rotation matrices (N, 3, 3).");
+    defConversion(m, "matrixToRotvec", matrixToRotvecBatch, {3, 3}, {3}, "matrix",
+                  "Rotation matrices (N, 3, 3) to rotation vectors (N, 3) with an angle in [0, pi].");
+    defConversion(m, "quatToMatrix", quatToMatrixBatch, {4}, {3, 3}, "quat",
+                  "Quaternions [w, x, y, z] (N, 4), normalized first, to rotation matrices (N, 3, 3).");
+    defConversion(m, "matrixToQuat", matrixToQuatBatch, {3, 3}, {4}, "matrix",
+                  "Rotation matrices (N, 3, 3) to unit quaternions [w, x, y, z] (N, 4), w >= 0.");
+    defConversion(m, "poseToMatrix", poseToMatrixBatch, {6}, {4, 4}, "pose",
+                  "Poses [x, y, z, rx, ry, rz] (N, 6) to homogeneous matrices (N, 4, 4).");
+    defConversion(m, "matrixToPose", matrixToPoseBatch, {4, 4}, {6}, "matrix",
+                  "Homogeneous matrices (N, 4, 4) to poses [x, y, z, rx, ry, rz] (N, 6).");
+    defConversion(m, "poseInv", poseInvBatch, {6}, {6}, "pose",
+                  "Inverse of each pose (N, 6), like pose_inv() of the controller.");
+
+    m.def(
+        "poseTrans",
+        [](const DoubleArray& a, const DoubleArray& b, const py::object& out) {
+            bool a_batch = false, b_batch = false;
+            const size_t a_count = requireItems(a, {6}, "a", a_batch);
+            const size_t b_count = requireItems(b, {6}, "b", b_batch);
+            if (a_count != b_count && a_count != 1 && b_count != 1) {
+                throw std::runtime_error("a and b must have the same number of poses, or one of them a single pose");
+            }
+            const size_t count = std::max(a_count, b_count);
+            OutArray result = outputArray(out, count, a_batch || b_batch, {6});
+            const double* a_data = a.data();
+            const double* b_data = b.data();
+            double* data = result.mutable_data();
+            {
+                py::gil_scoped_release release;
+                poseTransBatch(a_data, a_count, b_data, b_count, data);
+            }
+            return result;
+        },
+        py::arg("a"), py::arg("b"), py::arg("out") = py::none(),
+        R"doc(
+            Compose poses: b given in the frame a, expressed in the base frame. Same as pose_trans() of the controller.
+
+            Args:
+                a (numpy.ndarray): Poses, shape (6,) or (N, 6)
+                b (numpy.ndarray): Poses, shape (6,) or (N, 6). A single pose on either side applies to every pose of
+                    the other, e.g. a tool offset for a whole path.
+                out (numpy.ndarray): Optional result array, may be a or b to compute in place
+
+            Returns:
+                numpy.ndarray: Poses, shape (6,) or (N, 6)
+        )doc");
+
+    m.def(
+        "transformPoints",
+        [](const DoubleArray& pose, const DoubleArray& points, bool rotate_only, const py::object& out) {
+            bool pose_batch = false, points_batch = false;
+            const size_t pose_count = requireItems(pose, {6}, "pose", pose_batch);
+            const size_t count = requireItems(points, {3}, "points", points_batch);
+            if (pose_count != 1 && pose_count != count) {
+                throw std::runtime_error("pose must be a single pose or one pose per point");
+            }
+            OutArray result = outputArray(out, count, points_batch, {3});
+            const double* pose_data = pose.data();
+            const double* in = points.data();
+            double* data = result.mutable_data();
+            {
+                py::gil_scoped_release release;
+                transformPointsBatch(pose_data, pose_count, in, count, data, rotate_only);
+            }
+            return result;
+        },
+        py::arg("pose"), py::arg("points"), py::arg("rotate_only") = false, py::arg("out") = py::none(),
+        R"doc(
+            Express points given in the frame of a pose in the base frame.
+
+            Args:
+                pose (numpy.ndarray): Frame, shape (6,), or one frame per point, shape (N, 6)
+                points (numpy.ndarray): Points, shape (3,) or (N, 3)
+                rotate_only (bool): Only rotate, for directions, velocities and forces
+                out (numpy.ndarray): Optional result array, may be points to compute in place
+
+            Returns:
+                numpy.ndarray: Points, shape (3,) or (N, 3)
+        )doc");
+
+    m.def(
+        "unwrapRotvecs",
+        [](const DoubleArray& values, const py::object& out) {
+            bool batch = false;
+            const py::ssize_t cols = values.ndim() == 2 ? values.shape(1) : 0;
+            if (cols != 3 && cols != 6) {
+                throw std::runtime_error("values must be an array of shape (N, 3) or (N, 6)");
+            }
+            const size_t count = requireItems(values, {cols}, "values", batch);
+            OutArray result = outputArray(out, count, batch, {cols});
+            const double* in = values.data();
+            double* data = result.mutable_data();
+            {
+                py::gil_scoped_release release;
+                if (data != in) {
+                    std::copy(in, in + count * static_cast<size_t>(cols), data);
+                }
+                unwrapRotvecs(data + (cols == 6 ? 3 : 0), count, static_cast<size_t>(cols));
+            }
+            return result;
+        },
+        py::arg("values"), py::arg("out") = py::none(),
+        R"doc(
+            Make a sequence of rotation vectors continuous: each one becomes the equivalent rotation vector closest to
+            the previous one. Removes the jumps of the rotation vectors near an angle of pi before streaming or
+            differentiating them.
+
+            Args:
+                values (numpy.ndarray): Rotation vectors, shape (N, 3), or poses, shape (N, 6)
+                out (numpy.ndarray): Optional result array, may be values to compute in place
+
+            Returns:
+                numpy.ndarray: Same shape as values
+        )doc");
+
+    m.def(
+        "interpolatePoses",
+        [](const DoubleArray& poses, const DoubleArray& times, double dt, PoseInterpolation method) {
+            bool batch = false;
+            const size_t count = requireItems(poses, {6}, "poses", batch);
+            if (times.ndim() != 1 || static_cast<size_t>(times.shape(0)) != count) {
+                throw std::runtime_error("times must have one value per pose");
+            }
+            const double* pose_data = poses.data();
+            const double* time_data = times.data();
+            std::vector<double> samples;
+            {
+                py::gil_scoped_release release;
+                samples = interpolatePoses(pose_data, time_data, count, dt, method);
+            }
+            return py::array_t<double>({static_cast<py::ssize_t>(samples.size() / 6), py::ssize_t(6)},
+                                       samples.data());
+        },
+        py::arg("poses"), py::arg("times"), py::arg("dt"), py::arg("method") = PoseInterpolation::SLERP,
+        R"doc(
+            Sample the cartesian motion through timed waypoint poses at a fixed period, e.g. for servoL() or a
+            cartesian trajectory.
+
+            Args:
+                poses (numpy.ndarray): Waypoint poses, shape (N, 6)
+                times (numpy.ndarray): Strictly increasing times of the waypoints [s], shape (N,)
+                dt (float): Sample period [s]
+                method (PoseInterpolation): SLERP is linear between waypoints; SQUAD goes through them with a
+                    continuous linear and angular velocity, also with uneven times, and starts and ends at rest
+
+            Returns:
+                numpy.ndarray: Poses every dt from the first to the last time, shape (M, 6). Rotation vectors are
+                continuous, starting from the one of the first waypoint.
+
+            Raises:
+                ValueError: dt is not positive or the times do not increase
+        )doc");
+}
@@ -6,15 +6,33 @@
 #include <pybind11/stl.h>
 #include <array>
 #include <cstdint>
+#include <memory>
+
+#include "SdkThreadsWrapper.hpp"
 
 namespace py = pybind11;
 using namespace ELITE;
 
 void bindPrimaryPortInterface(py::module_& m) {
-    py::class_<PrimaryPortInterface>(m, "PrimaryClientInterface", "Robot primary port interface")
-        .def(py::init<>())
-        .def("connect", &PrimaryPortInterface::connect, py::arg("ip"), py::arg("port") = PrimaryPortInterface::PRIMARY_PORT,
-             py::call_guard<py::gil_scoped_release>(),
+    py::class_<PrimaryPortInterface, SdkThreadsPtr<PrimaryPortInterface>> primary(m, "PrimaryClientInterface",
+                                                                            "Robot primary port interface");
+    primary
+        .def(py::init([]() {
+            SdkThreadCapture capture("PrimaryPortInterface");
+            SdkThreadsPtr<PrimaryPortInterface> self(new PrimaryPortInterface());
+            capture.commit(self.get(), true);
+            return self;
+        }))
+        .def(
+            "connect",
+            [](PrimaryPortInterface& self, const std::string& ip, int port) {
+                // The receive thread starts on connection
+                SdkThreadCapture capture("PrimaryPortInterface");
+                const bool ok = self.connect(ip, port);
+                capture.commit(&self);
+                return ok;
+            },
+            py::arg("ip"), py::arg("port") = PrimaryPortInterface::PRIMARY_PORT, py::call_guard<py::gil_scoped_release>(),
              R"doc(
                     Connect to robot primary port.
 
@@ -68,4 +86,5 @@ void bindPrimaryPortInterface(py::module_& m) {
                 Args:
                     cb (Callable[[RobotExceptionSharedPtr]])
             )doc");
+    defThreadPolicyMethods(primary);
 }
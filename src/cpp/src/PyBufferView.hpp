@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <pybind11/pybind11.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief RAII view of a C-contiguous Python buffer (bytes, bytearray, memoryview, ndarray...).
+ *
+ * The exporter keeps the memory alive and unresized while the view exists, so the data can be used with the GIL
+ * released. Construction and destruction require the GIL.
+ */
+class PyBufferView {
+   public:
+    /**
+     * @param obj Object implementing the buffer protocol
+     * @param writable Request a writable buffer
+     * @throws pybind11::error_already_set (BufferError/TypeError) if the object cannot export such a buffer
+     */
+    PyBufferView(pybind11::handle obj, bool writable) {
+        const int flags = PyBUF_C_CONTIGUOUS | (writable ? PyBUF_WRITABLE : 0);
+        if (PyObject_GetBuffer(obj.ptr(), &view_, flags) != 0) {
+            throw pybind11::error_already_set();
+        }
+    }
+
+    ~PyBufferView() { PyBuffer_Release(&view_); }
+
+    PyBufferView(const PyBufferView&) = delete;
+    PyBufferView& operator=(const PyBufferView&) = delete;
+
+    uint8_t* data() const { return static_cast<uint8_t*>(view_.buf); }
+    size_t size() const { return static_cast<size_t>(view_.len); }
+
+   private:
+    Py_buffer view_;
+};
@@ -2,15 +2,121 @@
 // Copyright (c) 2025, Elite Robots.
 #include "RemoteUpgradeWrapper.hpp"
 
+#include <pybind11/stl.h>
+
 #include "Elite/RemoteUpgrade.hpp"
+#include "GilSafeObject.hpp"
+#include "Sha256.hpp"
+#include "UpgradeOrchestrator.hpp"
 
 namespace py = pybind11;
 
+static void bindUpgradeOrchestrator(py::module_& m) {
+    py::enum_<UpgradeState>(m, "UpgradeState", py::arithmetic())
+        .value("QUEUED", UpgradeState::QUEUED)
+        .value("UPGRADING", UpgradeState::UPGRADING)
+        .value("SUCCEEDED", UpgradeState::SUCCEEDED)
+        .value("FAILED", UpgradeState::FAILED)
+        .value("CANCELLED", UpgradeState::CANCELLED)
+        .export_values();
+
+    py::class_<UpgradeOrchestrator, GilReleasingPtr<UpgradeOrchestrator>>(
+        m, "UpgradeOrchestrator",
+        "Upgrade the control software of many robots in parallel with one package, hashed once.")
+        .def(py::init<>())
+        .def("setConcurrency", &UpgradeOrchestrator::setConcurrency, py::arg("concurrency"),
+             "Set the largest number of robots upgraded at once. Default 4.")
+        .def("getConcurrency", &UpgradeOrchestrator::getConcurrency)
+        .def("setExpectedDigest", &UpgradeOrchestrator::setExpectedDigest, py::arg("sha256"),
+             "Refuse to start when the package SHA-256 (hex) differs. An empty string disables the check.")
+        .def(
+            "start",
+            [](UpgradeOrchestrator& self, const std::string& file,
+               const std::vector<std::pair<std::string, std::string>>& targets) {
+                std::vector<UpgradeOrchestrator::Target> list;
+                list.reserve(targets.size());
+                for (const auto& t : targets) {
+                    list.push_back({t.first, t.second});
+                }
+                py::gil_scoped_release release;
+                return self.start(file, list);
+            },
+            py::arg("file"), py::arg("targets"),
+            R"doc(
+                Hash the package and start upgrading the robots in the background. The GIL is released while hashing.
+
+                Args:
+                    file (str): Upgrade package
+                    targets (list[tuple[str, str]]): (ip, ssh password) of each robot
+                Returns:
+                    str: Hex SHA-256 of the package
+                Raises:
+                    RuntimeError: An upgrade is running, the package cannot be read or its digest is not the expected one
+            )doc")
+        .def("cancel", &UpgradeOrchestrator::cancel,
+             "Cancel the queued robots. Upgrades in progress cannot be interrupted and finish.")
+        .def("wait", &UpgradeOrchestrator::wait, py::arg("timeout_ms") = 0, py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+                Wait for the end of the run, with the GIL released.
+
+                Args:
+                    timeout_ms (int): Timeout in milliseconds, <= 0 waits forever
+                Returns:
+                    bool: True if the run is over
+            )doc")
+        .def("isRunning", &UpgradeOrchestrator::isRunning)
+        .def(
+            "pollEvents",
+            [](UpgradeOrchestrator& self, size_t max_events, int timeout_ms) {
+                std::vector<UpgradeOrchestrator::Event> events;
+                {
+                    py::gil_scoped_release release;
+                    self.pollEvents(events, max_events, timeout_ms);
+                }
+                py::list out(events.size());
+                for (size_t i = 0; i < events.size(); ++i) {
+                    const auto& e = events[i];
+                    out[i] = py::make_tuple(e.target, e.ip, e.state, e.timestamp, e.message);
+                }
+                return out;
+            },
+            py::arg("max_events") = 0, py::arg("timeout_ms") = 0,
+            R"doc(
+                Take the queued state changes as one batch. The GIL is released while waiting.
+
+                Args:
+                    max_events (int): Largest number of events, 0 for all
+                    timeout_ms (int): Time to wait for a first event, 0 returns at once, < 0 waits forever.
+                        Returns early when the run is over.
+                Returns:
+                    list[tuple[int, str, UpgradeState, float, str]]: (target index, ip, state, time.monotonic()
+                        timestamp, message) of each event
+            )doc")
+        .def("getStates", &UpgradeOrchestrator::states, "State of each robot of the last run.")
+        .def("getDigest", &UpgradeOrchestrator::digest, "Hex SHA-256 of the package of the last run.");
+
+    m.def(
+        "sha256File",
+        [](const std::string& path) {
+            Sha256::Digest digest;
+            bool ok;
+            {
+                py::gil_scoped_release release;
+                ok = Sha256::hashFile(path, digest);
+            }
+            if (!ok) {
+                throw std::runtime_error("Cannot read " + path);
+            }
+            return Sha256::toHex(digest);
+        },
+        py::arg("path"), "Hex SHA-256 of a file, memory-mapped and computed with the GIL released.");
+}
 
 void bindRemoteUpgrade(py::module_& m) {
     m.def("upgradeControlSoftware", &ELITE::UPGRADE::upgradeControlSoftware, py::arg("ip"), py::arg("file"), py::arg("password"),
+        py::call_guard<py::gil_scoped_release>(),
         R"doc(
-            Upgrade the robot control software
+            Upgrade the robot control software. The GIL is released during the upgrade.
 
             Args:
                 ip (str): Robot ip
@@ -24,4 +130,6 @@ void bindRemoteUpgrade(py::module_& m) {
                 2. In Windows, if libssh is not installed, then this interface will not be available.
         )doc"
     );
-}
\ No newline at end of file
+
+    bindUpgradeOrchestrator(m);
+}
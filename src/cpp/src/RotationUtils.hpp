@@ -0,0 +1,189 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+// Rotation helpers shared by the native math modules.
+// Matrices are 3x3 row-major, rotation vectors use the controller's [rx, ry, rz] axis-angle convention.
+
+constexpr double ROTATION_PI = 3.14159265358979323846;
+
+/**
+ * @brief Convert a rotation vector to a rotation matrix (Rodrigues formula).
+ */
+inline void rotvecToMatrix(const double* rv, double* R) {
+    const double angle = std::sqrt(rv[0] * rv[0] + rv[1] * rv[1] + rv[2] * rv[2]);
+    if (angle < 1e-12) {
+        R[0] = 1.0, R[1] = -rv[2], R[2] = rv[1];
+        R[3] = rv[2], R[4] = 1.0, R[5] = -rv[0];
+        R[6] = -rv[1], R[7] = rv[0], R[8] = 1.0;
+        return;
+    }
+    const double x = rv[0] / angle, y = rv[1] / angle, z = rv[2] / angle;
+    const double c = std::cos(angle), s = std::sin(angle), t = 1.0 - c;
+    R[0] = t * x * x + c;
+    R[1] = t * x * y - s * z;
+    R[2] = t * x * z + s * y;
+    R[3] = t * x * y + s * z;
+    R[4] = t * y * y + c;
+    R[5] = t * y * z - s * x;
+    R[6] = t * x * z - s * y;
+    R[7] = t * y * z + s * x;
+    R[8] = t * z * z + c;
+}
+
+/**
+ * @brief Convert a rotation matrix to a rotation vector. The angle is in [0, pi].
+ */
+inline void matrixToRotvec(const double* R, double* rv) {
+    const double cos_angle = std::min(1.0, std::max(-1.0, (R[0] + R[4] + R[8] - 1.0) * 0.5));
+    const double angle = std::acos(cos_angle);
+    const double ax = R[7] - R[5], ay = R[2] - R[6], az = R[3] - R[1];
+
+    if (angle < 1e-7) {
+        rv[0] = 0.5 * ax, rv[1] = 0.5 * ay, rv[2] = 0.5 * az;
+        return;
+    }
+    if (angle < ROTATION_PI - 1e-4) {
+        const double k = angle / (2.0 * std::sin(angle));
+        rv[0] = k * ax, rv[1] = k * ay, rv[2] = k * az;
+        return;
+    }
+
+    // Close to pi the antisymmetric part vanishes, recover the axis from the symmetric part instead.
+    const double one_minus_cos = 1.0 - cos_angle;
+    const double bxx = (R[0] - cos_angle) / one_minus_cos;
+    const double byy = (R[4] - cos_angle) / one_minus_cos;
+    const double bzz = (R[8] - cos_angle) / one_minus_cos;
+    const double bxy = (R[1] + R[3]) * 0.5 / one_minus_cos;
+    const double bxz = (R[2] + R[6]) * 0.5 / one_minus_cos;
+    const double byz = (R[5] + R[7]) * 0.5 / one_minus_cos;
+    double x, y, z;
+    if (bxx >= byy && bxx >= bzz) {
+        x = std::sqrt(std::max(0.0, bxx));
+        y = bxy / x;
+        z = bxz / x;
+    } else if (byy >= bzz) {
+        y = std::sqrt(std::max(0.0, byy));
+        x = bxy / y;
+        z = byz / y;
+    } else {
+        z = std::sqrt(std::max(0.0, bzz));
+        x = bxz / z;
+        y = byz / z;
+    }
+    if (x * ax + y * ay + z * az < 0.0) {
+        x = -x, y = -y, z = -z;
+    }
+    const double norm = std::sqrt(x * x + y * y + z * z);
+    rv[0] = angle * x / norm, rv[1] = angle * y / norm, rv[2] = angle * z / norm;
+}
+
+/**
+ * @brief C = A * B for 3x3 row-major matrices. C must not alias A or B.
+ */
+inline void matMul3(const double* A, const double* B, double* C) {
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            C[r * 3 + c] = A[r * 3] * B[c] + A[r * 3 + 1] * B[3 + c] + A[r * 3 + 2] * B[6 + c];
+        }
+    }
+}
+
+// Quaternions are [w, x, y, z]. Conversions to quaternions return w >= 0.
+
+/**
+ * @brief Convert a rotation vector to a unit quaternion.
+ */
+inline void rotvecToQuat(const double* rv, double* q) {
+    const double angle = std::sqrt(rv[0] * rv[0] + rv[1] * rv[1] + rv[2] * rv[2]);
+    // sin(angle / 2) / angle, with its Taylor expansion near 0
+    const double k = angle < 1e-6 ? 0.5 - angle * angle / 48.0 : std::sin(angle * 0.5) / angle;
+    q[0] = std::cos(angle * 0.5), q[1] = k * rv[0], q[2] = k * rv[1], q[3] = k * rv[2];
+}
+
+/**
+ * @brief Convert a quaternion, not necessarily normalized, to a rotation vector. The angle is in [0, pi].
+ */
+inline void quatToRotvec(const double* q, double* rv) {
+    const double s = q[0] < 0.0 ? -1.0 : 1.0;
+    const double w = s * q[0], x = s * q[1], y = s * q[2], z = s * q[3];
+    const double v = std::sqrt(x * x + y * y + z * z);
+    const double angle = 2.0 * std::atan2(v, w);
+    const double k = v < 1e-12 ? 2.0 / std::max(w, 1e-300) : angle / v;
+    rv[0] = k * x, rv[1] = k * y, rv[2] = k * z;
+}
+
+/**
+ * @brief Convert a unit quaternion to a rotation matrix.
+ */
+inline void quatToMatrix(const double* q, double* R) {
+    const double w = q[0], x = q[1], y = q[2], z = q[3];
+    R[0] = 1.0 - 2.0 * (y * y + z * z), R[1] = 2.0 * (x * y - w * z), R[2] = 2.0 * (x * z + w * y);
+    R[3] = 2.0 * (x * y + w * z), R[4] = 1.0 - 2.0 * (x * x + z * z), R[5] = 2.0 * (y * z - w * x);
+    R[6] = 2.0 * (x * z - w * y), R[7] = 2.0 * (y * z + w * x), R[8] = 1.0 - 2.0 * (x * x + y * y);
+}
+
+/**
+ * @brief Convert a rotation matrix to a unit quaternion (Shepperd's method).
+ */
+inline void matrixToQuat(const double* R, double* q) {
+    const double trace = R[0] + R[4] + R[8];
+    double w, x, y, z;
+    if (trace > R[0] && trace > R[4] && trace > R[8]) {
+        const double s = 2.0 * std::sqrt(1.0 + trace);
+        w = 0.25 * s, x = (R[7] - R[5]) / s, y = (R[2] - R[6]) / s, z = (R[3] - R[1]) / s;
+    } else if (R[0] > R[4] && R[0] > R[8]) {
+        const double s = 2.0 * std::sqrt(1.0 + R[0] - R[4] - R[8]);
+        w = (R[7] - R[5]) / s, x = 0.25 * s, y = (R[1] + R[3]) / s, z = (R[2] + R[6]) / s;
+    } else if (R[4] > R[8]) {
+        const double s = 2.0 * std::sqrt(1.0 + R[4] - R[0] - R[8]);
+        w = (R[2] - R[6]) / s, x = (R[1] + R[3]) / s, y = 0.25 * s, z = (R[5] + R[7]) / s;
+    } else {
+        const double s = 2.0 * std::sqrt(1.0 + R[8] - R[0] - R[4]);
+        w = (R[3] - R[1]) / s, x = (R[2] + R[6]) / s, y = (R[5] + R[7]) / s, z = 0.25 * s;
+    }
+    const double sign = w < 0.0 ? -1.0 : 1.0;
+    const double norm = sign / std::sqrt(w * w + x * x + y * y + z * z);
+    q[0] = w * norm, q[1] = x * norm, q[2] = y * norm, q[3] = z * norm;
+}
+
+/**
+ * @brief c = a * b. c may alias a or b.
+ */
+inline void quatMul(const double* a, const double* b, double* c) {
+    const double w = a[0] * b[0] - a[1] * b[1] - a[2] * b[2] - a[3] * b[3];
+    const double x = a[0] * b[1] + a[1] * b[0] + a[2] * b[3] - a[3] * b[2];
+    const double y = a[0] * b[2] - a[1] * b[3] + a[2] * b[0] + a[3] * b[1];
+    const double z = a[0] * b[3] + a[1] * b[2] - a[2] * b[1] + a[3] * b[0];
+    c[0] = w, c[1] = x, c[2] = y, c[3] = z;
+}
+
+/**
+ * @brief Spherical linear interpolation between unit quaternions along the shorter arc. out may alias a or b.
+ */
+inline void quatSlerp(const double* a, const double* b, double t, double* out) {
+    double dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+    const double sign = dot < 0.0 ? -1.0 : 1.0;
+    dot *= sign;
+    double ka, kb;
+    if (dot > 0.9995) {
+        // Nearly parallel: normalized linear interpolation avoids dividing by sin(angle) ~ 0
+        ka = 1.0 - t, kb = t;
+    } else {
+        const double angle = std::acos(dot);
+        const double inv_sin = 1.0 / std::sin(angle);
+        ka = std::sin((1.0 - t) * angle) * inv_sin, kb = std::sin(t * angle) * inv_sin;
+    }
+    kb *= sign;
+    double q[4];
+    for (int i = 0; i < 4; ++i) {
+        q[i] = ka * a[i] + kb * b[i];
+    }
+    const double norm = 1.0 / std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    for (int i = 0; i < 4; ++i) {
+        out[i] = q[i] * norm;
+    }
+}
@@ -0,0 +1,347 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "RtToolkit.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <thread>
+
+#if defined(__linux__)
+#include <alloca.h>
+#include <fcntl.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+
+namespace {
+
+// Not exported by every libc
+struct SchedAttr {
+    uint32_t size;
+    uint32_t sched_policy;
+    uint64_t sched_flags;
+    int32_t sched_nice;
+    uint32_t sched_priority;
+    uint64_t sched_runtime;
+    uint64_t sched_deadline;
+    uint64_t sched_period;
+};
+
+constexpr uint32_t SCHED_DEADLINE_POLICY = 6;
+
+pid_t resolveTid(int tid) { return tid > 0 ? static_cast<pid_t>(tid) : static_cast<pid_t>(::syscall(SYS_gettid)); }
+
+// Stack left unprefaulted below the touched area, for the frames of the prefault itself and of signal handlers
+constexpr size_t STACK_MARGIN = 64 * 1024;
+
+// Bytes of stack the calling thread can still grow by, below the current frame. 0 if unknown.
+size_t stackHeadroom() {
+    const auto here = reinterpret_cast<uintptr_t>(__builtin_frame_address(0));
+    pthread_attr_t attr;
+    if (::pthread_getattr_np(::pthread_self(), &attr) == 0) {
+        void* base = nullptr;
+        size_t size = 0;
+        const bool ok = ::pthread_attr_getstack(&attr, &base, &size) == 0;
+        ::pthread_attr_destroy(&attr);
+        const auto low = reinterpret_cast<uintptr_t>(base);
+        if (ok && here > low && here - low <= size) {
+            return here - low;
+        }
+    }
+    rlimit limit{};
+    if (::getrlimit(RLIMIT_STACK, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY) {
+        // Upper bound only: the part of the stack already used is unknown
+        return static_cast<size_t>(limit.rlim_cur);
+    }
+    return 0;
+}
+
+// Touch `size` bytes of stack below the caller, clamped to what the stack can hold. Not inlined, so the array lives in
+// its own frame.
+__attribute__((noinline)) void prefaultStack(size_t size) {
+    const size_t headroom = stackHeadroom();
+    if (headroom <= STACK_MARGIN) {
+        return;
+    }
+    size = std::min(size, headroom - STACK_MARGIN);
+    const long page = ::sysconf(_SC_PAGESIZE);
+    auto* stack = static_cast<volatile uint8_t*>(alloca(size));
+    for (size_t i = 0; i < size; i += static_cast<size_t>(page)) {
+        stack[i] = 0;
+    }
+}
+
+void prefaultHeap(size_t size) {
+    const long page = ::sysconf(_SC_PAGESIZE);
+    auto* heap = static_cast<volatile uint8_t*>(std::malloc(size));
+    if (heap == nullptr) {
+        return;
+    }
+    for (size_t i = 0; i < size; i += static_cast<size_t>(page)) {
+        heap[i] = 0;
+    }
+    std::free(const_cast<uint8_t*>(heap));
+}
+
+std::string commPath(int tid) { return "/proc/self/task/" + std::to_string(resolveTid(tid)) + "/comm"; }
+
+int64_t timespecNs(const timespec& ts) { return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec; }
+
+}  // namespace
+
+bool lockProcessMemory(size_t stack_prefault, size_t heap_prefault, bool tune_allocator) {
+    if (::mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+        // The allocator keeps its defaults: holding freed memory only pays off when it is locked
+        return false;
+    }
+    if (tune_allocator) {
+        // Freed blocks stay in the heap, and large blocks come from the heap rather than from fresh mmap pages
+        ::mallopt(M_TRIM_THRESHOLD, -1);
+        ::mallopt(M_MMAP_MAX, 0);
+    }
+    if (stack_prefault > 0) {
+        prefaultStack(stack_prefault);
+    }
+    if (heap_prefault > 0) {
+        prefaultHeap(heap_prefault);
+    }
+    return true;
+}
+
+uint64_t lockedMemoryBytes() {
+    std::FILE* f = std::fopen("/proc/self/status", "r");
+    if (f == nullptr) {
+        return 0;
+    }
+    char line[256];
+    uint64_t kb = 0;
+    while (std::fgets(line, sizeof(line), f) != nullptr) {
+        if (std::strncmp(line, "VmLck:", 6) == 0) {
+            kb = std::strtoull(line + 6, nullptr, 10);
+            break;
+        }
+    }
+    std::fclose(f);
+    return kb * 1024;
+}
+
+bool setThreadAffinity(int tid, const std::vector<int>& cpus) {
+    if (cpus.empty()) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        if (cpu < 0 || cpu >= CPU_SETSIZE) {
+            return false;
+        }
+        CPU_SET(cpu, &set);
+    }
+    return ::sched_setaffinity(resolveTid(tid), sizeof(set), &set) == 0;
+}
+
+std::vector<int> getThreadAffinity(int tid) {
+    std::vector<int> cpus;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (::sched_getaffinity(resolveTid(tid), sizeof(set), &set) != 0) {
+        return cpus;
+    }
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &set)) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+bool setThreadScheduling(int tid, int policy, int priority) {
+    const pid_t target = resolveTid(tid);
+    sched_param param{};
+    const bool realtime = policy == SCHED_FIFO || policy == SCHED_RR;
+    param.sched_priority = realtime ? priority : 0;
+    // On Linux sched_setscheduler() applies to the single thread `target`, not to the whole process
+    if (::sched_setscheduler(target, policy, &param) != 0) {
+        return false;
+    }
+    return realtime || ::setpriority(PRIO_PROCESS, static_cast<id_t>(target), priority) == 0;
+}
+
+bool getThreadScheduling(int tid, int& policy, int& priority) {
+    const pid_t target = resolveTid(tid);
+    policy = ::sched_getscheduler(target);
+    if (policy < 0) {
+        return false;
+    }
+    if (policy == SCHED_FIFO || policy == SCHED_RR) {
+        sched_param param{};
+        if (::sched_getparam(target, &param) != 0) {
+            return false;
+        }
+        priority = param.sched_priority;
+        return true;
+    }
+    errno = 0;
+    priority = ::getpriority(PRIO_PROCESS, static_cast<id_t>(target));
+    return errno == 0;
+}
+
+bool setThreadName(int tid, const std::string& name) {
+    // pthread_setname_np() needs a pthread_t, which only the creator of the thread has
+    std::FILE* f = std::fopen(commPath(tid).c_str(), "w");
+    if (f == nullptr) {
+        return false;
+    }
+    const std::string comm = name.substr(0, 15);
+    const bool ok = std::fputs(comm.c_str(), f) >= 0;
+    return std::fclose(f) == 0 && ok;
+}
+
+std::string getThreadName(int tid) {
+    std::FILE* f = std::fopen(commPath(tid).c_str(), "r");
+    if (f == nullptr) {
+        return std::string();
+    }
+    char line[64] = {0};
+    std::string name;
+    if (std::fgets(line, sizeof(line), f) != nullptr) {
+        name = line;
+        if (!name.empty() && name.back() == '\n') {
+            name.pop_back();
+        }
+    }
+    std::fclose(f);
+    return name;
+}
+
+bool setThreadDeadlineScheduling(int tid, uint64_t runtime_ns, uint64_t deadline_ns, uint64_t period_ns) {
+    if (runtime_ns == 0 || runtime_ns > deadline_ns || (period_ns != 0 && deadline_ns > period_ns)) {
+        return false;
+    }
+    SchedAttr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.sched_policy = SCHED_DEADLINE_POLICY;
+    attr.sched_runtime = runtime_ns;
+    attr.sched_deadline = deadline_ns;
+    attr.sched_period = period_ns;
+    return ::syscall(SYS_sched_setattr, resolveTid(tid), &attr, 0) == 0;
+}
+
+CpuDmaLatencyHold::CpuDmaLatencyHold(int32_t latency_us) : latency_us_(latency_us) {
+    fd_ = ::open("/dev/cpu_dma_latency", O_WRONLY | O_CLOEXEC);
+    if (fd_ < 0) {
+        return;
+    }
+    // The request is active as long as the file stays open
+    if (::write(fd_, &latency_us_, sizeof(latency_us_)) != static_cast<ssize_t>(sizeof(latency_us_))) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+void CpuDmaLatencyHold::release() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+LatencyProbeResult runLatencyProbe(int cpu, int priority, int interval_us, int duration_ms, int histogram_us) {
+    LatencyProbeResult result;
+    result.cpu = cpu;
+    result.histogram.assign(static_cast<size_t>(std::max(histogram_us, 1)), 0);
+    interval_us = std::max(interval_us, 1);
+
+    std::thread probe([&] {
+        if (cpu >= 0) {
+            setThreadAffinity(0, {cpu});
+        }
+        if (priority > 0) {
+            sched_param param{};
+            param.sched_priority = priority;
+            result.realtime = ::pthread_setschedparam(::pthread_self(), SCHED_FIFO, &param) == 0;
+        }
+
+        const int64_t interval_ns = static_cast<int64_t>(interval_us) * 1000;
+        timespec now;
+        ::clock_gettime(CLOCK_MONOTONIC, &now);
+        int64_t next = timespecNs(now) + interval_ns;
+        const int64_t end = timespecNs(now) + static_cast<int64_t>(duration_ms) * 1000000;
+        int64_t min_ns = std::numeric_limits<int64_t>::max();
+        int64_t max_ns = 0;
+        int64_t sum_ns = 0;
+        while (next < end) {
+            timespec target{static_cast<time_t>(next / 1000000000), static_cast<long>(next % 1000000000)};
+            ::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, nullptr);
+            ::clock_gettime(CLOCK_MONOTONIC, &now);
+            const int64_t latency = std::max<int64_t>(timespecNs(now) - next, 0);
+            min_ns = std::min(min_ns, latency);
+            max_ns = std::max(max_ns, latency);
+            sum_ns += latency;
+            const auto bin = static_cast<size_t>(latency / 1000);
+            if (bin < result.histogram.size()) {
+                ++result.histogram[bin];
+            } else {
+                ++result.overflows;
+            }
+            ++result.samples;
+            next += interval_ns;
+        }
+        if (result.samples > 0) {
+            result.min_us = min_ns / 1000.0;
+            result.max_us = max_ns / 1000.0;
+            result.avg_us = static_cast<double>(sum_ns) / static_cast<double>(result.samples) / 1000.0;
+        }
+    });
+    probe.join();
+    return result;
+}
+
+#else
+
+bool lockProcessMemory(size_t, size_t, bool) { return false; }
+
+uint64_t lockedMemoryBytes() { return 0; }
+
+bool setThreadAffinity(int, const std::vector<int>&) { return false; }
+
+std::vector<int> getThreadAffinity(int) { return {}; }
+
+bool setThreadScheduling(int, int, int) { return false; }
+
+bool getThreadScheduling(int, int&, int&) { return false; }
+
+bool setThreadName(int, const std::string&) { return false; }
+
+std::string getThreadName(int) { return std::string(); }
+
+bool setThreadDeadlineScheduling(int, uint64_t, uint64_t, uint64_t) { return false; }
+
+CpuDmaLatencyHold::CpuDmaLatencyHold(int32_t latency_us) : latency_us_(latency_us) {}
+
+void CpuDmaLatencyHold::release() { fd_ = -1; }
+
+LatencyProbeResult runLatencyProbe(int cpu, int, int, int, int histogram_us) {
+    LatencyProbeResult result;
+    result.cpu = cpu;
+    result.histogram.assign(static_cast<size_t>(std::max(histogram_us, 1)), 0);
+    return result;
+}
+
+#endif
+
+CpuDmaLatencyHold::~CpuDmaLatencyHold() { release(); }
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Process and thread preparation for real-time loops. Linux only: on other platforms the functions fail (return
+// false or an empty result) without side effects. A `tid` of 0 designates the calling thread.
+
+/**
+ * @brief Lock the process memory (mlockall current and future pages) and prefault it.
+ *
+ * @param stack_prefault Bytes of the calling thread stack touched, so that its pages are resident. Clamped to the
+ * stack the thread has left, minus a margin.
+ * @param heap_prefault Bytes allocated, touched and freed to grow the heap ahead of time
+ * @param tune_allocator Keep freed memory in the heap (no trimming, no mmap for large blocks), so that later
+ * allocations, including the Python allocator arenas, reuse locked pages instead of faulting new ones. Only applied
+ * once the memory is locked.
+ * @return false if mlockall failed (usually missing CAP_IPC_LOCK or a low RLIMIT_MEMLOCK), nothing is changed then
+ */
+bool lockProcessMemory(size_t stack_prefault, size_t heap_prefault, bool tune_allocator);
+
+/**
+ * @brief Bytes of locked memory of the process (VmLck), 0 if unknown.
+ */
+uint64_t lockedMemoryBytes();
+
+/**
+ * @brief Restrict a thread to a set of CPUs.
+ */
+bool setThreadAffinity(int tid, const std::vector<int>& cpus);
+
+/**
+ * @brief CPUs a thread may run on, empty on failure.
+ */
+std::vector<int> getThreadAffinity(int tid);
+
+/**
+ * @brief Set the scheduling policy (SCHED_OTHER, SCHED_FIFO, ...) and the priority of a thread. The priority is the
+ * real-time priority for FIFO and RR, and the nice value for the other policies.
+ */
+bool setThreadScheduling(int tid, int policy, int priority);
+
+/**
+ * @brief Scheduling policy and priority of a thread, as set by setThreadScheduling(). false on failure.
+ */
+bool getThreadScheduling(int tid, int& policy, int& priority);
+
+/**
+ * @brief Set the name of a thread, truncated to 15 characters (the kernel limit).
+ */
+bool setThreadName(int tid, const std::string& name);
+
+/**
+ * @brief Name of a thread, empty on failure.
+ */
+std::string getThreadName(int tid);
+
+/**
+ * @brief Run a thread with SCHED_DEADLINE: `runtime_ns` of CPU every `period_ns`, finished within `deadline_ns`.
+ */
+bool setThreadDeadlineScheduling(int tid, uint64_t runtime_ns, uint64_t deadline_ns, uint64_t period_ns);
+
+/**
+ * @brief Hold a maximum CPU wake-up latency through /dev/cpu_dma_latency, which keeps the CPUs out of deep idle
+ * states. The request lasts until release() or destruction.
+ */
+class CpuDmaLatencyHold {
+   public:
+    explicit CpuDmaLatencyHold(int32_t latency_us);
+    ~CpuDmaLatencyHold();
+
+    CpuDmaLatencyHold(const CpuDmaLatencyHold&) = delete;
+    CpuDmaLatencyHold& operator=(const CpuDmaLatencyHold&) = delete;
+
+    bool isHeld() const { return fd_ >= 0; }
+    int32_t latency() const { return latency_us_; }
+    void release();
+
+   private:
+    int fd_ = -1;
+    int32_t latency_us_;
+};
+
+/**
+ * @brief Result of a wake-up latency measurement.
+ */
+struct LatencyProbeResult {
+    int cpu = -1;
+    bool realtime = false;  // The probe thread got the requested FIFO priority
+    uint64_t samples = 0;
+    double min_us = 0.0;
+    double avg_us = 0.0;
+    double max_us = 0.0;
+    std::vector<uint64_t> histogram;  // histogram[i]: samples with a latency in [i, i + 1) us
+    uint64_t overflows = 0;           // Samples beyond the histogram
+};
+
+/**
+ * @brief Measure the timer wake-up latency of a core, like cyclictest: a thread pinned to `cpu` sleeps until
+ * absolute deadlines `interval_us` apart and records how late it wakes up.
+ *
+ * @param cpu Core to measure, < 0 for no pinning
+ * @param priority SCHED_FIFO priority of the probe thread, <= 0 keeps the default policy
+ * @param interval_us Period of the wake-ups
+ * @param duration_ms Length of the measurement
+ * @param histogram_us Number of 1 us histogram bins
+ */
+LatencyProbeResult runLatencyProbe(int cpu, int priority, int interval_us, int duration_ms, int histogram_us);
@@ -1,7 +1,10 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2025, Elite Robots.
 #include "RtUtilsWrapper.hpp"
+#include "RtToolkit.hpp"
 #include <Elite/RtUtils.hpp>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
 #include <thread>
 
 #ifdef _WIN32
@@ -31,6 +34,104 @@ bool bindCurrentThreadToCpus(int cpu) {
     return RT_UTILS::bindThreadToCpus(handle, cpu);
 }
 
+static void bindRtToolkit(py::module_& m) {
+    m.def("lockMemory", &lockProcessMemory, py::arg("stack_prefault") = 512 * 1024, py::arg("heap_prefault") = 0,
+          py::arg("tune_allocator") = true, py::call_guard<py::gil_scoped_release>(),
+          R"doc(
+            Lock the process memory (mlockall of current and future pages) and prefault it, so that the real-time
+            loop does not take page faults.
+
+            Args:
+                stack_prefault(int): Bytes of the calling thread stack to make resident, clamped to the stack the
+                    thread has left minus a margin
+                heap_prefault(int): Bytes allocated, touched and freed to grow the heap ahead of time
+                tune_allocator(bool): Keep freed memory in the heap instead of returning it to the system, so that
+                    later allocations reuse locked pages. Only applied once the memory is locked
+
+            Returns:
+                bool: True is success. Requires CAP_IPC_LOCK or a sufficient RLIMIT_MEMLOCK. On failure nothing is
+                changed.
+        )doc");
+    m.def("getLockedMemory", &lockedMemoryBytes, "Bytes of locked memory of the process (VmLck), 0 if unknown.");
+    m.def("setCpuAffinity", &setThreadAffinity, py::arg("cpus"), py::arg("tid") = 0,
+          R"doc(
+            Restrict a thread to a set of CPU cores.
+
+            Args:
+                cpus(list[int]): Core indexes
+                tid(int): Native thread ID (threading.get_native_id()), 0 for the current thread
+
+            Returns:
+                bool: True is success
+        )doc");
+    m.def("getCpuAffinity", &getThreadAffinity, py::arg("tid") = 0,
+          "Cores a thread may run on, 0 for the current thread. Empty on failure.");
+    m.def("setCurrentThreadDeadlineScheduling",
+          [](uint64_t runtime_ns, uint64_t deadline_ns, uint64_t period_ns) {
+              return setThreadDeadlineScheduling(0, runtime_ns, deadline_ns, period_ns);
+          },
+          py::arg("runtime_ns"), py::arg("deadline_ns"), py::arg("period_ns"),
+          R"doc(
+            Set current thread to SCHED_DEADLINE: it gets `runtime_ns` of CPU time every `period_ns`, completed
+            within `deadline_ns` of the period start. A deadline thread cannot create threads.
+
+            Args:
+                runtime_ns(int): Budget per period
+                deadline_ns(int): Relative deadline, runtime_ns <= deadline_ns <= period_ns
+                period_ns(int): Period
+
+            Returns:
+                bool: True is success
+        )doc");
+
+    py::class_<CpuDmaLatencyHold>(m, "CpuDmaLatency",
+                                  "Hold a maximum CPU wake-up latency through /dev/cpu_dma_latency. Use as a context "
+                                  "manager, or keep the object alive for as long as the request must last.")
+        .def(py::init<int32_t>(), py::arg("latency_us") = 0)
+        .def("isHeld", &CpuDmaLatencyHold::isHeld, "True if the request is active.")
+        .def("latency", &CpuDmaLatencyHold::latency, "Requested latency in microseconds.")
+        .def("release", &CpuDmaLatencyHold::release, "Drop the request.")
+        .def("__enter__", [](CpuDmaLatencyHold& self) -> CpuDmaLatencyHold& { return self; })
+        .def("__exit__", [](CpuDmaLatencyHold& self, py::args) { self.release(); });
+
+    py::class_<LatencyProbeResult>(m, "LatencyProbeResult")
+        .def_readonly("cpu", &LatencyProbeResult::cpu)
+        .def_readonly("realtime", &LatencyProbeResult::realtime)
+        .def_readonly("samples", &LatencyProbeResult::samples)
+        .def_readonly("min_us", &LatencyProbeResult::min_us)
+        .def_readonly("avg_us", &LatencyProbeResult::avg_us)
+        .def_readonly("max_us", &LatencyProbeResult::max_us)
+        .def_readonly("overflows", &LatencyProbeResult::overflows)
+        .def_property_readonly("histogram",
+                               [](const LatencyProbeResult& r) {
+                                   return py::array_t<uint64_t>(static_cast<py::ssize_t>(r.histogram.size()),
+                                                                r.histogram.data());
+                               })
+        .def("__repr__", [](const LatencyProbeResult& r) {
+            return py::str("<LatencyProbeResult cpu={} samples={} min={:.1f}us avg={:.1f}us max={:.1f}us>")
+                .format(r.cpu, r.samples, r.min_us, r.avg_us, r.max_us);
+        });
+
+    m.def("runLatencyProbe", &runLatencyProbe, py::arg("cpu"), py::arg("priority") = 80,
+          py::arg("interval_us") = 1000, py::arg("duration_ms") = 5000, py::arg("histogram_us") = 1000,
+          py::call_guard<py::gil_scoped_release>(),
+          R"doc(
+            Measure the timer wake-up latency of a core, like cyclictest, before running a real-time loop on it.
+            A probe thread pinned to `cpu` sleeps until absolute deadlines and records how late it wakes up.
+            The GIL is released during the measurement.
+
+            Args:
+                cpu(int): Core to measure, < 0 for no pinning
+                priority(int): SCHED_FIFO priority of the probe thread, <= 0 keeps the default policy
+                interval_us(int): Wake-up period
+                duration_ms(int): Length of the measurement
+                histogram_us(int): Number of 1 us histogram bins
+
+            Returns:
+                LatencyProbeResult: Minimum, average and maximum latency, and the latency histogram
+        )doc");
+}
+
 void bindRtUtils(py::module_& m) {
     m.def("setCurrentThreadFiFoScheduling", &setCurrentThreadFiFoScheduling, py::arg("priority"),
           R"doc(
@@ -59,4 +160,6 @@ void bindRtUtils(py::module_& m) {
             Returns:
                 bool: True is success
         )doc");
-}
\ No newline at end of file
+
+    bindRtToolkit(m);
+}
@@ -6,12 +6,22 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <memory>
+
+#include "SdkThreadsWrapper.hpp"
+
 namespace py = pybind11;
 using namespace ELITE;
 
 void bindRtsiIOInterface(pybind11::module_ &m) {
-    py::class_<RtsiIOInterface>(m, "RtsiIOInterface")
-        .def(py::init<const std::string &, const std::string &, double>(), py::arg("output_recipe_file"),
+    py::class_<RtsiIOInterface, SdkThreadsPtr<RtsiIOInterface>> rtsi(m, "RtsiIOInterface");
+    rtsi.def(py::init([](const std::string &output_recipe_file, const std::string &input_recipe_file, double frequency) {
+                 SdkThreadCapture capture("RtsiIOInterface");
+                 SdkThreadsPtr<RtsiIOInterface> self(new RtsiIOInterface(output_recipe_file, input_recipe_file, frequency));
+                 capture.commit(self.get(), true);
+                 return self;
+             }),
+             py::arg("output_recipe_file"),
              py::arg("input_recipe_file"), py::arg("frequency"),
              R"doc(
                 Construct a new Rtsi I O Interface object
@@ -21,7 +31,14 @@ void bindRtsiIOInterface(pybind11::module_ &m) {
                     input_recipe_file: Input recipe configuration file
                     frequency: Output frequency
              )doc")
-        .def(py::init<const std::vector<std::string>&, const std::vector<std::string>&, double>(), py::arg("output_recipe"),
+        .def(py::init([](const std::vector<std::string> &output_recipe, const std::vector<std::string> &input_recipe,
+                         double frequency) {
+                 SdkThreadCapture capture("RtsiIOInterface");
+                 SdkThreadsPtr<RtsiIOInterface> self(new RtsiIOInterface(output_recipe, input_recipe, frequency));
+                 capture.commit(self.get(), true);
+                 return self;
+             }),
+             py::arg("output_recipe"),
              py::arg("input_recipe"), py::arg("frequency"),
              R"doc(
                 Construct a new Rtsi I O Interface object
@@ -32,7 +49,16 @@ void bindRtsiIOInterface(pybind11::module_ &m) {
                     frequency: Output frequency
              )doc"
         )
-        .def("connect", &RtsiIOInterface::connect, py::arg("ip"),
+        .def(
+            "connect",
+            [](RtsiIOInterface &self, const std::string &ip) {
+                // The receive thread starts on connection
+                SdkThreadCapture capture("RtsiIOInterface");
+                const bool ok = self.connect(ip);
+                capture.commit(&self);
+                return ok;
+            },
+            py::arg("ip"),
              R"doc(
                 Connect to RTSI server
 
@@ -697,4 +723,5 @@ void bindRtsiIOInterface(pybind11::module_ &m) {
                 Returns:
                     object: The value of the variable.
             )doc");
-}
\ No newline at end of file
+    defThreadPolicyMethods(rtsi);
+}
@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+// Helpers shared by the objects that sample the robot or the host: host clock, RTSI sample reads and percentiles.
+
+// Reads of a sample restarted because a newer one arrived meanwhile, before the poll gives up until the next one
+constexpr int RTSI_READ_ATTEMPTS = 3;
+
+/**
+ * @brief Host steady clock in seconds, the time base of the samplers and of their Python timestamps.
+ */
+inline double steadyNow() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Read the fields of a new RTSI sample.
+ *
+ * A new sample is detected by its timestamp: RtsiIOInterface has no per-sample notification. Each getter locks on
+ * its own, so the timestamp is read again after `read`: if it changed, the fields mix two samples and are read again.
+ *
+ * @param last_timestamp Timestamp of the last sample read, updated on success
+ * @param timestamp Output timestamp of the sample
+ * @param read Copies the fields of the sample
+ * @return false if there is no new sample, or if no consistent read was made in RTSI_READ_ATTEMPTS attempts
+ */
+template <typename Rtsi, typename Read>
+bool readRtsiSample(Rtsi* rtsi, double& last_timestamp, double& timestamp, Read&& read) {
+    for (int attempt = 0; attempt < RTSI_READ_ATTEMPTS; ++attempt) {
+        timestamp = rtsi->getTimestamp();
+        if (timestamp == last_timestamp) {
+            return false;
+        }
+        read();
+        if (rtsi->getTimestamp() == timestamp) {
+            last_timestamp = timestamp;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Nearest-rank percentile of sorted, non-empty values. `p` is in [0, 1].
+ */
+inline double percentile(const std::vector<double>& sorted, double p) {
+    return sorted[static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5)];
+}
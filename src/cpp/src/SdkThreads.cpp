@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "SdkThreads.hpp"
+#include "RtToolkit.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+
+#if defined(__linux__)
+#include <dirent.h>
+#endif
+
+namespace {
+
+// Field 22 of /proc/self/task/<tid>/stat, 0 if the thread does not exist
+uint64_t threadStartTime(int tid) {
+#if defined(__linux__)
+    const std::string path = "/proc/self/task/" + std::to_string(tid) + "/stat";
+    std::FILE* f = std::fopen(path.c_str(), "r");
+    if (f == nullptr) {
+        return 0;
+    }
+    char line[1024] = {0};
+    const bool ok = std::fgets(line, sizeof(line), f) != nullptr;
+    std::fclose(f);
+    if (!ok) {
+        return 0;
+    }
+    // The name (field 2) may contain spaces and parentheses, the fields after the last ')' do not
+    const char* p = std::strrchr(line, ')');
+    if (p == nullptr) {
+        return 0;
+    }
+    ++p;
+    for (int field = 3; field < 22; ++field) {
+        p = std::strchr(p + 1, ' ');
+        if (p == nullptr) {
+            return 0;
+        }
+    }
+    return std::strtoull(p + 1, nullptr, 10);
+#else
+    (void)tid;
+    return 0;
+#endif
+}
+
+SdkThreadInfo describeThread(int tid, const std::string& owner) {
+    SdkThreadInfo info;
+    info.tid = tid;
+    info.owner = owner;
+    info.name = getThreadName(tid);
+    getThreadScheduling(tid, info.sched_policy, info.priority);
+    info.cpus = getThreadAffinity(tid);
+    return info;
+}
+
+}  // namespace
+
+SdkThreadRegistry& SdkThreadRegistry::instance() {
+    static SdkThreadRegistry registry;
+    return registry;
+}
+
+std::vector<int> SdkThreadRegistry::processThreads() {
+    std::vector<int> tids;
+#if defined(__linux__)
+    DIR* dir = ::opendir("/proc/self/task");
+    if (dir == nullptr) {
+        return tids;
+    }
+    while (dirent* entry = ::readdir(dir)) {
+        const int tid = std::atoi(entry->d_name);
+        if (tid > 0) {
+            tids.push_back(tid);
+        }
+    }
+    ::closedir(dir);
+    std::sort(tids.begin(), tids.end());
+#endif
+    return tids;
+}
+
+bool SdkThreadRegistry::applyPolicy(const ThreadPolicy& policy, int tid, size_t index) {
+    bool ok = true;
+    if (!policy.cpus.empty()) {
+        ok = setThreadAffinity(tid, policy.cpus) && ok;
+    }
+    if (policy.sched_policy != ThreadSchedPolicy::KEEP) {
+        ok = setThreadScheduling(tid, static_cast<int>(policy.sched_policy), policy.priority) && ok;
+    }
+    if (!policy.name.empty()) {
+        const std::string name = index == 0 ? policy.name : policy.name + "-" + std::to_string(index);
+        ok = setThreadName(tid, name) && ok;
+    }
+    return ok;
+}
+
+std::vector<SdkThreadRegistry::Thread> SdkThreadRegistry::liveThreads(const Entry& entry) {
+    std::vector<Thread> live;
+    for (const auto& t : entry.threads) {
+        if (threadStartTime(t.tid) == t.start_time) {
+            live.push_back(t);
+        }
+    }
+    return live;
+}
+
+void SdkThreadRegistry::reset(const void* owner, const std::string& kind) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry& entry = entries_[owner];
+    entry = Entry();
+    entry.kind = kind;
+}
+
+void SdkThreadRegistry::track(const void* owner, const std::string& kind, const std::vector<int>& tids) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry& entry = entries_[owner];
+    entry.kind = kind;
+    // Threads of a previous connection are gone, the names restart from the first live thread
+    entry.threads = liveThreads(entry);
+    for (int tid : tids) {
+        const uint64_t start = threadStartTime(tid);
+        if (start == 0) {
+            continue;
+        }
+        entry.threads.push_back(Thread{tid, start});
+        if (entry.has_policy) {
+            applyPolicy(entry.policy, tid, entry.threads.size() - 1);
+        }
+    }
+}
+
+void SdkThreadRegistry::untrack(const void* owner) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.erase(owner);
+}
+
+bool SdkThreadRegistry::setPolicy(const void* owner, const ThreadPolicy& policy) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry& entry = entries_[owner];
+    entry.policy = policy;
+    entry.has_policy = true;
+    entry.threads = liveThreads(entry);
+    bool ok = true;
+    for (size_t i = 0; i < entry.threads.size(); ++i) {
+        ok = applyPolicy(policy, entry.threads[i].tid, i) && ok;
+    }
+    return ok;
+}
+
+ThreadPolicy SdkThreadRegistry::policy(const void* owner) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(owner);
+    return it != entries_.end() ? it->second.policy : ThreadPolicy();
+}
+
+std::vector<SdkThreadInfo> SdkThreadRegistry::threads(const void* owner) const {
+    std::vector<SdkThreadInfo> out;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(owner);
+    if (it == entries_.end()) {
+        return out;
+    }
+    for (const auto& t : liveThreads(it->second)) {
+        out.push_back(describeThread(t.tid, it->second.kind));
+    }
+    return out;
+}
+
+std::vector<SdkThreadInfo> SdkThreadRegistry::allThreads(bool include_others) const {
+    std::map<int, std::string> owners;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& e : entries_) {
+            for (const auto& t : liveThreads(e.second)) {
+                owners[t.tid] = e.second.kind;
+            }
+        }
+    }
+    std::vector<SdkThreadInfo> out;
+    if (!include_others) {
+        for (const auto& o : owners) {
+            out.push_back(describeThread(o.first, o.second));
+        }
+        return out;
+    }
+    for (int tid : processThreads()) {
+        auto it = owners.find(tid);
+        out.push_back(describeThread(tid, it != owners.end() ? it->second : std::string()));
+    }
+    return out;
+}
+
+SdkThreadCapture::SdkThreadCapture(std::string kind)
+    : kind_(std::move(kind)), before_(SdkThreadRegistry::processThreads()) {}
+
+void SdkThreadCapture::commit(const void* owner, bool new_owner) {
+    const std::vector<int> after = SdkThreadRegistry::processThreads();
+    std::vector<int> started;
+    std::set_difference(after.begin(), after.end(), before_.begin(), before_.end(), std::back_inserter(started));
+    auto& registry = SdkThreadRegistry::instance();
+    if (new_owner) {
+        registry.reset(owner, kind_);
+    }
+    registry.track(owner, kind_, started);
+}
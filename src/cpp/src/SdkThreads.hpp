@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Scheduling class of a thread. The values are the Linux SCHED_* constants.
+ */
+enum class ThreadSchedPolicy : int {
+    KEEP = -1,  // Leave the scheduling class and priority unchanged
+    OTHER = 0,
+    FIFO = 1,
+    RR = 2,
+    BATCH = 3,
+    IDLE = 5,
+};
+
+/**
+ * @brief Placement and scheduling of the threads of one SDK object.
+ */
+struct ThreadPolicy {
+    std::vector<int> cpus;  // Allowed cores, empty keeps the affinity
+    ThreadSchedPolicy sched_policy = ThreadSchedPolicy::KEEP;
+    int priority = 0;  // Real-time priority for FIFO and RR, nice value otherwise
+    std::string name;  // Thread name, empty keeps the name. The second and next threads get "-1", "-2"... appended
+};
+
+/**
+ * @brief Live thread of the process as seen by the kernel.
+ */
+struct SdkThreadInfo {
+    int tid = 0;
+    std::string owner;  // Class of the SDK object that created the thread, empty for other threads
+    std::string name;
+    int sched_policy = -1;
+    int priority = 0;
+    std::vector<int> cpus;
+};
+
+/**
+ * @brief Threads created by the SDK objects (EliteDriver, RtsiIOInterface, PrimaryPortInterface...) and their
+ * policies.
+ *
+ * The SDK starts its receive and send threads internally and exposes no handle on them. They are found by listing
+ * /proc/self/task before and after the calls that start them (SdkThreadCapture), and identified afterwards by TID
+ * and start time, so a TID reused by an unrelated thread is not mistaken for an SDK thread. A policy set on an
+ * object applies to its live threads and to the threads it starts later. Linux only: elsewhere no thread is found.
+ */
+class SdkThreadRegistry {
+   public:
+    static SdkThreadRegistry& instance();
+
+    /**
+     * @brief Forget the threads and the policy recorded for `owner`, for an object built at a reused address.
+     */
+    void reset(const void* owner, const std::string& kind);
+
+    /**
+     * @brief Record threads started by `owner` and apply its policy to them.
+     */
+    void track(const void* owner, const std::string& kind, const std::vector<int>& tids);
+
+    /**
+     * @brief Forget `owner` and its policy. Called when the object is destroyed, so that the registry does not grow
+     * with every object and a later object at the same address starts clean. A stopped object keeps its policy for
+     * the threads of its next start.
+     */
+    void untrack(const void* owner);
+
+    /**
+     * @brief Set the policy of `owner` and apply it to its live threads.
+     *
+     * @return false if the policy could not be applied to one of the threads (usually missing CAP_SYS_NICE)
+     */
+    bool setPolicy(const void* owner, const ThreadPolicy& policy);
+
+    ThreadPolicy policy(const void* owner) const;
+
+    /**
+     * @brief Live threads of `owner`.
+     */
+    std::vector<SdkThreadInfo> threads(const void* owner) const;
+
+    /**
+     * @brief Live threads of every SDK object, and of the rest of the process when `include_others` is true.
+     */
+    std::vector<SdkThreadInfo> allThreads(bool include_others) const;
+
+    /**
+     * @brief TIDs of the threads of the process, sorted.
+     */
+    static std::vector<int> processThreads();
+
+   private:
+    struct Thread {
+        int tid;
+        uint64_t start_time;  // Clock ticks after boot, tells a thread from a later one with the same TID
+    };
+
+    struct Entry {
+        std::string kind;
+        ThreadPolicy policy;
+        bool has_policy = false;
+        std::vector<Thread> threads;
+    };
+
+    SdkThreadRegistry() = default;
+
+    static bool applyPolicy(const ThreadPolicy& policy, int tid, size_t index);
+    static std::vector<Thread> liveThreads(const Entry& entry);
+
+    mutable std::mutex mutex_;
+    std::map<const void*, Entry> entries_;
+};
+
+/**
+ * @brief Deleter of an SDK object whose threads are attributed with SdkThreadCapture. Forgets the object before its
+ * address can be reused.
+ */
+template <typename T>
+struct SdkThreadsDeleter {
+    void operator()(T* p) const {
+        SdkThreadRegistry::instance().untrack(p);
+        delete p;
+    }
+};
+
+// pybind11 holder type of the SDK classes that start threads
+template <typename T>
+using SdkThreadsPtr = std::unique_ptr<T, SdkThreadsDeleter<T>>;
+
+/**
+ * @brief Attribute the threads started during a call to an SDK object.
+ *
+ * Built before the call, committed after it with the object. Threads started concurrently by other code during the
+ * call are attributed too, so the calls are best made while the application starts no other thread.
+ */
+class SdkThreadCapture {
+   public:
+    explicit SdkThreadCapture(std::string kind);
+
+    /**
+     * @brief Record the threads started since construction as threads of `owner`.
+     *
+     * @param new_owner The object was just constructed: drop what was recorded at the same address before
+     */
+    void commit(const void* owner, bool new_owner = false);
+
+   private:
+    std::string kind_;
+    std::vector<int> before_;
+};
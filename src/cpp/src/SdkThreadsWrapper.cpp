@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "SdkThreadsWrapper.hpp"
+
+namespace py = pybind11;
+
+void bindSdkThreads(py::module_& m) {
+    py::enum_<ThreadSchedPolicy>(m, "ThreadSchedPolicy", py::arithmetic())
+        .value("KEEP", ThreadSchedPolicy::KEEP)
+        .value("OTHER", ThreadSchedPolicy::OTHER)
+        .value("FIFO", ThreadSchedPolicy::FIFO)
+        .value("RR", ThreadSchedPolicy::RR)
+        .value("BATCH", ThreadSchedPolicy::BATCH)
+        .value("IDLE", ThreadSchedPolicy::IDLE);
+
+    py::class_<ThreadPolicy>(m, "ThreadPolicy", "Placement and scheduling of the internal threads of an SDK object.")
+        .def(py::init([](const std::vector<int>& cpus, ThreadSchedPolicy sched_policy, int priority,
+                         const std::string& name) {
+                 return ThreadPolicy{cpus, sched_policy, priority, name};
+             }),
+             py::arg("cpus") = std::vector<int>(), py::arg("sched_policy") = ThreadSchedPolicy::KEEP,
+             py::arg("priority") = 0, py::arg("name") = "")
+        .def_readwrite("cpus", &ThreadPolicy::cpus, "Allowed cores, empty keeps the affinity.")
+        .def_readwrite("sched_policy", &ThreadPolicy::sched_policy,
+                       "Scheduling class, ThreadSchedPolicy.KEEP leaves the class and priority unchanged.")
+        .def_readwrite("priority", &ThreadPolicy::priority,
+                       "Real-time priority for FIFO and RR (1-99), nice value for the other classes.")
+        .def_readwrite("name", &ThreadPolicy::name,
+                       "Thread name (15 characters at most), empty keeps the name. The second and next threads of "
+                       "the object get '-1', '-2'... appended.")
+        .def("__repr__", [](const ThreadPolicy& p) {
+            return py::str("<ThreadPolicy cpus={} sched_policy={} priority={} name='{}'>")
+                .format(p.cpus, p.sched_policy, p.priority, p.name);
+        });
+
+    py::class_<SdkThreadInfo>(m, "SdkThreadInfo")
+        .def_readonly("tid", &SdkThreadInfo::tid, "Native thread ID (as threading.get_native_id()).")
+        .def_readonly("owner", &SdkThreadInfo::owner, "SDK class that started the thread, empty for other threads.")
+        .def_readonly("name", &SdkThreadInfo::name)
+        .def_readonly("sched_policy", &SdkThreadInfo::sched_policy, "Linux SCHED_* value, -1 if unknown.")
+        .def_readonly("priority", &SdkThreadInfo::priority, "Real-time priority for FIFO and RR, nice value otherwise.")
+        .def_readonly("cpus", &SdkThreadInfo::cpus)
+        .def("__repr__", [](const SdkThreadInfo& t) {
+            return py::str("<SdkThreadInfo tid={} owner='{}' name='{}' sched_policy={} priority={} cpus={}>")
+                .format(t.tid, t.owner, t.name, t.sched_policy, t.priority, t.cpus);
+        });
+
+    m.def(
+        "listSdkThreads",
+        [](bool include_others) { return SdkThreadRegistry::instance().allThreads(include_others); },
+        py::arg("include_others") = false,
+        R"doc(
+            List the running internal threads of the SDK objects (EliteDriver, RtsiIOInterface,
+            PrimaryClientInterface) with their TID, name, scheduling and CPU set.
+
+            The threads are attributed to an object by comparing the threads of the process before and after its
+            constructor and connect(). Threads started by other code during these calls are attributed too.
+            Linux only, empty elsewhere.
+
+            Args:
+                include_others (bool): Also list the other threads of the process, with an empty owner
+
+            Returns:
+                list[SdkThreadInfo]: The threads
+        )doc");
+}
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "SdkThreads.hpp"
+
+void bindSdkThreads(pybind11::module_& m);
+
+/**
+ * @brief Add setThreadPolicy(), getThreadPolicy() and getThreads() to the binding of an SDK class that starts threads.
+ *
+ * The constructor and the calls that start the threads must be wrapped in a SdkThreadCapture.
+ */
+template <typename T, typename... Options>
+void defThreadPolicyMethods(pybind11::class_<T, Options...>& cls) {
+    namespace py = pybind11;
+    cls.def(
+           "setThreadPolicy",
+           [](const T& self, const ThreadPolicy& policy) { return SdkThreadRegistry::instance().setPolicy(&self, policy); },
+           py::arg("policy"),
+           R"doc(
+                Set the CPU set, scheduling class, priority and name of the internal threads of this object. The policy
+                applies to the running threads and to the threads started later, for example by a reconnection.
+
+                Args:
+                    policy (ThreadPolicy): Policy of the threads
+
+                Returns:
+                    bool: False if the policy could not be applied to one of the running threads (real-time classes
+                        need CAP_SYS_NICE or a sufficient RLIMIT_RTPRIO)
+            )doc")
+        .def(
+            "getThreadPolicy", [](const T& self) { return SdkThreadRegistry::instance().policy(&self); },
+            "Policy set by setThreadPolicy().")
+        .def(
+            "getThreads", [](const T& self) { return SdkThreadRegistry::instance().threads(&self); },
+            "Running internal threads of this object, with their TID, name, scheduling and CPU set.");
+}
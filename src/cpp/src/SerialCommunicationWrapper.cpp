@@ -1,10 +1,16 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2025, Elite Robots.
 #include "SerialCommunicationWrapper.hpp"
+#include "GilSafeObject.hpp"
+#include "PyBufferView.hpp"
+#include "SerialStreamReader.hpp"
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <pybind11/functional.h>
 #include <Elite/SerialCommunication.hpp>
+#include <cstring>
 #include <iostream>
+#include <vector>
 
 namespace py = pybind11;
 using namespace ELITE;
@@ -85,26 +91,178 @@ void bindSerialConfig(py::module_& m) {
         .export_values();
 }
 
+// Copy frames out of the reader ring into a list of bytes
+static py::list framesToList(const SerialStreamReader::FrameView* frames, size_t count) {
+    py::list out(count);
+    for (size_t i = 0; i < count; ++i) {
+        const auto& f = frames[i];
+        py::bytes b(nullptr, f.totalSize());
+        char* dst = PyBytes_AS_STRING(b.ptr());
+        std::memcpy(dst, f.data, f.size);
+        std::memcpy(dst + f.size, f.wrapped_data, f.wrapped_size);
+        out[i] = std::move(b);
+    }
+    return out;
+}
+
+static void bindSerialStreamReader(py::module_& m) {
+    py::enum_<SerialFraming>(m, "SerialFraming", py::arithmetic())
+        .value("RAW", SerialFraming::RAW)
+        .value("DELIMITER", SerialFraming::DELIMITER)
+        .value("FIXED_LENGTH", SerialFraming::FIXED_LENGTH)
+        .value("LENGTH_PREFIX", SerialFraming::LENGTH_PREFIX)
+        .export_values();
+
+    py::class_<SerialStreamReader, GilReleasingPtr<SerialStreamReader>>(
+        m, "SerialStreamReader",
+        "Background reader of a streaming serial device. A native thread reads the port continuously into a ring "
+        "buffer and splits the stream into frames, which are taken in batches.")
+        .def(py::init<std::shared_ptr<SerialCommunication>, size_t, size_t>(), py::arg("serial"),
+             py::arg("capacity") = 65536, py::arg("max_frames") = 4096,
+             R"doc(
+                Args:
+                    serial (SerialCommunication): Connected serial port
+                    capacity (int): Size of the byte ring, rounded up to a power of two
+                    max_frames (int): Number of frames that can be pending, rounded up to a power of two
+            )doc")
+        .def("setRawFraming", &SerialStreamReader::setRawFraming,
+             "Deliver every chunk read from the serial port as a frame. This is the default.")
+        .def(
+            "setDelimiterFraming",
+            [](SerialStreamReader& self, const py::bytes& delimiter, bool keep_delimiter) {
+                self.setDelimiterFraming(delimiter, keep_delimiter);
+            },
+            py::arg("delimiter"), py::arg("keep_delimiter") = false,
+            R"doc(
+                Split the stream after each delimiter.
+
+                Args:
+                    delimiter (bytes): Delimiter sequence, e.g. b"\r\n"
+                    keep_delimiter (bool): Keep the delimiter at the end of the frames
+            )doc")
+        .def("setFixedLengthFraming", &SerialStreamReader::setFixedLengthFraming, py::arg("size"),
+             "Split the stream into frames of `size` bytes.")
+        .def("setLengthPrefixFraming", &SerialStreamReader::setLengthPrefixFraming, py::arg("offset"),
+             py::arg("size"), py::arg("big_endian") = true, py::arg("adjustment") = 0,
+             R"doc(
+                Split the stream with a length field. A frame is `offset` header bytes, the length field, then
+                `length + adjustment` bytes. Frames with an invalid length are skipped one byte at a time.
+
+                Args:
+                    offset (int): Bytes before the length field
+                    size (int): Width of the length field: 1, 2 or 4 bytes
+                    big_endian (bool): Byte order of the length field
+                    adjustment (int): Added to the length, e.g. 2 when a CRC follows the payload
+            )doc")
+        .def("setMaxFrameSize", &SerialStreamReader::setMaxFrameSize, py::arg("size"),
+             "Set the largest frame; longer partial frames are discarded. Default and maximum: half the capacity.")
+        .def("getMaxFrameSize", &SerialStreamReader::getMaxFrameSize)
+        .def("getFraming", &SerialStreamReader::getFraming)
+        .def(
+            "setBatchCallback",
+            [](SerialStreamReader& self, py::object cb, size_t min_batch, int max_latency_ms) {
+                if (cb.is_none()) {
+                    self.setBatchCallback(nullptr, min_batch, max_latency_ms);
+                    return;
+                }
+                auto cb_ptr = makeGilSafe(std::move(cb));
+                self.setBatchCallback(
+                    [cb_ptr](const SerialStreamReader::FrameView* frames, size_t count) {
+                        py::gil_scoped_acquire gil;
+                        try {
+                            (*cb_ptr)(framesToList(frames, count));
+                        } catch (const py::error_already_set& e) {
+                            py::print("Python callback raised exception:", e.what());
+                        }
+                    },
+                    min_batch, max_latency_ms);
+            },
+            py::arg("cb"), py::arg("min_batch") = 1, py::arg("max_latency_ms") = 10,
+            R"doc(
+                Deliver frames to a callback from a dispatch thread, instead of readFrames(). Must be set before start().
+
+                Args:
+                    cb (Callable[[list[bytes]], None]): Receives a batch of frames. None removes the callback.
+                    min_batch (int): Frames collected before a batch is delivered
+                    max_latency_ms (int): Longest time a frame waits for the batch to fill
+            )doc")
+        .def("start", &SerialStreamReader::start, "Start the reader thread.")
+        .def("stop", &SerialStreamReader::stop, py::call_guard<py::gil_scoped_release>(),
+             "Stop the reader. Frames already read are kept.")
+        .def("isRunning", &SerialStreamReader::isRunning,
+             "Check whether the reader runs. It stops by itself when the serial connection is lost.")
+        .def("waitFrames", &SerialStreamReader::waitFrames, py::arg("count"), py::arg("timeout_ms"),
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+                Wait until `count` frames are available. The GIL is released while waiting.
+
+                Args:
+                    count (int): Number of frames
+                    timeout_ms (int): Timeout in milliseconds, <= 0 waits forever
+                Returns:
+                    bool: True if the frames are available, False on timeout or when the reader stops
+            )doc")
+        .def(
+            "readFrames",
+            [](SerialStreamReader& self, size_t max_frames, int timeout_ms) {
+                if (timeout_ms != 0) {
+                    py::gil_scoped_release release;
+                    self.waitFrames(1, timeout_ms);
+                }
+                py::list out;
+                self.consume(max_frames, [&out](const SerialStreamReader::FrameView* frames, size_t count) {
+                    out = framesToList(frames, count);
+                });
+                return out;
+            },
+            py::arg("max_frames") = 0, py::arg("timeout_ms") = 0,
+            R"doc(
+                Take the available frames.
+
+                Args:
+                    max_frames (int): Largest number of frames returned, 0 for all
+                    timeout_ms (int): Time to wait for a first frame, 0 returns at once, < 0 waits forever
+                Returns:
+                    list[bytes]: Frames in arrival order
+            )doc")
+        .def("framesAvailable", &SerialStreamReader::framesAvailable, "Number of frames ready to be read.")
+        .def("capacity", &SerialStreamReader::capacity, "Size of the byte ring.")
+        .def("bytesReceived", &SerialStreamReader::bytesReceived, "Bytes read from the serial port.")
+        .def("framesReceived", &SerialStreamReader::framesReceived, "Frames split from the stream.")
+        .def("bytesDiscarded", &SerialStreamReader::bytesDiscarded,
+             "Bytes dropped by the framer: oversized frames and invalid length headers.");
+}
+
 void bindSerialCommunication(pybind11::module_& m) {
     // 注意：基类绑定要带上 trampoline 类型并且不要绑定构造函数（因为它是抽象的）
     py::class_<SerialCommunication, PySerialCommunication, std::shared_ptr<SerialCommunication>>(m, "SerialCommunication")
-        .def("connect", &SerialCommunication::connect,
+        .def("connect", &SerialCommunication::connect, py::call_guard<py::gil_scoped_release>(),
              R"doc(
                 Connect to the RS485 TCP server.
 
                 Returns:
                     bool: True if connected successfully, False otherwise.
             )doc")
-        .def("disconnect", &SerialCommunication::disconnect, R"doc(Disconnect from the RS485 TCP server.)doc")
+        .def("disconnect", &SerialCommunication::disconnect, py::call_guard<py::gil_scoped_release>(),
+             R"doc(Disconnect from the RS485 TCP server.)doc")
         .def("isConnected", &SerialCommunication::isConnected, R"doc(Check connection status.)doc")
-        // write: expose as bytes -> int in Python
+        // write: any C-contiguous buffer (bytes, bytearray, memoryview, ndarray) -> int, without copying
         .def(
             "write",
-            [](SerialCommunication& sc, py::bytes data) {
-                std::string s = static_cast<std::string>(data);
-                return sc.write(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+            [](SerialCommunication& sc, py::object data) {
+                PyBufferView view(data, false);
+                py::gil_scoped_release release;
+                return sc.write(view.data(), view.size());
             },
-            py::arg("data"))
+            py::arg("data"),
+            R"doc(
+                Write a buffer to the serial port. The GIL is released during the write.
+
+                Args:
+                    data: bytes-like object (bytes, bytearray, memoryview, C-contiguous ndarray)
+                Returns:
+                    int: Number of bytes written
+            )doc")
         // read: expose as (size:int, timeout_ms:int) -> bytes
         .def(
             "read",
@@ -112,13 +270,44 @@ void bindSerialCommunication(pybind11::module_& m) {
                 if (size <= 0) {
                     return py::bytes();
                 }
-                std::vector<uint8_t> buf(static_cast<size_t>(size));
-                int n = sc.read(buf.data(), buf.size(), timeout_ms);
+                // Reused per thread, the only copy is into the returned bytes
+                thread_local std::vector<uint8_t> buf;
+                buf.resize(static_cast<size_t>(size));
+                int n;
+                {
+                    py::gil_scoped_release release;
+                    n = sc.read(buf.data(), buf.size(), timeout_ms);
+                }
                 if (n <= 0) {
                     return py::bytes();
                 }
                 return py::bytes(reinterpret_cast<char*>(buf.data()), n);
             },
             py::arg("size"), py::arg("timeout_ms"))
+        // readInto: fill a writable buffer in place
+        .def(
+            "readInto",
+            [](SerialCommunication& sc, py::object buffer, int timeout_ms) {
+                PyBufferView view(buffer, true);
+                if (view.size() == 0) {
+                    return 0;
+                }
+                py::gil_scoped_release release;
+                return sc.read(view.data(), view.size(), timeout_ms);
+            },
+            py::arg("buffer"), py::arg("timeout_ms"),
+            R"doc(
+                Read from the serial port directly into a writable buffer, without allocating. The GIL is released
+                during the read.
+
+                Args:
+                    buffer: writable bytes-like object (bytearray, memoryview, C-contiguous ndarray). At most
+                        len(buffer) bytes are read.
+                    timeout_ms (int): Timeout in milliseconds. Values <= 0 indicate infinite waiting.
+                Returns:
+                    int: Number of bytes read, <= 0 if nothing was read
+            )doc")
         .def("getSocatPid", &SerialCommunication::getSocatPid);
+
+    bindSerialStreamReader(m);
 }
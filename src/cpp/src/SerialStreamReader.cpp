@@ -0,0 +1,353 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "SerialStreamReader.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+using namespace ELITE;
+
+namespace {
+
+// Serial read timeout, bounds the time stop() waits for the reader thread.
+constexpr int READ_TIMEOUT_MS = 20;
+
+// Pause of the reader thread while the consumer frees space.
+constexpr auto BACKPRESSURE_PAUSE = std::chrono::milliseconds(1);
+
+size_t roundUpPowerOfTwo(size_t v) {
+    size_t p = 2;
+    while (p < v) {
+        p <<= 1;
+    }
+    return p;
+}
+
+}  // namespace
+
+SerialStreamReader::SerialStreamReader(std::shared_ptr<SerialCommunication> serial, size_t capacity,
+                                       size_t max_frames)
+    : serial_(std::move(serial)),
+      capacity_(roundUpPowerOfTwo(std::max<size_t>(capacity, 256))),
+      ring_(new uint8_t[capacity_]),
+      frames_(roundUpPowerOfTwo(std::max<size_t>(max_frames, 2))),
+      max_frame_size_(capacity_ / 2) {
+    if (!serial_) {
+        throw std::invalid_argument("SerialStreamReader needs a serial communication");
+    }
+}
+
+SerialStreamReader::~SerialStreamReader() { stop(); }
+
+void SerialStreamReader::checkStopped() const {
+    if (running_) {
+        throw std::runtime_error("Serial stream reader settings cannot be changed while it is running");
+    }
+}
+
+void SerialStreamReader::setRawFraming() {
+    checkStopped();
+    framing_ = SerialFraming::RAW;
+    scan_ = frame_start_;
+    pending_frame_size_ = 0;
+}
+
+void SerialStreamReader::setDelimiterFraming(const std::string& delimiter, bool keep_delimiter) {
+    checkStopped();
+    if (delimiter.empty() || delimiter.size() >= max_frame_size_) {
+        throw std::invalid_argument("Invalid frame delimiter");
+    }
+    framing_ = SerialFraming::DELIMITER;
+    delimiter_ = delimiter;
+    keep_delimiter_ = keep_delimiter;
+    scan_ = frame_start_;
+    pending_frame_size_ = 0;
+}
+
+void SerialStreamReader::setFixedLengthFraming(size_t size) {
+    checkStopped();
+    if (size == 0 || size > max_frame_size_) {
+        throw std::invalid_argument("Fixed frame size must be between 1 and the maximum frame size");
+    }
+    framing_ = SerialFraming::FIXED_LENGTH;
+    fixed_size_ = size;
+    scan_ = frame_start_;
+    pending_frame_size_ = 0;
+}
+
+void SerialStreamReader::setLengthPrefixFraming(size_t offset, size_t size, bool big_endian, int adjustment) {
+    checkStopped();
+    if (size != 1 && size != 2 && size != 4) {
+        throw std::invalid_argument("Length field must be 1, 2 or 4 bytes");
+    }
+    if (offset + size > max_frame_size_) {
+        throw std::invalid_argument("Length field is beyond the maximum frame size");
+    }
+    framing_ = SerialFraming::LENGTH_PREFIX;
+    prefix_offset_ = offset;
+    prefix_size_ = size;
+    prefix_big_endian_ = big_endian;
+    prefix_adjustment_ = adjustment;
+    scan_ = frame_start_;
+    pending_frame_size_ = 0;
+}
+
+void SerialStreamReader::setMaxFrameSize(size_t size) {
+    checkStopped();
+    max_frame_size_ = std::min(std::max<size_t>(size, 1), capacity_ / 2);
+}
+
+void SerialStreamReader::setBatchCallback(FrameVisitor callback, size_t min_batch, int max_latency_ms) {
+    checkStopped();
+    callback_ = std::move(callback);
+    min_batch_ = std::max<size_t>(min_batch, 1);
+    max_latency_ms_ = max_latency_ms > 0 ? max_latency_ms : 1;
+}
+
+void SerialStreamReader::start() {
+    if (running_) {
+        return;
+    }
+    // Threads that ended after a disconnection
+    if (reader_thread_.joinable()) {
+        reader_thread_.join();
+    }
+    if (dispatch_thread_.joinable()) {
+        dispatch_thread_.join();
+    }
+    running_ = true;
+    reader_thread_ = std::thread(&SerialStreamReader::readerLoop, this);
+    if (callback_) {
+        dispatch_thread_ = std::thread(&SerialStreamReader::dispatchLoop, this);
+    }
+}
+
+void SerialStreamReader::stop() {
+    running_ = false;
+    notifyWaiters();
+    for (std::thread* t : {&reader_thread_, &dispatch_thread_}) {
+        if (!t->joinable()) {
+            continue;
+        }
+        if (t->get_id() == std::this_thread::get_id()) {
+            // stop() called from the batch callback
+            t->detach();
+        } else {
+            t->join();
+        }
+    }
+}
+
+void SerialStreamReader::notifyWaiters() {
+    if (waiters_.load() > 0) {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        wait_cv_.notify_all();
+    }
+}
+
+bool SerialStreamReader::publish(uint64_t start, uint64_t size, uint64_t end) {
+    const uint64_t head = frame_head_.load(std::memory_order_relaxed);
+    if (head - frame_tail_.load(std::memory_order_acquire) >= frames_.size()) {
+        return false;
+    }
+    frames_[head & (frames_.size() - 1)] = FrameEntry{start, end, static_cast<uint32_t>(size)};
+    frame_head_.store(head + 1, std::memory_order_release);
+    frames_received_.fetch_add(1, std::memory_order_relaxed);
+    ready_frames_.fetch_add(1);
+    return true;
+}
+
+void SerialStreamReader::discard(uint64_t end) {
+    bytes_discarded_.fetch_add(end - frame_start_, std::memory_order_relaxed);
+    frame_start_ = end;
+    scan_ = std::max(scan_, end);
+    pending_frame_size_ = 0;
+}
+
+bool SerialStreamReader::frame(uint64_t head) {
+    switch (framing_) {
+        case SerialFraming::RAW:
+            while (head > frame_start_) {
+                const uint64_t size = std::min<uint64_t>(head - frame_start_, max_frame_size_);
+                if (!publish(frame_start_, size, frame_start_ + size)) {
+                    return false;
+                }
+                frame_start_ += size;
+            }
+            scan_ = head;
+            return true;
+
+        case SerialFraming::DELIMITER: {
+            const size_t dlen = delimiter_.size();
+            const auto last = static_cast<uint8_t>(delimiter_.back());
+            for (uint64_t p = scan_; p < head; ++p) {
+                if (byteAt(p) != last || p + 1 - frame_start_ < dlen) {
+                    continue;
+                }
+                bool match = true;
+                for (size_t i = 1; i < dlen && match; ++i) {
+                    match = byteAt(p - i) == static_cast<uint8_t>(delimiter_[dlen - 1 - i]);
+                }
+                if (!match) {
+                    continue;
+                }
+                const uint64_t end = p + 1;
+                const uint64_t size = end - frame_start_ - (keep_delimiter_ ? 0 : dlen);
+                if (!publish(frame_start_, size, end)) {
+                    scan_ = p;
+                    return false;
+                }
+                frame_start_ = end;
+            }
+            scan_ = head;
+            if (head - frame_start_ > max_frame_size_) {
+                discard(head);
+            }
+            return true;
+        }
+
+        case SerialFraming::FIXED_LENGTH:
+            while (head - frame_start_ >= fixed_size_) {
+                if (!publish(frame_start_, fixed_size_, frame_start_ + fixed_size_)) {
+                    return false;
+                }
+                frame_start_ += fixed_size_;
+            }
+            scan_ = head;
+            return true;
+
+        case SerialFraming::LENGTH_PREFIX: {
+            const size_t header = prefix_offset_ + prefix_size_;
+            for (;;) {
+                if (pending_frame_size_ == 0) {
+                    if (head - frame_start_ < header) {
+                        break;
+                    }
+                    uint64_t length = 0;
+                    for (size_t i = 0; i < prefix_size_; ++i) {
+                        const size_t shift = prefix_big_endian_ ? (prefix_size_ - 1 - i) * 8 : i * 8;
+                        length |= static_cast<uint64_t>(byteAt(frame_start_ + prefix_offset_ + i)) << shift;
+                    }
+                    const int64_t total = static_cast<int64_t>(header + length) + prefix_adjustment_;
+                    if (total < static_cast<int64_t>(header) || total > static_cast<int64_t>(max_frame_size_)) {
+                        // Not a valid header, resynchronize on the next byte
+                        discard(frame_start_ + 1);
+                        continue;
+                    }
+                    pending_frame_size_ = static_cast<uint64_t>(total);
+                }
+                if (head - frame_start_ < pending_frame_size_) {
+                    break;
+                }
+                if (!publish(frame_start_, pending_frame_size_, frame_start_ + pending_frame_size_)) {
+                    return false;
+                }
+                frame_start_ += pending_frame_size_;
+                pending_frame_size_ = 0;
+            }
+            scan_ = head;
+            return true;
+        }
+    }
+    return true;
+}
+
+void SerialStreamReader::readerLoop() {
+    const uint64_t mask = capacity_ - 1;
+    while (running_) {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        const bool framed = frame(head);
+        notifyWaiters();
+
+        // Without pending frames the consumer does not touch the tail, release the skipped bytes here
+        if (frame_tail_.load(std::memory_order_acquire) == frame_head_.load(std::memory_order_relaxed) &&
+            frame_start_ > tail_.load(std::memory_order_relaxed)) {
+            tail_.store(frame_start_, std::memory_order_release);
+        }
+
+        const uint64_t free = capacity_ - (head - tail_.load(std::memory_order_acquire));
+        if (!framed || free == 0) {
+            std::this_thread::sleep_for(BACKPRESSURE_PAUSE);
+            continue;
+        }
+        const size_t contiguous = std::min<uint64_t>(free, capacity_ - (head & mask));
+        const int n = serial_->read(ring_.get() + (head & mask), contiguous, READ_TIMEOUT_MS);
+        if (n > 0) {
+            head_.store(head + static_cast<uint64_t>(n), std::memory_order_release);
+            bytes_received_.fetch_add(static_cast<uint64_t>(n), std::memory_order_relaxed);
+        } else if (!serial_->isConnected()) {
+            break;
+        }
+    }
+    frame(head_.load(std::memory_order_relaxed));
+    running_ = false;
+    notifyWaiters();
+}
+
+void SerialStreamReader::dispatchLoop() {
+    while (running_) {
+        waitFrames(min_batch_, max_latency_ms_);
+        if (ready_frames_ > 0) {
+            consume(0, callback_);
+        }
+    }
+    // Frames read before the reader stopped
+    consume(0, callback_);
+}
+
+bool SerialStreamReader::waitFrames(size_t count, int timeout_ms) {
+    if (ready_frames_ >= count) {
+        return true;
+    }
+    auto ready = [&] { return ready_frames_ >= count || !running_; };
+    waiters_.fetch_add(1);
+    {
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        if (timeout_ms > 0) {
+            wait_cv_.wait_for(lock, std::chrono::milliseconds(timeout_ms), ready);
+        } else {
+            wait_cv_.wait(lock, ready);
+        }
+    }
+    waiters_.fetch_sub(1);
+    return ready_frames_ >= count;
+}
+
+size_t SerialStreamReader::consume(size_t max_frames, const FrameVisitor& visitor) {
+    std::lock_guard<std::mutex> lock(consume_mutex_);
+    const uint64_t first = frame_tail_.load(std::memory_order_relaxed);
+    size_t count = static_cast<size_t>(frame_head_.load(std::memory_order_acquire) - first);
+    if (max_frames > 0) {
+        count = std::min(count, max_frames);
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    const uint64_t mask = capacity_ - 1;
+    views_.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        const FrameEntry& entry = frames_[(first + i) & (frames_.size() - 1)];
+        const size_t offset = static_cast<size_t>(entry.start & mask);
+        const size_t first_part = std::min<size_t>(entry.size, capacity_ - offset);
+        views_[i] = FrameView{ring_.get() + offset, first_part, ring_.get(), entry.size - first_part};
+    }
+    const uint64_t release = frames_[(first + count - 1) & (frames_.size() - 1)].end;
+
+    // Release the frames even if the visitor throws
+    struct Release {
+        SerialStreamReader& self;
+        uint64_t end;
+        uint64_t frame_tail;
+        size_t count;
+        ~Release() {
+            self.tail_.store(end, std::memory_order_release);
+            self.frame_tail_.store(frame_tail, std::memory_order_release);
+            self.ready_frames_.fetch_sub(count);
+        }
+    } guard{*this, release, first + count, count};
+
+    visitor(views_.data(), count);
+    return count;
+}
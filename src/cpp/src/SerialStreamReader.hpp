@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <Elite/SerialCommunication.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief How SerialStreamReader splits the byte stream into frames.
+ */
+enum class SerialFraming : int {
+    RAW = 0,        // Every chunk returned by the serial port is a frame
+    DELIMITER,      // Frames end with a delimiter sequence, e.g. "\r\n"
+    FIXED_LENGTH,   // Frames have a fixed size
+    LENGTH_PREFIX,  // A header field gives the size of the payload
+};
+
+/**
+ * @brief Background reader of a streaming serial device.
+ *
+ * A reader thread reads the SerialCommunication continuously into a single-producer/single-consumer byte ring and
+ * splits the stream into frames as bytes arrive. Frame boundaries are published through a second lock-free ring, so
+ * the reader thread never takes a lock. Consumers take frames in batches, directly from the ring memory.
+ *
+ * When the rings are full the reader stops reading, and the bytes wait in the serial forwarding socket. A partial
+ * frame longer than the maximum frame size is discarded, so a missing delimiter cannot stall the stream.
+ */
+class SerialStreamReader {
+   public:
+    /**
+     * @brief A frame in the byte ring. A frame that wraps around the end of the ring has two parts.
+     */
+    struct FrameView {
+        const uint8_t* data;
+        size_t size;
+        const uint8_t* wrapped_data;
+        size_t wrapped_size;
+
+        size_t totalSize() const { return size + wrapped_size; }
+    };
+
+    // Receives `count` frames, valid until the callback returns
+    using FrameVisitor = std::function<void(const FrameView* frames, size_t count)>;
+
+    /**
+     * @param serial Connected serial port
+     * @param capacity Size of the byte ring, rounded up to a power of two
+     * @param max_frames Number of pending frames, rounded up to a power of two
+     */
+    explicit SerialStreamReader(std::shared_ptr<ELITE::SerialCommunication> serial, size_t capacity = 65536,
+                                size_t max_frames = 4096);
+    ~SerialStreamReader();
+
+    SerialStreamReader(const SerialStreamReader&) = delete;
+    SerialStreamReader& operator=(const SerialStreamReader&) = delete;
+
+    /**
+     * @brief Deliver every chunk read from the serial port as a frame. This is the default.
+     */
+    void setRawFraming();
+
+    /**
+     * @brief Split the stream after each `delimiter`.
+     *
+     * @param keep_delimiter Keep the delimiter at the end of the frames
+     */
+    void setDelimiterFraming(const std::string& delimiter, bool keep_delimiter);
+
+    /**
+     * @brief Split the stream into frames of `size` bytes.
+     */
+    void setFixedLengthFraming(size_t size);
+
+    /**
+     * @brief Split the stream with a length field: a frame is `offset` header bytes, the `size`-byte length field,
+     * then `length + adjustment` bytes.
+     *
+     * @param size Width of the length field: 1, 2 or 4 bytes
+     * @param adjustment Added to the length field, e.g. 2 when a CRC follows the payload
+     */
+    void setLengthPrefixFraming(size_t offset, size_t size, bool big_endian, int adjustment);
+
+    /**
+     * @brief Set the largest frame. Longer partial frames are discarded. Default and maximum: half the capacity.
+     */
+    void setMaxFrameSize(size_t size);
+    size_t getMaxFrameSize() const { return max_frame_size_; }
+
+    SerialFraming getFraming() const { return framing_; }
+
+    /**
+     * @brief Deliver frames to `callback` from a dispatch thread instead of readFrames().
+     *
+     * @param min_batch Frames collected before a batch is delivered
+     * @param max_latency_ms Longest time a frame waits for the batch to fill
+     */
+    void setBatchCallback(FrameVisitor callback, size_t min_batch, int max_latency_ms);
+
+    /**
+     * @brief Start the reader thread, and the dispatch thread if a batch callback is set. Framing and callback
+     * settings cannot be changed while running.
+     */
+    void start();
+
+    /**
+     * @brief Stop the threads. Frames already read are kept.
+     */
+    void stop();
+
+    bool isRunning() const { return running_; }
+
+    /**
+     * @brief Wait until `count` frames are available.
+     *
+     * @param timeout_ms Timeout, <= 0 waits forever
+     * @return true if the frames are available, false on timeout or when the reader stops
+     */
+    bool waitFrames(size_t count, int timeout_ms);
+
+    /**
+     * @brief Take up to `max_frames` frames (0 for all) and pass them to `visitor`.
+     *
+     * @return Number of frames taken
+     */
+    size_t consume(size_t max_frames, const FrameVisitor& visitor);
+
+    size_t framesAvailable() const { return ready_frames_; }
+    size_t capacity() const { return capacity_; }
+    uint64_t bytesReceived() const { return bytes_received_; }
+    uint64_t framesReceived() const { return frames_received_; }
+    uint64_t bytesDiscarded() const { return bytes_discarded_; }
+
+   private:
+    struct FrameEntry {
+        uint64_t start;
+        uint64_t end;  // Ring position released once the frame is consumed, includes a dropped delimiter
+        uint32_t size;
+    };
+
+    void checkStopped() const;
+    void readerLoop();
+    void dispatchLoop();
+    // Frame the bytes up to `head`. Returns false if the frame ring is full.
+    bool frame(uint64_t head);
+    bool publish(uint64_t start, uint64_t size, uint64_t end);
+    // Drop the bytes of the current partial frame up to `end`
+    void discard(uint64_t end);
+    uint8_t byteAt(uint64_t pos) const { return ring_[pos & (capacity_ - 1)]; }
+    void notifyWaiters();
+
+    std::shared_ptr<ELITE::SerialCommunication> serial_;
+    size_t capacity_;
+    std::unique_ptr<uint8_t[]> ring_;
+    std::vector<FrameEntry> frames_;
+
+    // Byte ring positions: written by the reader thread, released by the consumer
+    alignas(64) std::atomic<uint64_t> head_{0};
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    // Frame ring positions
+    alignas(64) std::atomic<uint64_t> frame_head_{0};
+    alignas(64) std::atomic<uint64_t> frame_tail_{0};
+    std::atomic<size_t> ready_frames_{0};
+
+    // Framer state, owned by the reader thread while running
+    SerialFraming framing_ = SerialFraming::RAW;
+    std::string delimiter_;
+    bool keep_delimiter_ = false;
+    size_t fixed_size_ = 0;
+    size_t prefix_offset_ = 0;
+    size_t prefix_size_ = 0;
+    bool prefix_big_endian_ = true;
+    int prefix_adjustment_ = 0;
+    size_t max_frame_size_;
+    uint64_t frame_start_ = 0;
+    uint64_t scan_ = 0;
+    uint64_t pending_frame_size_ = 0;  // Size of the current length-prefixed frame, 0 until the header is read
+
+    std::mutex consume_mutex_;
+    std::vector<FrameView> views_;
+
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+    std::atomic<int> waiters_{0};
+
+    FrameVisitor callback_;
+    size_t min_batch_ = 1;
+    int max_latency_ms_ = 10;
+
+    std::atomic<bool> running_{false};
+    std::thread reader_thread_;
+    std::thread dispatch_thread_;
+
+    std::atomic<uint64_t> bytes_received_{0};
+    std::atomic<uint64_t> frames_received_{0};
+    std::atomic<uint64_t> bytes_discarded_{0};
+};
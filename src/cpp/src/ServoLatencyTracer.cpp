@@ -0,0 +1,271 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "ServoLatencyTracer.hpp"
+#include "RtToolkit.hpp"
+#include "SamplingUtils.hpp"
+#include "SdkThreads.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+ServoLatencyTracer::ServoLatencyTracer(const Options& options) : options_(options) {
+    if (options.tolerance <= 0 || options.min_speed < 0 || options.max_latency <= 0 || options.window <= 0) {
+        throw std::invalid_argument("tolerance, max_latency and window must be positive, min_speed not negative");
+    }
+    for (Window& window : windows_) {
+        window.values.assign(static_cast<size_t>(options.window), 0.0);
+    }
+}
+
+ServoLatencyTracer::~ServoLatencyTracer() {
+    stop();
+    SdkThreadRegistry::instance().untrack(this);
+}
+
+void ServoLatencyTracer::recordCommand(const Joints& q, double host_time) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    commands_.push_back({host_time, q});
+    command_count_++;
+    trim(commands_, host_time);
+}
+
+void ServoLatencyTracer::trim(std::deque<Entry>& path, double now) {
+    // One entry older than the window is kept: it starts the first segment of the window
+    while (path.size() > 2 && path[1].time < now - options_.max_latency) {
+        path.pop_front();
+    }
+}
+
+bool ServoLatencyTracer::match(const std::deque<Entry>& path, const Joints& q, double now, double previous,
+                               double& time) const {
+    const double tolerance2 = options_.tolerance * options_.tolerance;
+    // Consecutive matching segments moving the same way are one pass of the path near `q`, its closest point is kept.
+    // A path that oscillates passes several times within the search window, and turns back near the extremes: the pass
+    // whose latency is closest to the previous one is taken, and without a previous latency such a sample is not
+    // matched.
+    int passes = 0;
+    bool in_pass = false;
+    size_t last_segment = 0;
+    Joints last_direction{};
+    double pass_dist2 = 0.0;
+    double pass_time = 0.0;
+    double best_error = std::numeric_limits<double>::infinity();
+    auto closePass = [&]() {
+        passes++;
+        const double error = previous < 0 ? 0.0 : std::abs(now - pass_time - previous);
+        if (error < best_error) {
+            best_error = error;
+            time = pass_time;
+        }
+    };
+    for (size_t i = 1; i < path.size(); ++i) {
+        const Entry& a = path[i - 1];
+        const Entry& b = path[i];
+        const double dt = b.time - a.time;
+        if (b.time < now - options_.max_latency || dt <= 0) {
+            continue;
+        }
+        double ab2 = 0.0;
+        double dot = 0.0;
+        for (int j = 0; j < JOINTS; ++j) {
+            const double d = b.q[j] - a.q[j];
+            ab2 += d * d;
+            dot += (q[j] - a.q[j]) * d;
+        }
+        // At rest every point of the segment matches: its time would be arbitrary
+        if (ab2 <= 0 || std::sqrt(ab2) < options_.min_speed * dt) {
+            continue;
+        }
+        const double u = std::min(std::max(dot / ab2, 0.0), 1.0);
+        double dist2 = 0.0;
+        for (int j = 0; j < JOINTS; ++j) {
+            const double d = q[j] - (a.q[j] + u * (b.q[j] - a.q[j]));
+            dist2 += d * d;
+        }
+        if (dist2 > tolerance2) {
+            continue;
+        }
+        double turn = 0.0;
+        for (int j = 0; j < JOINTS; ++j) {
+            turn += (b.q[j] - a.q[j]) * last_direction[j];
+            last_direction[j] = b.q[j] - a.q[j];
+        }
+        if (in_pass && i == last_segment + 1 && turn > 0) {
+            if (dist2 <= pass_dist2) {
+                pass_dist2 = dist2;
+                pass_time = a.time + u * dt;
+            }
+        } else {
+            if (in_pass) {
+                closePass();
+            }
+            in_pass = true;
+            pass_dist2 = dist2;
+            pass_time = a.time + u * dt;
+        }
+        last_segment = i;
+    }
+    if (in_pass) {
+        closePass();
+    }
+    return passes == 1 || (passes > 1 && previous >= 0);
+}
+
+void ServoLatencyTracer::push(ServoLatency latency, double value_ms) {
+    Window& window = windows_[static_cast<size_t>(latency)];
+    window.values[window.next] = value_ms;
+    window.next = (window.next + 1) % window.values.size();
+    window.full = window.full || window.next == 0;
+    window.count++;
+    window.last = value_ms;
+}
+
+void ServoLatencyTracer::addSample(double host_time, const Joints& target, const Joints& actual) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sample_count_++;
+    auto trace = [&](const std::deque<Entry>& path, const Joints& q, ServoLatency latency) {
+        const Window& window = windows_[static_cast<size_t>(latency)];
+        const double previous = window.count > 0 ? window.last / 1000.0 : -1.0;
+        double time = 0.0;
+        if (match(path, q, host_time, previous, time) && time <= host_time) {
+            push(latency, (host_time - time) * 1000.0);
+        }
+    };
+    trace(commands_, target, ServoLatency::COMMAND_TO_TARGET);
+    trace(commands_, actual, ServoLatency::COMMAND_TO_ACTUAL);
+    trace(targets_, actual, ServoLatency::TARGET_TO_ACTUAL);
+    targets_.push_back({host_time, target});
+    trim(targets_, host_time);
+}
+
+void ServoLatencyTracer::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    commands_.clear();
+    targets_.clear();
+    for (Window& window : windows_) {
+        std::fill(window.values.begin(), window.values.end(), 0.0);
+        window.next = 0;
+        window.full = false;
+        window.count = 0;
+        window.last = 0.0;
+    }
+    command_count_ = 0;
+    sample_count_ = 0;
+}
+
+std::vector<double> ServoLatencyTracer::latencies(ServoLatency latency) const {
+    if (latency == ServoLatency::COUNT) {
+        throw std::invalid_argument("Invalid latency");
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Window& window = windows_[static_cast<size_t>(latency)];
+    const auto next = window.values.begin() + static_cast<std::ptrdiff_t>(window.next);
+    if (!window.full) {
+        return std::vector<double>(window.values.begin(), next);
+    }
+    std::vector<double> values(next, window.values.end());
+    values.insert(values.end(), window.values.begin(), next);
+    return values;
+}
+
+LatencyDistribution ServoLatencyTracer::distribution(ServoLatency latency) const {
+    std::vector<double> values = latencies(latency);
+    LatencyDistribution result;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const Window& window = windows_[static_cast<size_t>(latency)];
+        result.count = window.count;
+        result.last_ms = window.last;
+    }
+    if (values.empty()) {
+        return result;
+    }
+    std::sort(values.begin(), values.end());
+    double sum = 0.0;
+    for (double value : values) {
+        sum += value;
+    }
+    result.min_ms = values.front();
+    result.mean_ms = sum / static_cast<double>(values.size());
+    result.p50_ms = percentile(values, 0.5);
+    result.p90_ms = percentile(values, 0.9);
+    result.p99_ms = percentile(values, 0.99);
+    result.max_ms = values.back();
+    return result;
+}
+
+uint64_t ServoLatencyTracer::commands() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return command_count_;
+}
+
+uint64_t ServoLatencyTracer::samples() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return sample_count_;
+}
+
+bool ServoLatencyTracer::start(SampleReader reader, SampleClock clock, int poll_us, int cpu, int priority) {
+    if (running_) {
+        return false;
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    running_ = true;
+    thread_ = std::thread(&ServoLatencyTracer::loop, this, std::move(reader), std::move(clock), std::max(poll_us, 1),
+                          cpu, priority);
+    return true;
+}
+
+void ServoLatencyTracer::stop() {
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        running_ = false;
+    }
+    wait_cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void ServoLatencyTracer::loop(SampleReader reader, SampleClock clock, int poll_us, int cpu, int priority) {
+    if (cpu >= 0) {
+        setThreadAffinity(0, {cpu});
+    }
+#if defined(__linux__)
+    if (priority > 0) {
+        setThreadScheduling(0, SCHED_FIFO, priority);
+    }
+    setThreadName(0, "elite_latency");
+    SdkThreadRegistry::instance().track(this, "ServoLatencyTracer", {static_cast<int>(::syscall(SYS_gettid))});
+#else
+    (void)priority;
+#endif
+    double timestamp = 0.0;
+    Joints target{};
+    Joints actual{};
+    const auto period = std::chrono::microseconds(poll_us);
+    auto next = std::chrono::steady_clock::now();
+    while (running_) {
+        if (reader(timestamp, target, actual)) {
+            const double arrival = steadyNow();
+            addSample(clock ? clock(timestamp, arrival) : arrival, target, actual);
+        }
+        next += period;
+        const auto now = std::chrono::steady_clock::now();
+        if (next < now) {
+            next = now;
+        }
+        std::unique_lock<std::mutex> lock(wait_mutex_);
+        wait_cv_.wait_until(lock, next, [this] { return !running_; });
+    }
+}
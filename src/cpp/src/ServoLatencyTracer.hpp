@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Distribution of one latency, in milliseconds, over the last samples.
+ */
+struct LatencyDistribution {
+    uint64_t count = 0;      // Matches since start()
+    double last_ms = 0.0;
+    double min_ms = 0.0;     // The statistics below cover the window
+    double mean_ms = 0.0;
+    double p50_ms = 0.0;
+    double p90_ms = 0.0;
+    double p99_ms = 0.0;
+    double max_ms = 0.0;
+};
+
+/**
+ * @brief Which latency of the servo chain.
+ */
+enum class ServoLatency : int {
+    COMMAND_TO_TARGET = 0,  // writeServoj() until target_joint_positions reaches the command
+    TARGET_TO_ACTUAL = 1,   // target_joint_positions until actual_joint_positions reaches it
+    COMMAND_TO_ACTUAL = 2,  // writeServoj() until actual_joint_positions reaches the command
+    COUNT
+};
+
+/**
+ * @brief Measure the latencies of the servo chain: host command, controller target, measured position.
+ *
+ * Commands are stamped with the host steady clock when they are sent. Every new robot sample is matched against the
+ * recent history: its target against the commanded path, its actual position against the commanded and the target
+ * paths. A match is the closest point of the path (interpolated between two consecutive entries); its time gives the
+ * latency. Samples taken while the path is at rest, or farther from it than the tolerance, are not matched: the
+ * robot must move for the latencies to be measured. When the path passed near a sample several times within
+ * `max_latency` (back-and-forth motions), the pass whose latency is closest to the previous one is taken; until a
+ * first unambiguous match such samples are skipped.
+ */
+class ServoLatencyTracer {
+   public:
+    static constexpr int JOINTS = 6;
+    using Joints = std::array<double, JOINTS>;
+
+    // Read the sample if a new one arrived: controller timestamp, target and actual joint positions
+    using SampleReader = std::function<bool(double& timestamp, Joints& target, Joints& actual)>;
+    // Host steady clock time of a sample from its controller timestamp and its arrival time
+    using SampleClock = std::function<double(double timestamp, double arrival)>;
+
+    struct Options {
+        double tolerance = 0.002;   // Largest distance of a match to the path [rad]
+        double min_speed = 0.01;    // Slowest path speed that is matched [rad/s]
+        double max_latency = 0.5;   // Longest latency searched [s]
+        int window = 4096;          // Latencies kept for the statistics
+    };
+
+    explicit ServoLatencyTracer(const Options& options);
+    ServoLatencyTracer() : ServoLatencyTracer(Options()) {}
+    ~ServoLatencyTracer();
+
+    ServoLatencyTracer(const ServoLatencyTracer&) = delete;
+    ServoLatencyTracer& operator=(const ServoLatencyTracer&) = delete;
+
+    /**
+     * @brief Stamp a command sent at `host_time` [s, steady clock].
+     */
+    void recordCommand(const Joints& q, double host_time);
+
+    /**
+     * @brief Match a robot sample at `host_time` against the history.
+     */
+    void addSample(double host_time, const Joints& target, const Joints& actual);
+
+    /**
+     * @brief Poll `reader` every `poll_us` on a background thread and add each new sample.
+     *
+     * @param clock Time of a sample, nullptr to use its arrival time
+     * @param cpu Core of the thread, < 0 for no pinning
+     * @param priority SCHED_FIFO priority, <= 0 keeps the default policy
+     * @return false if already running
+     */
+    bool start(SampleReader reader, SampleClock clock, int poll_us, int cpu, int priority);
+
+    void stop();
+
+    bool isRunning() const { return running_; }
+
+    /**
+     * @brief Forget the history and the latencies.
+     */
+    void reset();
+
+    LatencyDistribution distribution(ServoLatency latency) const;
+
+    /**
+     * @brief Latencies of the window in milliseconds, oldest first.
+     */
+    std::vector<double> latencies(ServoLatency latency) const;
+
+    uint64_t commands() const;
+    uint64_t samples() const;
+
+   private:
+    struct Entry {
+        double time;
+        Joints q;
+    };
+
+    struct Window {
+        std::vector<double> values;
+        size_t next = 0;
+        bool full = false;
+        uint64_t count = 0;
+        double last = 0.0;
+    };
+
+    // Time at which `path` passed closest to `q`, false if no point of a moving segment is within the tolerance.
+    // `previous` is the last latency [s], < 0 if none: it picks the pass when the path came near `q` several times.
+    bool match(const std::deque<Entry>& path, const Joints& q, double now, double previous, double& time) const;
+    void push(ServoLatency latency, double value_ms);
+    void trim(std::deque<Entry>& path, double now);
+    void loop(SampleReader reader, SampleClock clock, int poll_us, int cpu, int priority);
+
+    Options options_;
+    mutable std::mutex mutex_;
+    std::deque<Entry> commands_;
+    std::deque<Entry> targets_;
+    std::array<Window, static_cast<size_t>(ServoLatency::COUNT)> windows_;
+    uint64_t command_count_ = 0;
+    uint64_t sample_count_ = 0;
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+};
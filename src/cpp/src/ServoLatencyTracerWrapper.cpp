@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "ServoLatencyTracerWrapper.hpp"
+#include "ClockSync.hpp"
+#include "SamplingUtils.hpp"
+#include "ServoLatencyTracer.hpp"
+
+#include <Elite/EliteDriver.hpp>
+#include <Elite/RtsiIOInterface.hpp>
+
+#include <pybind11/stl.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace py = pybind11;
+using namespace ELITE;
+
+using Joints = ServoLatencyTracer::Joints;
+
+static Joints toJoints(const vector6d_t& values) {
+    Joints q;
+    std::copy(values.begin(), values.end(), q.begin());
+    return q;
+}
+
+static ServoLatencyTracer::SampleReader rtsiSampleReader(RtsiIOInterface* rtsi) {
+    double last_timestamp = rtsi->getTimestamp();
+    return [rtsi, last_timestamp](double& timestamp, Joints& target, Joints& actual) mutable {
+        return readRtsiSample(rtsi, last_timestamp, timestamp, [rtsi, &target, &actual] {
+            target = toJoints(rtsi->getTargetJointPositions());
+            actual = toJoints(rtsi->getActualJointPositions());
+        });
+    };
+}
+
+// Controller time of the sample once the clock sync is valid, its arrival time before
+static ServoLatencyTracer::SampleClock syncClock(const RtsiClockSync* sync) {
+    return [sync](double timestamp, double arrival) {
+        try {
+            return sync->sync().toHost(timestamp);
+        } catch (const std::runtime_error&) {
+            return arrival;
+        }
+    };
+}
+
+void bindServoLatencyTracer(py::module_& m) {
+    py::enum_<ServoLatency>(m, "ServoLatency", py::arithmetic())
+        .value("COMMAND_TO_TARGET", ServoLatency::COMMAND_TO_TARGET,
+               "writeServoj() until target_joint_positions reaches the command")
+        .value("TARGET_TO_ACTUAL", ServoLatency::TARGET_TO_ACTUAL,
+               "target_joint_positions until actual_joint_positions reaches it")
+        .value("COMMAND_TO_ACTUAL", ServoLatency::COMMAND_TO_ACTUAL,
+               "writeServoj() until actual_joint_positions reaches the command")
+        .export_values();
+
+    py::class_<LatencyDistribution>(m, "LatencyDistribution")
+        .def_readonly("count", &LatencyDistribution::count, "Matches since start().")
+        .def_readonly("last_ms", &LatencyDistribution::last_ms)
+        .def_readonly("min_ms", &LatencyDistribution::min_ms, "Over the window, like the other statistics.")
+        .def_readonly("mean_ms", &LatencyDistribution::mean_ms)
+        .def_readonly("p50_ms", &LatencyDistribution::p50_ms)
+        .def_readonly("p90_ms", &LatencyDistribution::p90_ms)
+        .def_readonly("p99_ms", &LatencyDistribution::p99_ms)
+        .def_readonly("max_ms", &LatencyDistribution::max_ms)
+        .def("__repr__", [](const LatencyDistribution& d) {
+            return py::str("<LatencyDistribution count={} mean={:.3f}ms p50={:.3f}ms p99={:.3f}ms max={:.3f}ms>")
+                .format(d.count, d.mean_ms, d.p50_ms, d.p99_ms, d.max_ms);
+        });
+
+    py::class_<ServoLatencyTracer>(m, "ServoLatencyTracer",
+                                   "Latencies of the servo chain: writeServoj() command, RTSI target and actual joint "
+                                   "positions.")
+        .def(py::init([](double tolerance, double min_speed, double max_latency, int window) {
+                 ServoLatencyTracer::Options options;
+                 options.tolerance = tolerance;
+                 options.min_speed = min_speed;
+                 options.max_latency = max_latency;
+                 options.window = window;
+                 return new ServoLatencyTracer(options);
+             }),
+             py::arg("tolerance") = 0.002, py::arg("min_speed") = 0.01, py::arg("max_latency") = 0.5,
+             py::arg("window") = 4096,
+             R"doc(
+                Args:
+                    tolerance (float): Largest distance of a sample to the matched path [rad]
+                    min_speed (float): Slowest path speed that is matched [rad/s]; samples at rest are not matched
+                    max_latency (float): Longest latency searched [s]
+                    window (int): Latencies kept for the statistics
+
+                Raises:
+                    ValueError: An option is out of range
+            )doc")
+        .def(
+            "start",
+            [](ServoLatencyTracer& self, RtsiIOInterface& rtsi, const RtsiClockSync* clock_sync, int poll_us, int cpu,
+               int priority) {
+                return self.start(rtsiSampleReader(&rtsi), clock_sync ? syncClock(clock_sync) : nullptr, poll_us, cpu,
+                                  priority);
+            },
+            py::arg("rtsi"), py::arg("clock_sync") = nullptr, py::arg("poll_us") = 100, py::arg("cpu") = -1,
+            py::arg("priority") = 0, py::keep_alive<1, 2>(), py::keep_alive<1, 3>(),
+            R"doc(
+                Start matching the RTSI samples against the commands. The RTSI output recipe must contain timestamp,
+                target_joint_positions and actual_joint_positions.
+
+                Args:
+                    rtsi (RtsiIOInterface): Connected RTSI interface
+                    clock_sync (RtsiClockSync): Time the samples with the controller timestamp converted to host
+                        time, which removes the RTSI transport and polling delay. None uses the time a sample is seen.
+                    poll_us (int): Polling period
+                    cpu (int): Core of the thread, < 0 for no pinning
+                    priority (int): SCHED_FIFO priority, <= 0 keeps the default policy
+
+                Returns:
+                    bool: False if already running
+            )doc")
+        .def("stop", &ServoLatencyTracer::stop, py::call_guard<py::gil_scoped_release>(),
+             "Stop the thread and wait for it.")
+        .def("isRunning", &ServoLatencyTracer::isRunning)
+        .def(
+            "writeServoj",
+            [](ServoLatencyTracer& self, EliteDriver& driver, const vector6d_t& pos, int timeout_ms) {
+                const double sent = steadyNow();
+                if (!driver.writeServoj(pos, timeout_ms, false)) {
+                    return false;
+                }
+                self.recordCommand(toJoints(pos), sent);
+                return true;
+            },
+            py::arg("driver"), py::arg("pos"), py::arg("timeout_ms"), py::call_guard<py::gil_scoped_release>(),
+            R"doc(
+                Send a joint servoj() point with driver.writeServoj() and stamp it.
+
+                Args:
+                    driver (EliteDriver): Driver running the external control script
+                    pos (list): Joint positions [rad]
+                    timeout_ms (int): Read timeout of the reverse socket in the control script
+
+                Returns:
+                    bool: True if sent
+            )doc")
+        .def(
+            "recordCommand",
+            [](ServoLatencyTracer& self, const vector6d_t& pos, py::object host_time) {
+                self.recordCommand(toJoints(pos), host_time.is_none() ? steadyNow() : host_time.cast<double>());
+            },
+            py::arg("pos"), py::arg("host_time") = py::none(),
+            R"doc(
+                Stamp a joint command sent another way.
+
+                Args:
+                    pos (list): Commanded joint positions [rad]
+                    host_time (float): time.monotonic() when it was sent, now when None
+            )doc")
+        .def("reset", &ServoLatencyTracer::reset, "Forget the history and the latencies.")
+        .def("getDistribution", &ServoLatencyTracer::distribution, py::arg("latency"),
+             "Statistics of a latency over the window.")
+        .def("getLatencies", &ServoLatencyTracer::latencies, py::arg("latency"),
+             "Latencies of the window in ms, oldest first.")
+        .def("getCommandCount", &ServoLatencyTracer::commands)
+        .def("getSampleCount", &ServoLatencyTracer::samples);
+}
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Incremental SHA-256.
+ */
+class Sha256 {
+   public:
+    using Digest = std::array<uint8_t, 32>;
+
+    Sha256();
+
+    void update(const void* data, size_t size);
+
+    /**
+     * @brief Finish the hash. The object must not be updated afterwards.
+     */
+    Digest finish();
+
+    static Digest hash(const void* data, size_t size);
+
+    /**
+     * @brief Hash a file, memory-mapped when possible.
+     *
+     * @return false if the file cannot be read
+     */
+    static bool hashFile(const std::string& path, Digest& digest, uint64_t* size = nullptr);
+
+    static std::string toHex(const Digest& digest);
+
+   private:
+    void compress(const uint8_t* block);
+
+    uint32_t state_[8];
+    uint8_t buffer_[64];
+    size_t buffered_ = 0;
+    uint64_t length_ = 0;
+};
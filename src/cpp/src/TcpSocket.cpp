@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "TcpSocket.hpp"
+
+#ifdef _WIN32
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+#if !defined(_WIN32) && !defined(MSG_NOSIGNAL)
+// macOS has no MSG_NOSIGNAL, SO_NOSIGPIPE is set on the socket instead
+#define MSG_NOSIGNAL 0
+#endif
+
+#ifdef _WIN32
+static const socket_handle_t INVALID_HANDLE = INVALID_SOCKET;
+
+namespace {
+struct WinsockInit {
+    WinsockInit() {
+        WSADATA data;
+        WSAStartup(MAKEWORD(2, 2), &data);
+    }
+    ~WinsockInit() { WSACleanup(); }
+};
+}  // namespace
+
+static void closeHandle(socket_handle_t fd) { closesocket(fd); }
+static void setNonBlocking(socket_handle_t fd, bool enable) {
+    u_long mode = enable ? 1 : 0;
+    ioctlsocket(fd, FIONBIO, &mode);
+}
+static int pollHandle(socket_handle_t fd, short events, int timeout_ms) {
+    WSAPOLLFD pfd{fd, events, 0};
+    return WSAPoll(&pfd, 1, timeout_ms);
+}
+#else
+static const socket_handle_t INVALID_HANDLE = -1;
+
+static void closeHandle(socket_handle_t fd) { ::close(fd); }
+static void setNonBlocking(socket_handle_t fd, bool enable) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, enable ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK));
+}
+static int pollHandle(socket_handle_t fd, short events, int timeout_ms) {
+    pollfd pfd{fd, events, 0};
+    int ret;
+    do {
+        ret = ::poll(&pfd, 1, timeout_ms);
+    } while (ret < 0 && errno == EINTR);
+    return ret;
+}
+#endif
+
+TcpSocket::TcpSocket() : fd_(INVALID_HANDLE) {
+#ifdef _WIN32
+    static WinsockInit winsock_init;
+#endif
+}
+
+TcpSocket::~TcpSocket() { close(); }
+
+bool TcpSocket::connect(const std::string& ip, int port, int timeout_ms) {
+    close();
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    if (inet_pton(AF_INET, ip.c_str(), &addr.sin_addr) != 1) {
+        return false;
+    }
+
+    socket_handle_t fd = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (fd == INVALID_HANDLE) {
+        return false;
+    }
+
+    // Non-blocking connect so that the timeout is honored
+    setNonBlocking(fd, true);
+    int ret = ::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+    if (ret != 0) {
+        if (pollHandle(fd, POLLOUT, timeout_ms) <= 0) {
+            closeHandle(fd);
+            return false;
+        }
+        int err = 0;
+        socklen_t len = sizeof(err);
+        getsockopt(fd, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&err), &len);
+        if (err != 0) {
+            closeHandle(fd);
+            return false;
+        }
+    }
+    setNonBlocking(fd, false);
+
+    int no_delay = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&no_delay), sizeof(no_delay));
+#ifdef SO_NOSIGPIPE
+    int no_sigpipe = 1;
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &no_sigpipe, sizeof(no_sigpipe));
+#endif
+    fd_ = fd;
+    return true;
+}
+
+static void shutdownHandle(socket_handle_t fd) {
+#ifdef _WIN32
+    ::shutdown(fd, SD_BOTH);
+#else
+    ::shutdown(fd, SHUT_RDWR);
+#endif
+}
+
+void TcpSocket::shutdown() {
+    socket_handle_t fd = fd_;
+    if (fd != INVALID_HANDLE && !shut_down_.exchange(true)) {
+        shutdownHandle(fd);
+    }
+}
+
+void TcpSocket::close() {
+    socket_handle_t fd = fd_.exchange(INVALID_HANDLE);
+    if (fd != INVALID_HANDLE) {
+        shutdownHandle(fd);
+        closeHandle(fd);
+    }
+    shut_down_ = false;
+}
+
+bool TcpSocket::isOpen() const { return fd_ != INVALID_HANDLE && !shut_down_; }
+
+bool TcpSocket::writeAll(const void* data, size_t size) {
+    socket_handle_t fd = fd_;
+    const char* ptr = static_cast<const char*>(data);
+    while (size > 0 && fd != INVALID_HANDLE) {
+#ifdef _WIN32
+        int n = ::send(fd, ptr, static_cast<int>(size), 0);
+#else
+        ssize_t n = ::send(fd, ptr, size, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+#endif
+        if (n <= 0) {
+            return false;
+        }
+        ptr += n;
+        size -= static_cast<size_t>(n);
+    }
+    return size == 0;
+}
+
+int TcpSocket::read(void* data, size_t size, int timeout_ms) {
+    socket_handle_t fd = fd_;
+    if (fd == INVALID_HANDLE) {
+        return -1;
+    }
+    int ready = pollHandle(fd, POLLIN, timeout_ms);
+    if (ready == 0) {
+        return 0;
+    }
+    if (ready < 0) {
+        return -1;
+    }
+#ifdef _WIN32
+    int n = ::recv(fd, static_cast<char*>(data), static_cast<int>(size), 0);
+#else
+    ssize_t n;
+    do {
+        n = ::recv(fd, data, size, 0);
+    } while (n < 0 && errno == EINTR);
+#endif
+    return n > 0 ? static_cast<int>(n) : -1;
+}
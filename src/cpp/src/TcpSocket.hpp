@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef _WIN32
+#include <winsock2.h>
+using socket_handle_t = SOCKET;
+#else
+using socket_handle_t = int;
+#endif
+
+/**
+ * @brief Minimal blocking TCP client used by the native helpers that talk to the controller directly.
+ *
+ * All functions are thread compatible: one reader and one writer may use the socket concurrently.
+ */
+class TcpSocket {
+   public:
+    TcpSocket();
+    ~TcpSocket();
+
+    TcpSocket(const TcpSocket&) = delete;
+    TcpSocket& operator=(const TcpSocket&) = delete;
+
+    /**
+     * @brief Connect to `ip:port`.
+     *
+     * @param timeout_ms Connect timeout
+     * @return true on success
+     */
+    bool connect(const std::string& ip, int port, int timeout_ms);
+
+    /**
+     * @brief Shut down the connection without releasing the handle. Unblocks a pending read or write, which then
+     * fails. Safe to call while another thread uses the socket.
+     */
+    void shutdown();
+
+    /**
+     * @brief Shut down and close the socket. The handle is released: no other thread may be using the socket, call
+     * shutdown() and wait for them first.
+     */
+    void close();
+
+    bool isOpen() const;
+
+    /**
+     * @brief Write the whole buffer.
+     *
+     * @return true if every byte was written
+     */
+    bool writeAll(const void* data, size_t size);
+
+    /**
+     * @brief Read at most `size` bytes.
+     *
+     * @param timeout_ms Time to wait for data, 0 does not wait
+     * @return Number of bytes read, 0 on timeout, -1 if the connection is closed or broken
+     */
+    int read(void* data, size_t size, int timeout_ms);
+
+   private:
+    std::atomic<socket_handle_t> fd_;
+    std::atomic<bool> shut_down_{false};
+};
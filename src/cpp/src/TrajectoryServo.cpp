@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "TrajectoryServo.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+// Longest step taken at once: a gap in the samples must not skip a part of the motion
+constexpr double MAX_SERVO_DT = 0.1;
+
+}  // namespace
+
+TrajectoryServo::TrajectoryServo() : runner_("trajectory_servo", &TrajectoryServo::step, &state_, PARAM_COUNT) {
+    setLimits({1.0, 1.0, 1.0, 1.0, 1.0, 1.0}, {1.0, 1.0, 1.0, 1.0, 1.0, 1.0}, {10.0, 10.0, 10.0, 10.0, 10.0, 10.0});
+}
+
+void TrajectoryServo::setLimits(const Joints& max_velocity, const Joints& max_acceleration, const Joints& max_jerk) {
+    for (size_t i = 0; i < 6; ++i) {
+        if (!(max_velocity[i] > 0.0) || !(max_acceleration[i] > 0.0) || !(max_jerk[i] > 0.0)) {
+            throw std::invalid_argument("Velocity, acceleration and jerk limits must be positive");
+        }
+    }
+    double values[18];
+    std::copy(max_velocity.begin(), max_velocity.end(), values);
+    std::copy(max_acceleration.begin(), max_acceleration.end(), values + 6);
+    std::copy(max_jerk.begin(), max_jerk.end(), values + 12);
+    runner_.setParameters(values, MAX_VELOCITY, 18);
+}
+
+void TrajectoryServo::setTarget(const Joints& target) {
+    // Target and request in one write: a cycle sees both or neither
+    double values[7];
+    std::copy(target.begin(), target.end(), values);
+    values[6] = static_cast<double>(++target_requests_);
+    runner_.setParameters(values, TARGET, 7);
+}
+
+int TrajectoryServo::step(void* context, const EliteControlState* state, const double* params, uint32_t param_count,
+                          EliteControlOutput* out) {
+    if (param_count < PARAM_COUNT) {
+        return -1;
+    }
+    State& s = *static_cast<State*>(context);
+    OnlineTrajectoryGenerator& generator = s.generator;
+
+    if (state->cycle == 0) {
+        // Limits are validated by setLimits() before they reach the block
+        generator.setLimits(params + MAX_VELOCITY, params + MAX_ACCELERATION, params + MAX_JERK);
+        generator.reset(state->actual_joint_positions);
+        s.params_version = state->params_version;
+        // A target set before this start is stale: hold the measured position until the next one
+        s.target_request = params[TARGET_REQUEST];
+    } else if (state->params_version != s.params_version) {
+        generator.setLimits(params + MAX_VELOCITY, params + MAX_ACCELERATION, params + MAX_JERK);
+        s.params_version = state->params_version;
+    }
+    if (params[TARGET_REQUEST] != s.target_request) {
+        generator.setTarget(params + TARGET);
+        s.target_request = params[TARGET_REQUEST];
+    }
+
+    // The first cycle sends the measured position, later ones advance by the controller time between samples
+    const bool reached = state->dt > 0.0 ? generator.update(std::min(state->dt, MAX_SERVO_DT)) : generator.finished();
+
+    out->command = ELITE_CONTROL_SERVOJ;
+    std::copy(generator.position().begin(), generator.position().end(), out->values);
+    std::copy(generator.velocity().begin(), generator.velocity().end(), out->telemetry + TELEMETRY_VELOCITY);
+    std::copy(generator.acceleration().begin(), generator.acceleration().end(),
+              out->telemetry + TELEMETRY_ACCELERATION);
+    out->telemetry[TELEMETRY_TIME_LEFT] = generator.timeLeft();
+    out->telemetry[TELEMETRY_PLAN_TIME] = generator.lastPlanTimeUs();
+    out->telemetry[TELEMETRY_REACHED] = reached ? 1.0 : 0.0;
+    return 0;
+}
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include "ControlPluginRunner.hpp"
+#include "OnlineTrajectory.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @brief Joint servo run by a ControlPluginRunner: an OnlineTrajectoryGenerator moves toward the last target and its
+ * setpoint is sent with writeServoj on every RTSI sample.
+ *
+ * Targets and limits go through the parameter block of the runner, so they are changed while the loop runs. The
+ * motion starts at rest from the measured joint positions and holds them until the first target set after the start.
+ */
+class TrajectoryServo {
+   public:
+    using Joints = std::array<double, 6>;
+
+    // Layout of the parameter block
+    enum Param : size_t {
+        TARGET = 0,
+        TARGET_REQUEST = 6,
+        MAX_VELOCITY = 7,
+        MAX_ACCELERATION = 13,
+        MAX_JERK = 19,
+        PARAM_COUNT = 25
+    };
+
+    // Layout of the telemetry
+    enum Telemetry : size_t {
+        TELEMETRY_VELOCITY = 0,      // Velocity of the setpoint
+        TELEMETRY_ACCELERATION = 6,  // Acceleration of the setpoint
+        TELEMETRY_TIME_LEFT = 12,    // Time to the target [s]
+        TELEMETRY_PLAN_TIME = 13,    // Time of the last planning [us]
+        TELEMETRY_REACHED = 14       // 1 once the target is reached
+    };
+
+    TrajectoryServo();
+
+    /**
+     * @throws std::invalid_argument if a limit is not positive
+     */
+    void setLimits(const Joints& max_velocity, const Joints& max_acceleration, const Joints& max_jerk);
+
+    /**
+     * @brief New joint target, planned from the current setpoint on the next cycle.
+     */
+    void setTarget(const Joints& target);
+
+    ControlPluginRunner& runner() { return runner_; }
+    const ControlPluginRunner& runner() const { return runner_; }
+
+   private:
+    // Touched by the real-time thread only
+    struct State {
+        OnlineTrajectoryGenerator generator{6, 0.002};
+        uint64_t params_version = 0;
+        double target_request = 0.0;
+    };
+
+    static int step(void* context, const EliteControlState* state, const double* params, uint32_t param_count,
+                    EliteControlOutput* out);
+
+    State state_;
+    std::atomic<uint64_t> target_requests_{0};
+    ControlPluginRunner runner_;
+};
@@ -0,0 +1,363 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "TrajectoryValidator.hpp"
+#include "ParallelFor.hpp"
+#include "RotationUtils.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+
+using namespace ELITE;
+
+namespace {
+
+// Minimum samples per worker thread: a sample costs about a microsecond with the geometry checks
+constexpr size_t PARALLEL_MIN_CHUNK = 256;
+// Shorter DH segments are joints, not links, and carry no capsule
+constexpr double MIN_SEGMENT_LENGTH = 1e-9;
+constexpr double INF = std::numeric_limits<double>::infinity();
+
+struct Capsule {
+    double a[3];
+    double b[3];
+    double radius;
+};
+
+double dot3(const double* u, const double* v) { return u[0] * v[0] + u[1] * v[1] + u[2] * v[2]; }
+
+// Distance between the segments [p1, q1] and [p2, q2] (closest points of two segments, Ericson)
+double segmentDistance(const double* p1, const double* q1, const double* p2, const double* q2) {
+    const double d1[3] = {q1[0] - p1[0], q1[1] - p1[1], q1[2] - p1[2]};
+    const double d2[3] = {q2[0] - p2[0], q2[1] - p2[1], q2[2] - p2[2]};
+    const double r[3] = {p1[0] - p2[0], p1[1] - p2[1], p1[2] - p2[2]};
+    const double a = dot3(d1, d1), e = dot3(d2, d2), f = dot3(d2, r);
+    double s = 0.0, t = 0.0;
+    if (a <= MIN_SEGMENT_LENGTH * MIN_SEGMENT_LENGTH && e <= MIN_SEGMENT_LENGTH * MIN_SEGMENT_LENGTH) {
+        s = t = 0.0;
+    } else if (a <= MIN_SEGMENT_LENGTH * MIN_SEGMENT_LENGTH) {
+        t = std::min(std::max(f / e, 0.0), 1.0);
+    } else {
+        const double c = dot3(d1, r);
+        if (e <= MIN_SEGMENT_LENGTH * MIN_SEGMENT_LENGTH) {
+            s = std::min(std::max(-c / a, 0.0), 1.0);
+        } else {
+            const double b = dot3(d1, d2);
+            const double denom = a * e - b * b;
+            // Parallel segments: any s works, take 0
+            s = denom > 0.0 ? std::min(std::max((b * f - c * e) / denom, 0.0), 1.0) : 0.0;
+            t = (b * s + f) / e;
+            if (t < 0.0) {
+                t = 0.0;
+                s = std::min(std::max(-c / a, 0.0), 1.0);
+            } else if (t > 1.0) {
+                t = 1.0;
+                s = std::min(std::max((b - c) / a, 0.0), 1.0);
+            }
+        }
+    }
+    double d = 0.0;
+    for (int k = 0; k < 3; ++k) {
+        const double diff = (p1[k] + d1[k] * s) - (p2[k] + d2[k] * t);
+        d += diff * diff;
+    }
+    return std::sqrt(d);
+}
+
+// Distance from the box to a sphere leaving it, 0 inside
+double outsideBox(const double* center, double radius, const vector3d_t& min, const vector3d_t& max) {
+    double outside = 0.0;
+    for (int k = 0; k < 3; ++k) {
+        outside = std::max({outside, min[k] - (center[k] - radius), (center[k] + radius) - max[k]});
+    }
+    return outside;
+}
+
+void requireTimes(const double* times, size_t count, double dt) {
+    if (times != nullptr) {
+        for (size_t i = 1; i < count; ++i) {
+            if (!(times[i] > times[i - 1])) {
+                throw std::invalid_argument("Timestamps must increase strictly");
+            }
+        }
+    } else if (!(dt > 0.0) && count > 1) {
+        throw std::invalid_argument("dt must be positive");
+    }
+}
+
+double disabledIfNotPositive(double limit) { return limit > 0.0 ? limit : INF; }
+
+}  // namespace
+
+TrajectoryValidator::TrajectoryValidator(const KinematicsSolver& fk) : fk_(fk), ik_(fk) {
+    const double two_pi = 2.0 * ROTATION_PI;
+    setPositionLimits({-two_pi, -two_pi, -two_pi, -two_pi, -two_pi, -two_pi},
+                      {two_pi, two_pi, two_pi, two_pi, two_pi, two_pi});
+    max_velocity_.fill(INF);
+    max_acceleration_.fill(INF);
+    max_jerk_.fill(INF);
+    radii_.fill(0.0);
+}
+
+void TrajectoryValidator::setTcp(const vector6d_t& tcp) {
+    fk_.setTcp(tcp);
+    ik_.setTcp(tcp);
+}
+
+void TrajectoryValidator::setPositionLimits(const vector6d_t& lower, const vector6d_t& upper) {
+    lower_ = lower;
+    upper_ = upper;
+    ik_.setJointLimits(lower, upper);
+}
+
+void TrajectoryValidator::setVelocityLimits(const vector6d_t& max_velocity) {
+    std::transform(max_velocity.begin(), max_velocity.end(), max_velocity_.begin(), disabledIfNotPositive);
+}
+
+void TrajectoryValidator::setAccelerationLimits(const vector6d_t& max_acceleration) {
+    std::transform(max_acceleration.begin(), max_acceleration.end(), max_acceleration_.begin(), disabledIfNotPositive);
+}
+
+void TrajectoryValidator::setJerkLimits(const vector6d_t& max_jerk) {
+    std::transform(max_jerk.begin(), max_jerk.end(), max_jerk_.begin(), disabledIfNotPositive);
+}
+
+void TrajectoryValidator::setLinkRadii(const vector6d_t& radii) {
+    for (double r : radii) {
+        if (!(r >= 0.0)) {
+            throw std::invalid_argument("Link radii must not be negative");
+        }
+    }
+    radii_ = radii;
+    updateCollisionPairs();
+}
+
+void TrajectoryValidator::setToolCapsule(const vector3d_t& start, const vector3d_t& end, double radius) {
+    if (!(radius >= 0.0)) {
+        throw std::invalid_argument("Tool radius must not be negative");
+    }
+    tool_start_ = start;
+    tool_end_ = end;
+    tool_radius_ = radius;
+    updateCollisionPairs();
+}
+
+void TrajectoryValidator::setCollisionMargin(double margin) { margin_ = margin; }
+
+void TrajectoryValidator::setWorkspace(const vector3d_t& min, const vector3d_t& max) {
+    for (int k = 0; k < 3; ++k) {
+        if (min[k] > max[k]) {
+            throw std::invalid_argument("Workspace minimum is above its maximum");
+        }
+    }
+    workspace_min_ = min;
+    workspace_max_ = max;
+    workspace_enabled_ = true;
+}
+
+void TrajectoryValidator::clearWorkspace() { workspace_enabled_ = false; }
+
+void TrajectoryValidator::updateCollisionPairs() {
+    // Capsule 2 (j - 1) is the offset d of joint j, capsule 2 (j - 1) + 1 its length a; links next to each other
+    // always touch at their joint and are not checked
+    auto link = [](int capsule) { return capsule == TOOL_CAPSULE ? TOOL_LINK : capsule / 2 + 1; };
+    auto present = [&](int capsule) {
+        if (capsule == TOOL_CAPSULE) {
+            return tool_radius_ > 0.0;
+        }
+        const int j = capsule / 2;
+        const double length = capsule % 2 == 0 ? fk_.dhD()[j] : fk_.dhA()[j];
+        return radii_[j] > 0.0 && std::fabs(length) > MIN_SEGMENT_LENGTH;
+    };
+    pairs_.clear();
+    for (int c0 = 0; c0 <= TOOL_CAPSULE; ++c0) {
+        for (int c1 = c0 + 1; c1 <= TOOL_CAPSULE; ++c1) {
+            // The tool is fixed to the flange, so it touches the links 5 and 6 as well
+            const int min_gap = c1 == TOOL_CAPSULE ? 3 : 2;
+            if (link(c1) - link(c0) >= min_gap && present(c0) && present(c1)) {
+                pairs_.emplace_back(c0, c1);
+            }
+        }
+    }
+}
+
+TrajectoryValidator::Result TrajectoryValidator::checkGeometry(const double* q) const {
+    Result result;
+    if (pairs_.empty() && !workspace_enabled_) {
+        return result;
+    }
+    double frames[(JOINTS + 1) * 12];
+    fk_.linkFrames(q, frames);
+    Capsule capsules[TOOL_CAPSULE + 1];
+    for (int j = 0; j < JOINTS; ++j) {
+        const double* prev = frames + j * 12;
+        const double* T = frames + (j + 1) * 12;
+        const double a = fk_.dhA()[j];
+        const double origin[3] = {T[3], T[7], T[11]};
+        // The offset d runs along the previous z axis, then the length a along the new x axis
+        const double middle[3] = {origin[0] - a * T[0], origin[1] - a * T[4], origin[2] - a * T[8]};
+        Capsule& offset = capsules[2 * j];
+        Capsule& length = capsules[2 * j + 1];
+        offset.a[0] = prev[3], offset.a[1] = prev[7], offset.a[2] = prev[11];
+        std::copy(middle, middle + 3, offset.b);
+        std::copy(middle, middle + 3, length.a);
+        std::copy(origin, origin + 3, length.b);
+        offset.radius = length.radius = radii_[j];
+    }
+    const double* flange = frames + JOINTS * 12;
+    auto toBase = [&](const vector3d_t& p, double* out) {
+        for (int r = 0; r < 3; ++r) {
+            out[r] = flange[r * 4 + 3] + flange[r * 4] * p[0] + flange[r * 4 + 1] * p[1] + flange[r * 4 + 2] * p[2];
+        }
+    };
+    Capsule& tool = capsules[TOOL_CAPSULE];
+    toBase(tool_start_, tool.a);
+    toBase(tool_end_, tool.b);
+    tool.radius = tool_radius_;
+
+    if (workspace_enabled_) {
+        double outside = 0.0;
+        int worst = -1;
+        const auto& tcp = fk_.getTcp();
+        double tcp_position[3];
+        toBase({tcp[0], tcp[1], tcp[2]}, tcp_position);
+        const double tcp_outside = outsideBox(tcp_position, 0.0, workspace_min_, workspace_max_);
+        if (tcp_outside > 0.0) {
+            outside = tcp_outside, worst = TOOL_LINK;
+        }
+        // The box bounds a capsule at the spheres of its ends
+        for (int c = 2; c <= TOOL_CAPSULE; ++c) {
+            const Capsule& capsule = capsules[c];
+            if (capsule.radius <= 0.0) {
+                continue;
+            }
+            const double d = std::max(outsideBox(capsule.a, capsule.radius, workspace_min_, workspace_max_),
+                                      outsideBox(capsule.b, capsule.radius, workspace_min_, workspace_max_));
+            if (d > outside) {
+                outside = d, worst = c == TOOL_CAPSULE ? TOOL_LINK : c / 2 + 1;
+            }
+        }
+        if (worst >= 0) {
+            result.violation = TrajectoryViolation::WORKSPACE;
+            result.joint = worst;
+            result.value = outside;
+            return result;
+        }
+    }
+
+    double clearance = INF;
+    for (const auto& pair : pairs_) {
+        const Capsule& c0 = capsules[pair.first];
+        const Capsule& c1 = capsules[pair.second];
+        const double d = segmentDistance(c0.a, c0.b, c1.a, c1.b) - c0.radius - c1.radius;
+        if (d < margin_ && d < clearance) {
+            clearance = d;
+            result.violation = TrajectoryViolation::SELF_COLLISION;
+            result.joint = pair.first / 2 + 1;
+            result.other = pair.second == TOOL_CAPSULE ? TOOL_LINK : pair.second / 2 + 1;
+            result.value = d;
+            result.limit = margin_;
+        }
+    }
+    return result;
+}
+
+TrajectoryValidator::Result TrajectoryValidator::checkSample(const double* q, size_t index, const double* times,
+                                                             double dt, size_t count) const {
+    auto time = [&](size_t k) { return times != nullptr ? times[k] : dt * static_cast<double>(k); };
+    // Velocity of the interval [k, k + 1], acceleration of the sample k from its two intervals
+    auto velocity = [&](size_t k, int j) { return (q[(k + 1) * 6 + j] - q[k * 6 + j]) / (time(k + 1) - time(k)); };
+    auto acceleration = [&](size_t k, int j) {
+        return 2.0 * (velocity(k, j) - velocity(k - 1, j)) / (time(k + 1) - time(k - 1));
+    };
+    Result result;
+    auto fail = [&](TrajectoryViolation violation, int joint, double value, double limit) {
+        result.violation = violation;
+        result.joint = joint;
+        result.value = value;
+        result.limit = limit;
+        return result;
+    };
+    const double* sample = q + index * 6;
+    for (int j = 0; j < JOINTS; ++j) {
+        if (sample[j] < lower_[j]) {
+            return fail(TrajectoryViolation::POSITION_LIMIT, j, sample[j], lower_[j]);
+        }
+        if (sample[j] > upper_[j]) {
+            return fail(TrajectoryViolation::POSITION_LIMIT, j, sample[j], upper_[j]);
+        }
+    }
+    for (int j = 0; j < JOINTS; ++j) {
+        if (index >= 1) {
+            const double v = velocity(index - 1, j);
+            if (std::fabs(v) > max_velocity_[j]) {
+                return fail(TrajectoryViolation::VELOCITY_LIMIT, j, v, max_velocity_[j]);
+            }
+        }
+        if (index >= 1 && index + 1 < count) {
+            const double a = acceleration(index, j);
+            if (std::fabs(a) > max_acceleration_[j]) {
+                return fail(TrajectoryViolation::ACCELERATION_LIMIT, j, a, max_acceleration_[j]);
+            }
+            if (index >= 2) {
+                const double jerk = (a - acceleration(index - 1, j)) / (time(index) - time(index - 1));
+                if (std::fabs(jerk) > max_jerk_[j]) {
+                    return fail(TrajectoryViolation::JERK_LIMIT, j, jerk, max_jerk_[j]);
+                }
+            }
+        }
+    }
+    return checkGeometry(sample);
+}
+
+TrajectoryValidator::Result TrajectoryValidator::validateJoints(const double* q, size_t count, const double* times,
+                                                                double dt, int threads) const {
+    requireTimes(times, count, dt);
+
+    // Each worker scans its range in order and stops at its first violation, or once an earlier one is known
+    std::atomic<size_t> first(count);
+    std::mutex mutex;
+    Result best;
+    parallelFor(count, PARALLEL_MIN_CHUNK, threads, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end && i < first.load(std::memory_order_relaxed); ++i) {
+            Result result = checkSample(q, i, times, dt, count);
+            if (!result.valid()) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (i < first.load(std::memory_order_relaxed)) {
+                    best = result;
+                    best.index = static_cast<int64_t>(i);
+                    first.store(i, std::memory_order_relaxed);
+                }
+                return;
+            }
+        }
+    });
+    return best;
+}
+
+TrajectoryValidator::Result TrajectoryValidator::validatePoses(const double* poses, size_t count, const double* seed,
+                                                               const double* times, double dt, double* q,
+                                                               int threads) const {
+    requireTimes(times, count, dt);
+    // Sequential by nature: every sample is seeded by the previous solution
+    std::vector<IkStatus> status(count);
+    ik_.solveBatch(poses, seed, 1, count, q, status.data(), 1);
+    size_t solved = count;
+    for (size_t i = 0; i < count; ++i) {
+        if (status[i] != IkStatus::SUCCESS && status[i] != IkStatus::NEAR_SINGULAR) {
+            solved = i;
+            break;
+        }
+    }
+    // Joints after the first failure only repeat the previous solution and are not checked
+    Result result = validateJoints(q, solved, times, dt, threads);
+    if (result.valid() && solved < count) {
+        result.violation = TrajectoryViolation::UNREACHABLE;
+        result.index = static_cast<int64_t>(solved);
+        result.value = static_cast<double>(status[solved]);
+    }
+    return result;
+}
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include "InverseKinematicsSolver.hpp"
+#include "KinematicsSolver.hpp"
+
+#include <Elite/DataType.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief First problem found in a trajectory.
+ */
+enum class TrajectoryViolation : int8_t {
+    NONE = 0,                // The trajectory passed every check
+    POSITION_LIMIT = 1,      // A joint is outside of its position limits
+    VELOCITY_LIMIT = 2,      // A joint velocity exceeds its limit
+    ACCELERATION_LIMIT = 3,  // A joint acceleration exceeds its limit
+    JERK_LIMIT = 4,          // A joint jerk exceeds its limit
+    WORKSPACE = 5,           // The TCP, the tool or a link leaves the workspace box
+    SELF_COLLISION = 6,      // Two link capsules, or the tool and a link, are closer than the margin
+    UNREACHABLE = 7,         // Cartesian trajectory only: no inverse kinematics solution within the joint limits
+};
+
+/**
+ * @brief Pre-flight checks of a whole trajectory before it is uploaded or streamed.
+ *
+ * Joint velocities, accelerations and jerks are finite differences of the samples at their timestamps. Links are
+ * modeled as capsules along the DH segments of each joint (offset d along the previous z axis, then length a along
+ * the new x axis) with a radius per link; links that are not adjacent in the chain must stay apart. Samples are split
+ * across worker threads and the violation with the smallest sample index is reported.
+ */
+class TrajectoryValidator {
+   public:
+    static constexpr int JOINTS = KinematicsSolver::JOINTS;
+
+    struct Result {
+        TrajectoryViolation violation = TrajectoryViolation::NONE;
+        int64_t index = -1;  // Sample where the violation is found, -1 if none
+        int joint = -1;      // Joint (0-5) of a limit violation, link (1-6, 7 for tool and TCP) of a geometry one
+        int other = -1;      // Second link of a self-collision
+        double value = 0.0;  // Joint value, clearance [m], distance outside the box [m] or IkStatus when unreachable
+        double limit = 0.0;  // Violated limit, or the required clearance
+
+        bool valid() const { return violation == TrajectoryViolation::NONE; }
+    };
+
+    explicit TrajectoryValidator(const KinematicsSolver& fk);
+
+    /**
+     * @brief Set the TCP offset relative to the flange, used by the workspace check and cartesian trajectories.
+     */
+    void setTcp(const ELITE::vector6d_t& tcp);
+
+    const ELITE::vector6d_t& getTcp() const { return fk_.getTcp(); }
+
+    /**
+     * @brief Position limits. Default is [-2pi, 2pi] for every joint.
+     */
+    void setPositionLimits(const ELITE::vector6d_t& lower, const ELITE::vector6d_t& upper);
+
+    /**
+     * @brief Velocity, acceleration and jerk limits of every joint. A limit of 0 or infinity disables the check, which
+     * is the default.
+     */
+    void setVelocityLimits(const ELITE::vector6d_t& max_velocity);
+    void setAccelerationLimits(const ELITE::vector6d_t& max_acceleration);
+    void setJerkLimits(const ELITE::vector6d_t& max_jerk);
+
+    /**
+     * @brief Capsule radius of each link [m]. A radius of 0 leaves the link out of the collision and workspace checks.
+     * Every radius is 0 by default, which disables the self-collision check.
+     */
+    void setLinkRadii(const ELITE::vector6d_t& radii);
+
+    /**
+     * @brief Tool capsule, given in the flange frame. It is checked against the links 1 to 4 and the workspace.
+     *
+     * @param radius Capsule radius [m], 0 removes the tool capsule
+     */
+    void setToolCapsule(const ELITE::vector3d_t& start, const ELITE::vector3d_t& end, double radius);
+
+    /**
+     * @brief Minimum clearance between two capsules [m], 0 by default.
+     */
+    void setCollisionMargin(double margin);
+
+    /**
+     * @brief Axis-aligned box in the base frame that must contain the TCP, the tool capsule and the capsules of the
+     * links 2 to 6. The base link turns in place and is not checked.
+     *
+     * @throws std::invalid_argument if a minimum is above its maximum
+     */
+    void setWorkspace(const ELITE::vector3d_t& min, const ELITE::vector3d_t& max);
+
+    void clearWorkspace();
+
+    /**
+     * @brief Check a joint trajectory.
+     *
+     * @param q Joint positions, `count` x 6
+     * @param times Timestamps of the samples, strictly increasing, or nullptr for a constant period `dt`
+     * @param dt Period of the samples when `times` is nullptr
+     * @param threads Number of worker threads, 0 uses all hardware threads
+     * @throws std::invalid_argument if the timestamps do not increase or `dt` is not positive
+     */
+    Result validateJoints(const double* q, size_t count, const double* times, double dt, int threads = 0) const;
+
+    /**
+     * @brief Check a cartesian trajectory: solve its joint positions, each sample seeded by the previous solution,
+     * then check them like validateJoints().
+     *
+     * @param poses TCP poses, `count` x 6
+     * @param seed Joint positions the robot starts from
+     * @param q Output joint positions, `count` x 6. Samples without a solution keep the previous joint positions.
+     */
+    Result validatePoses(const double* poses, size_t count, const double* seed, const double* times, double dt,
+                         double* q, int threads = 0) const;
+
+   private:
+    static constexpr int TOOL_LINK = JOINTS + 1;
+    static constexpr int LINK_CAPSULES = 2 * JOINTS;
+    static constexpr int TOOL_CAPSULE = LINK_CAPSULES;
+
+    void updateCollisionPairs();
+    Result checkSample(const double* q, size_t index, const double* times, double dt, size_t count) const;
+    Result checkGeometry(const double* q) const;
+
+    KinematicsSolver fk_;
+    InverseKinematicsSolver ik_;
+    ELITE::vector6d_t lower_;
+    ELITE::vector6d_t upper_;
+    ELITE::vector6d_t max_velocity_;
+    ELITE::vector6d_t max_acceleration_;
+    ELITE::vector6d_t max_jerk_;
+    ELITE::vector6d_t radii_;
+    ELITE::vector3d_t tool_start_{};
+    ELITE::vector3d_t tool_end_{};
+    double tool_radius_ = 0.0;
+    double margin_ = 0.0;
+    bool workspace_enabled_ = false;
+    ELITE::vector3d_t workspace_min_{};
+    ELITE::vector3d_t workspace_max_{};
+    // Capsule pairs checked for self-collision, indices into the capsules of a sample
+    std::vector<std::pair<int, int>> pairs_;
+};
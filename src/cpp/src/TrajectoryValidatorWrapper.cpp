@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "TrajectoryValidatorWrapper.hpp"
+#include "NdArrayUtils.hpp"
+#include "TrajectoryValidator.hpp"
+
+#include <Elite/RobotConfPackage.hpp>
+
+#include <pybind11/stl.h>
+
+#include <memory>
+#include <stdexcept>
+
+namespace py = pybind11;
+using namespace ELITE;
+
+// Timestamps of `count` samples, or nullptr when the samples are `dt` apart
+static const double* sampleTimes(const py::object& times, size_t count, DoubleArray& holder) {
+    if (times.is_none()) {
+        return nullptr;
+    }
+    holder = times.cast<DoubleArray>();
+    if (holder.ndim() != 1 || static_cast<size_t>(holder.shape(0)) != count) {
+        throw std::runtime_error("times must have one value per sample");
+    }
+    return holder.data();
+}
+
+void bindTrajectoryValidator(py::module_& m) {
+    py::enum_<TrajectoryViolation>(m, "TrajectoryViolation", py::arithmetic())
+        .value("NONE", TrajectoryViolation::NONE, "The trajectory passed every check")
+        .value("POSITION_LIMIT", TrajectoryViolation::POSITION_LIMIT, "A joint is outside of its position limits")
+        .value("VELOCITY_LIMIT", TrajectoryViolation::VELOCITY_LIMIT, "A joint velocity exceeds its limit")
+        .value("ACCELERATION_LIMIT", TrajectoryViolation::ACCELERATION_LIMIT, "A joint acceleration exceeds its limit")
+        .value("JERK_LIMIT", TrajectoryViolation::JERK_LIMIT, "A joint jerk exceeds its limit")
+        .value("WORKSPACE", TrajectoryViolation::WORKSPACE, "The TCP, the tool or a link leaves the workspace box")
+        .value("SELF_COLLISION", TrajectoryViolation::SELF_COLLISION, "Two links, or tool and link, are too close")
+        .value("UNREACHABLE", TrajectoryViolation::UNREACHABLE, "A pose has no solution within the joint limits")
+        .export_values();
+
+    using Result = TrajectoryValidator::Result;
+    py::class_<Result>(m, "TrajectoryValidation", "Outcome of a trajectory validation. True when it is valid.")
+        .def_readonly("violation", &Result::violation, "First violation, NONE if the trajectory is valid")
+        .def_readonly("index", &Result::index, "Sample of the violation, -1 if none")
+        .def_readonly("joint", &Result::joint,
+                      "Joint (0-5) of a limit violation, or link (1-6, 7 for the tool and TCP) of a geometry one")
+        .def_readonly("other", &Result::other, "Second link of a self-collision")
+        .def_readonly("value", &Result::value,
+                      "Joint value, clearance [m], distance outside the workspace [m] or IkStatus when unreachable")
+        .def_readonly("limit", &Result::limit, "Violated limit, or the required clearance [m]")
+        .def("valid", &Result::valid)
+        .def("__bool__", &Result::valid)
+        .def("__repr__", [](const Result& self) {
+            if (self.valid()) {
+                return std::string("<TrajectoryValidation valid>");
+            }
+            return py::str("<TrajectoryValidation {} at {} joint={} other={} value={:.6g} limit={:.6g}>")
+                .format(py::cast(self.violation).attr("name"), self.index, self.joint, self.other, self.value,
+                        self.limit)
+                .cast<std::string>();
+        });
+
+    py::class_<TrajectoryValidator>(m, "TrajectoryValidator",
+                                    "Pre-flight check of joint and cartesian trajectories against joint limits, "
+                                    "self-collision and a workspace box, before upload.")
+        .def(py::init([](const KinematicsInfo& info) {
+                 return std::make_unique<TrajectoryValidator>(
+                     KinematicsSolver(info.dh_a_, info.dh_d_, info.dh_alpha_));
+             }),
+             py::arg("info"),
+             R"doc(
+                Construct from the kinematics configuration of the robot.
+
+                Args:
+                    info (KinematicsInfo): Kinematics package read by `getPackage()` or `getPrimaryPackage()`.
+            )doc")
+        .def(py::init<const KinematicsSolver&>(), py::arg("kinematics"),
+             R"doc(
+                Construct from a forward kinematics object. The TCP offset of `kinematics` is copied.
+
+                Args:
+                    kinematics (Kinematics): Forward kinematics
+            )doc")
+        .def("setTcp", &TrajectoryValidator::setTcp, py::arg("tcp"),
+             "Set the TCP offset relative to the flange, used by the workspace check and cartesian trajectories.")
+        .def("getTcp", &TrajectoryValidator::getTcp)
+        .def("setPositionLimits", &TrajectoryValidator::setPositionLimits, py::arg("lower"), py::arg("upper"),
+             "Joint position limits [rad]. The default is [-2pi, 2pi] for every joint.")
+        .def("setVelocityLimits", &TrajectoryValidator::setVelocityLimits, py::arg("max_velocity"),
+             "Joint velocity limits [rad/s]. 0 disables the check of a joint, which is the default.")
+        .def("setAccelerationLimits", &TrajectoryValidator::setAccelerationLimits, py::arg("max_acceleration"),
+             "Joint acceleration limits [rad/s^2]. 0 disables the check of a joint, which is the default.")
+        .def("setJerkLimits", &TrajectoryValidator::setJerkLimits, py::arg("max_jerk"),
+             "Joint jerk limits [rad/s^3]. 0 disables the check of a joint, which is the default.")
+        .def("setLinkRadii", &TrajectoryValidator::setLinkRadii, py::arg("radii"),
+             R"doc(
+                Capsule radius of each link [m]. Links are capsules along the DH segments of their joint. A radius of 0
+                leaves the link out of the geometry checks; every radius is 0 by default, which disables the
+                self-collision check.
+
+                Raises:
+                    ValueError: A radius is negative
+            )doc")
+        .def("setToolCapsule", &TrajectoryValidator::setToolCapsule, py::arg("start"), py::arg("end"),
+             py::arg("radius"),
+             R"doc(
+                Tool capsule between two points of the flange frame, checked against the links 1 to 4 and the
+                workspace. A radius of 0 removes it.
+            )doc")
+        .def("setCollisionMargin", &TrajectoryValidator::setCollisionMargin, py::arg("margin"),
+             "Minimum clearance between two capsules [m], 0 by default.")
+        .def("setWorkspace", &TrajectoryValidator::setWorkspace, py::arg("min"), py::arg("max"),
+             R"doc(
+                Axis-aligned box in the base frame that must contain the TCP, the tool capsule and the capsules of the
+                links 2 to 6.
+
+                Raises:
+                    ValueError: A minimum is above its maximum
+            )doc")
+        .def("clearWorkspace", &TrajectoryValidator::clearWorkspace)
+        .def(
+            "validateJoints",
+            [](const TrajectoryValidator& self, const DoubleArray& q, double dt, const py::object& times,
+               int threads) {
+                const size_t count = requireRows(q, 6, "q");
+                DoubleArray times_holder;
+                const double* t = sampleTimes(times, count, times_holder);
+                const double* in = q.data();
+                py::gil_scoped_release release;
+                return self.validateJoints(in, count, t, dt, threads);
+            },
+            py::arg("q"), py::arg("dt") = 0.0, py::arg("times") = py::none(), py::arg("threads") = 0,
+            R"doc(
+                Check a joint trajectory. Velocities, accelerations and jerks are finite differences of the samples.
+
+                Args:
+                    q (numpy.ndarray): Joint positions, shape (N, 6)
+                    dt (float): Period of the samples [s], when `times` is not given
+                    times (numpy.ndarray): Timestamps of the samples [s], shape (N,)
+                    threads (int): Number of worker threads, 0 uses all cores
+
+                Returns:
+                    TrajectoryValidation: First violation, with the smallest sample index
+
+                Raises:
+                    ValueError: The timestamps do not increase or dt is not positive
+            )doc")
+        .def(
+            "validatePoses",
+            [](const TrajectoryValidator& self, const DoubleArray& poses, const vector6d_t& seed, double dt,
+               const py::object& times, int threads) {
+                const size_t count = requireRows(poses, 6, "poses");
+                DoubleArray times_holder;
+                const double* t = sampleTimes(times, count, times_holder);
+                DoubleArray q(std::vector<py::ssize_t>{static_cast<py::ssize_t>(count), 6});
+                const double* in = poses.data();
+                double* out = q.mutable_data();
+                Result result;
+                {
+                    py::gil_scoped_release release;
+                    result = self.validatePoses(in, count, seed.data(), t, dt, out, threads);
+                }
+                return py::make_tuple(result, q);
+            },
+            py::arg("poses"), py::arg("seed"), py::arg("dt") = 0.0, py::arg("times") = py::none(),
+            py::arg("threads") = 0,
+            R"doc(
+                Check a cartesian trajectory: solve the joint positions of every pose, seeded by the previous solution
+                from `seed`, then check them like validateJoints(). A pose without solution is UNREACHABLE.
+
+                Args:
+                    poses (numpy.ndarray): TCP poses, shape (N, 6)
+                    seed (list): Joint positions the robot starts from
+                    dt (float): Period of the samples [s], when `times` is not given
+                    times (numpy.ndarray): Timestamps of the samples [s], shape (N,)
+                    threads (int): Number of worker threads for the checks, 0 uses all cores
+
+                Returns:
+                    tuple: (TrajectoryValidation, q). `q` holds the joint positions, shape (N, 6); samples after an
+                        unreachable pose repeat the last solution.
+            )doc");
+}
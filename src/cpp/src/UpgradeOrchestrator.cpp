@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#include "UpgradeOrchestrator.hpp"
+#include "SamplingUtils.hpp"
+#include "Sha256.hpp"
+
+#include <Elite/RemoteUpgrade.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <stdexcept>
+
+#include <sys/stat.h>
+
+namespace {
+
+bool statFile(const std::string& path, uint64_t& size, int64_t& mtime) {
+    struct stat st;
+    if (::stat(path.c_str(), &st) != 0) {
+        return false;
+    }
+    size = static_cast<uint64_t>(st.st_size);
+    mtime = static_cast<int64_t>(st.st_mtime);
+    return true;
+}
+
+}  // namespace
+
+UpgradeOrchestrator::UpgradeOrchestrator(Upgrader upgrader)
+    : upgrader_(upgrader ? std::move(upgrader) : Upgrader(ELITE::UPGRADE::upgradeControlSoftware)) {}
+
+UpgradeOrchestrator::~UpgradeOrchestrator() {
+    cancel();
+    joinWorkers();
+}
+
+void UpgradeOrchestrator::setExpectedDigest(const std::string& hex_digest) {
+    std::string lower(hex_digest);
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return std::tolower(c); });
+    std::lock_guard<std::mutex> lock(mutex_);
+    expected_digest_ = lower;
+}
+
+void UpgradeOrchestrator::joinWorkers() {
+    for (auto& t : workers_) {
+        if (t.joinable()) {
+            t.join();
+        }
+    }
+    workers_.clear();
+}
+
+void UpgradeOrchestrator::finishRun() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+    done_cv_.notify_all();
+    event_cv_.notify_all();
+}
+
+std::string UpgradeOrchestrator::start(const std::string& file, const std::vector<Target>& targets) {
+    // Claimed before anything else: two concurrent start() calls must not both pass
+    if (running_.exchange(true)) {
+        throw std::runtime_error("An upgrade is already running");
+    }
+    // A cancel() from here on applies to this run
+    cancelled_ = false;
+    joinWorkers();
+
+    std::string hex;
+    try {
+        uint64_t size = 0;
+        int64_t mtime = 0;
+        Sha256::Digest digest;
+        if (!statFile(file, size, mtime) || !Sha256::hashFile(file, digest)) {
+            throw std::runtime_error("Cannot read upgrade package " + file);
+        }
+        hex = Sha256::toHex(digest);
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!expected_digest_.empty() && expected_digest_ != hex) {
+            throw std::runtime_error("Upgrade package digest " + hex + " does not match the expected " +
+                                     expected_digest_);
+        }
+        file_ = file;
+        digest_ = hex;
+        file_size_ = size;
+        file_mtime_ = mtime;
+        targets_ = targets;
+        states_.assign(targets.size(), UpgradeState::QUEUED);
+        events_.clear();
+        next_target_ = 0;
+    } catch (...) {
+        finishRun();
+        throw;
+    }
+
+    const size_t count = std::min<size_t>(static_cast<size_t>(concurrency_.load()), targets.size());
+    if (count == 0) {
+        finishRun();
+        return hex;
+    }
+    active_workers_ = count;
+    for (size_t i = 0; i < count; ++i) {
+        workers_.emplace_back(&UpgradeOrchestrator::workerLoop, this);
+    }
+    return hex;
+}
+
+void UpgradeOrchestrator::cancel() {
+    size_t first = 0;
+    size_t count = 0;
+    {
+        // start() replaces the targets under the same lock
+        std::lock_guard<std::mutex> lock(mutex_);
+        cancelled_ = true;
+        count = targets_.size();
+        // Take the robots that no worker has started yet
+        first = next_target_.exchange(count);
+    }
+    for (size_t i = first; i < count; ++i) {
+        pushEvent(i, UpgradeState::CANCELLED, "Cancelled before start");
+    }
+}
+
+bool UpgradeOrchestrator::packageUnchanged() const {
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    return statFile(file_, size, mtime) && size == file_size_ && mtime == file_mtime_;
+}
+
+void UpgradeOrchestrator::pushEvent(size_t index, UpgradeState state, std::string message) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    states_[index] = state;
+    events_.push_back(Event{index, targets_[index].ip, state, steadyNow(), std::move(message)});
+    event_cv_.notify_all();
+}
+
+void UpgradeOrchestrator::upgradeTarget(size_t index) {
+    if (cancelled_) {
+        pushEvent(index, UpgradeState::CANCELLED, "Cancelled before start");
+        return;
+    }
+    if (!packageUnchanged()) {
+        pushEvent(index, UpgradeState::FAILED, "Upgrade package changed since it was hashed");
+        return;
+    }
+    const Target& target = targets_[index];
+    pushEvent(index, UpgradeState::UPGRADING, "");
+    const double begin = steadyNow();
+    bool ok = false;
+    std::string error;
+    try {
+        ok = upgrader_(target.ip, file_, target.password);
+    } catch (const std::exception& e) {
+        error = e.what();
+    }
+    const std::string elapsed = "after " + std::to_string(static_cast<int>(steadyNow() - begin)) + " s";
+    if (ok) {
+        pushEvent(index, UpgradeState::SUCCEEDED, elapsed);
+    } else {
+        pushEvent(index, UpgradeState::FAILED, (error.empty() ? "Upgrade failed " : error + " ") + elapsed);
+    }
+}
+
+void UpgradeOrchestrator::workerLoop() {
+    for (size_t i = next_target_++; i < targets_.size(); i = next_target_++) {
+        upgradeTarget(i);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--active_workers_ == 0) {
+        running_ = false;
+        done_cv_.notify_all();
+        event_cv_.notify_all();
+    }
+}
+
+bool UpgradeOrchestrator::wait(int timeout_ms) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto done = [this] { return !running_; };
+    if (timeout_ms > 0) {
+        return done_cv_.wait_for(lock, std::chrono::milliseconds(timeout_ms), done);
+    }
+    done_cv_.wait(lock, done);
+    return true;
+}
+
+size_t UpgradeOrchestrator::pollEvents(std::vector<Event>& out, size_t max_events, int timeout_ms) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto ready = [this] { return !events_.empty() || !running_; };
+    if (timeout_ms > 0) {
+        event_cv_.wait_for(lock, std::chrono::milliseconds(timeout_ms), ready);
+    } else if (timeout_ms < 0) {
+        event_cv_.wait(lock, ready);
+    }
+    size_t count = events_.size();
+    if (max_events > 0) {
+        count = std::min(count, max_events);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        out.push_back(std::move(events_.front()));
+        events_.pop_front();
+    }
+    return count;
+}
+
+std::vector<UpgradeState> UpgradeOrchestrator::states() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return states_;
+}
+
+std::string UpgradeOrchestrator::digest() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return digest_;
+}
@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025, Elite Robots.
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief State of one robot in a fleet upgrade.
+ */
+enum class UpgradeState : int {
+    QUEUED = 0,
+    UPGRADING,
+    SUCCEEDED,
+    FAILED,
+    CANCELLED,
+};
+
+/**
+ * @brief Upgrade the control software of many robots in parallel with one package.
+ *
+ * The package is hashed once (SHA-256, memory-mapped) when the run starts, and can be checked against an expected
+ * digest. Before each robot, the file size and modification time are compared with the hashed file, so a package
+ * replaced during the rollout is never sent. State changes are queued as events that consumers take in batches;
+ * the workers never wait on a consumer.
+ */
+class UpgradeOrchestrator {
+   public:
+    struct Target {
+        std::string ip;
+        std::string password;
+    };
+
+    struct Event {
+        size_t target;  // Index in the target list
+        std::string ip;
+        UpgradeState state;
+        double timestamp;  // Steady clock seconds (Python time.monotonic())
+        std::string message;
+    };
+
+    // Signature of ELITE::UPGRADE::upgradeControlSoftware
+    using Upgrader = std::function<bool(const std::string& ip, const std::string& file, const std::string& password)>;
+
+    /**
+     * @param upgrader Upgrade function, ELITE::UPGRADE::upgradeControlSoftware by default
+     */
+    explicit UpgradeOrchestrator(Upgrader upgrader = nullptr);
+    ~UpgradeOrchestrator();
+
+    UpgradeOrchestrator(const UpgradeOrchestrator&) = delete;
+    UpgradeOrchestrator& operator=(const UpgradeOrchestrator&) = delete;
+
+    /**
+     * @brief Set the largest number of robots upgraded at once. Default 4.
+     */
+    void setConcurrency(int concurrency) { concurrency_ = concurrency > 0 ? concurrency : 1; }
+    int getConcurrency() const { return concurrency_; }
+
+    /**
+     * @brief Refuse to start when the package SHA-256 differs from `hex_digest`. An empty string disables the check.
+     */
+    void setExpectedDigest(const std::string& hex_digest);
+
+    /**
+     * @brief Hash the package and start upgrading the targets in the background.
+     *
+     * @return Hex SHA-256 of the package
+     * @throws std::runtime_error if a run is in progress, the package cannot be read or its digest is not the
+     * expected one
+     */
+    std::string start(const std::string& file, const std::vector<Target>& targets);
+
+    /**
+     * @brief Cancel the queued robots. Upgrades in progress cannot be interrupted and finish.
+     */
+    void cancel();
+
+    /**
+     * @brief Wait for the end of the run.
+     *
+     * @param timeout_ms Timeout, <= 0 waits forever
+     * @return true if the run is over
+     */
+    bool wait(int timeout_ms);
+
+    bool isRunning() const { return running_; }
+
+    /**
+     * @brief Take the queued events, waiting up to `timeout_ms` for the first one.
+     *
+     * @param max_events Largest number of events taken, 0 for all
+     * @param timeout_ms Timeout, 0 returns at once, < 0 waits forever. Returns early when the run is over.
+     * @return Number of events appended to `out`
+     */
+    size_t pollEvents(std::vector<Event>& out, size_t max_events, int timeout_ms);
+
+    /**
+     * @brief Current state of each target of the last run.
+     */
+    std::vector<UpgradeState> states() const;
+
+    /**
+     * @brief Hex SHA-256 of the package of the last run.
+     */
+    std::string digest() const;
+
+   private:
+    void workerLoop();
+    void upgradeTarget(size_t index);
+    void pushEvent(size_t index, UpgradeState state, std::string message);
+    bool packageUnchanged() const;
+    void joinWorkers();
+    void finishRun();
+
+    Upgrader upgrader_;
+    std::atomic<int> concurrency_{4};
+    std::string expected_digest_;
+
+    std::string file_;
+    std::string digest_;
+    uint64_t file_size_ = 0;
+    int64_t file_mtime_ = 0;
+    std::vector<Target> targets_;
+    std::atomic<size_t> next_target_{0};
+
+    mutable std::mutex mutex_;
+    std::condition_variable event_cv_;
+    std::condition_variable done_cv_;
+    std::deque<Event> events_;
+    std::vector<UpgradeState> states_;
+    size_t active_workers_ = 0;
+
+    std::atomic<bool> running_{false};
+    std::atomic<bool> cancelled_{false};
+    std::vector<std::thread> workers_;
+};
@@ -0,0 +1,36 @@
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2025, Elite Robots.
+"""Convert files written by BinaryLogWriter to text.
+
+Usage: python -m elite_cs_sdk.decode_log LOG_FILE [LOG_FILE ...]
+"""
+import sys
+import time
+
+from .elite_cs_sdk_python import decodeBinaryLog
+
+_LEVEL_NAMES = {0: "DEBUG", 1: "INFO", 2: "WARN", 3: "ERROR", 4: "FATAL", 5: "NONE"}
+
+
+def format_record(record):
+    timestamp, level, file, line, msg = record
+    seconds = int(timestamp)
+    millis = int((timestamp - seconds) * 1000)
+    stamp = time.strftime("%Y-%m-%d %H:%M:%S", time.localtime(seconds))
+    location = f"{file}:{line}: " if file else ""
+    return f"[{stamp}.{millis:03d}] [{_LEVEL_NAMES.get(int(level), str(level))}] {location}{msg}"
+
+
+def main(argv=None):
+    paths = sys.argv[1:] if argv is None else argv
+    if not paths:
+        print(__doc__.strip(), file=sys.stderr)
+        return 1
+    for path in paths:
+        for record in decodeBinaryLog(path):
+            print(format_record(record))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
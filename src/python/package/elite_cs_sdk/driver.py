@@ -0,0 +1,8 @@
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2025, Elite Robots.
+"""EliteDriver, its configuration and the connection health monitor. Bound when this module is first imported."""
+from .elite_cs_sdk_python import loadSubmodule
+
+_native = loadSubmodule("driver")
+__all__ = [name for name in dir(_native) if not name.startswith("_")]
+globals().update({name: getattr(_native, name) for name in __all__})
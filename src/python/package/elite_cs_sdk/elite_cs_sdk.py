@@ -1,9 +1,8 @@
 # SPDX-License-Identifier: MIT
 # Copyright (c) 2025, Elite Robots.
+import importlib
+
 from .elite_cs_sdk_python import (
-    EliteDriver, 
-    EliteDriverConfig,
-    DashboardClientInterface,
     LogLevel,
     LogHandler,
     registerLogHandler,
@@ -15,10 +14,6 @@ from .elite_cs_sdk_python import (
     logErrorMessage,
     logFatalMessage,
     logNoneMessage,
-    setCurrentThreadFiFoScheduling,
-    getThreadFiFoMaxPriority,
-    bindCurrentThreadToCpus,
-    ControllerLog,
     RobotMode,
     JointMode,
     SafetyMode,
@@ -31,29 +26,51 @@ from .elite_cs_sdk_python import (
     TrajectoryControlAction,
     ForceMode,
     FreedriveAction,
-    PrimaryClientInterface,
-    PrimaryPackage,
-    KinematicsInfo,
-    RobotException,
-    RobotError,
-    RobotRuntimeException,
-    RobotErrorType,
-    RobotErrorDataType,
-    RobotErrorLevel,
-    RobotExceptionType,
-    RtsiClientInterface,
-    RtsiIOInterface,
-    RtsiRecipe,
-    upgradeControlSoftware,
     VersionInfo,
     SDK_VERSION_INFO,
-    SerialConfig,
-    SerialCommunication,
+    AsyncLogSink,
+    BinaryLogWriter,
+    decodeBinaryLog,
+    LogRateLimiter,
+    ThreadSchedPolicy,
+    ThreadPolicy,
+    SdkThreadInfo,
+    listSdkThreads,
+    submoduleExports,
 )
 
+# Interfaces bound on first access, by submodule. `import elite_cs_sdk` only binds the names imported above; using
+# e.g. `elite_cs_sdk.RtsiIOInterface` or `elite_cs_sdk.rtsi` binds the RTSI group. Set ELITE_CS_SDK_EAGER=1 to bind
+# everything at import. The names of each submodule are declared with its bindings.
+_LAZY_SUBMODULES = submoduleExports()
+
+_LAZY_NAMES = {name: submodule for submodule, names in _LAZY_SUBMODULES.items() for name in names}
+
+
+def __getattr__(name):
+    if name in _LAZY_SUBMODULES:
+        return importlib.import_module("." + name, __package__)
+    submodule = _LAZY_NAMES.get(name)
+    if submodule is None:
+        raise AttributeError("module {!r} has no attribute {!r}".format(__name__, name))
+    value = getattr(importlib.import_module("." + submodule, __package__), name)
+    globals()[name] = value
+    return value
+
+
+def __dir__():
+    return sorted(set(globals()) | set(__all__) | set(_LAZY_SUBMODULES))
+
+
 __all__ = [
     'EliteDriver', 
     'EliteDriverConfig',
+    'DriverStartupTimings',
+    'ConnectionHealth',
+    'ConnectionIssue',
+    'ConnectionHealthStats',
+    'ConnectionHealthEvent',
+    'ConnectionHealthMonitor',
     "LogLevel",
     "LogHandler",
     "registerLogHandler",
@@ -95,9 +112,71 @@ __all__ = [
     'RtsiClientInterface',
     'RtsiIOInterface',
     'RtsiRecipe',
+    'ClockSync',
+    'ClockSyncState',
+    'RtsiClockSync',
     'upgradeControlSoftware',
     'VersionInfo',
     'SDK_VERSION_INFO',
     "SerialConfig",
     "SerialCommunication",
-]
\ No newline at end of file
+    "Kinematics",
+    "IkStatus",
+    "InverseKinematics",
+    "TrajectoryValidator",
+    "TrajectoryValidation",
+    "TrajectoryViolation",
+    "DashboardAsyncClient",
+    "DashboardQuery",
+    "DashboardStatusPoller",
+    "AsyncLogSink",
+    "BinaryLogWriter",
+    "decodeBinaryLog",
+    "LogRateLimiter",
+    "ModbusStatus",
+    "ModbusTable",
+    "ModbusPollResult",
+    "ModbusRtuClient",
+    "SerialFraming",
+    "SerialStreamReader",
+    "ControllerLogFleet",
+    "UpgradeState",
+    "UpgradeOrchestrator",
+    "sha256File",
+    "lockMemory",
+    "getLockedMemory",
+    "setCpuAffinity",
+    "getCpuAffinity",
+    "setCurrentThreadDeadlineScheduling",
+    "CpuDmaLatency",
+    "LatencyProbeResult",
+    "runLatencyProbe",
+    "ThreadSchedPolicy",
+    "ThreadPolicy",
+    "SdkThreadInfo",
+    "listSdkThreads",
+    "ControlPlugin",
+    "ControlPluginStats",
+    "AdmittanceController",
+    "TrajectoryServo",
+    "OnlineTrajectoryGenerator",
+    "ServoLatency",
+    "LatencyDistribution",
+    "ServoLatencyTracer",
+    "PathParameterization",
+    "TimedPath",
+    "PoseInterpolation",
+    "rotvecToQuat",
+    "quatToRotvec",
+    "rotvecToMatrix",
+    "matrixToRotvec",
+    "quatToMatrix",
+    "matrixToQuat",
+    "poseToMatrix",
+    "matrixToPose",
+    "poseTrans",
+    "poseInv",
+    "transformPoints",
+    "unwrapRotvecs",
+    "interpolatePoses",
+]
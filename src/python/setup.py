@@ -10,8 +10,8 @@ setup(
     packages=find_packages(where='package'),
     include_package_data=True,
     package_data={
-        'elite_cs_sdk': ['*.so', '*.script', '*.pyi', '*.dll', '*.lib', '*.pyd', '*.dylib']
+        'elite_cs_sdk': ['*.so', '*.script', '*.h', '*.pyi', '*.dll', '*.lib', '*.pyd', '*.dylib']
     },
-    install_requires=[],
+    install_requires=['numpy'],
     zip_safe=False,
 )